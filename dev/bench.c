@@ -0,0 +1,1152 @@
+/**
+ * \file            bench.c
+ * \brief           Microbenchmark for lwutil functions
+ *
+ * Every function is measured over a block of prepared input data,
+ * with the best of several runs reported in JSON format, one result per line:
+ *
+ *  {"name": "ld_u32_varint", "dist": "len1", "ns_per_op": 1.234, "gb_per_s": 0.811},
+ *
+ * Usage:
+ *  lwutil_bench [--out file.json] [--compare baseline.json] [--threshold percent] [--filter text] [--simd level]
+ *
+ * With `--simd`, kernels of lower SIMD level are used, see `lwutil_simd_t`.
+ * With `--compare`, results are checked against previously saved output
+ * and every benchmark slower by more than the threshold (default `10%`) is reported.
+ * Exit code is `2` if any regression has been found.
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lwutil/lwutil.h"
+#include "lwutil/lwutil_array.h"
+#include "lwutil/lwutil_base64.h"
+#include "lwutil/lwutil_bitmap.h"
+#include "lwutil/lwutil_bitstream.h"
+#include "lwutil/lwutil_column.h"
+#include "lwutil/lwutil_crc.h"
+#include "lwutil/lwutil_interp.h"
+#include "lwutil/lwutil_map.h"
+#include "lwutil/lwutil_ring.h"
+#include "lwutil/lwutil_schema.h"
+#include "lwutil/lwutil_vstream.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif /* defined(_WIN32) */
+
+#define BENCH_COUNT   4096U /*!< Number of values in single benchmark block */
+#define BENCH_RUNS    5U    /*!< Number of runs, best one is reported */
+#define BENCH_MIN_NS  20e6  /*!< Minimum duration of single run in nanoseconds */
+#define BENCH_STRIDE  64U   /*!< Number of values per index entry of seekable varint stream */
+
+/* Telemetry record, encoded with generated schema functions and by hand */
+#define BENCH_TLM_FIELDS(X)                                                                                            \
+    X(U8, type)                                                                                                        \
+    X(U16_BE, seq)                                                                                                     \
+    X(U32_LE, ts)                                                                                                      \
+    X(U32_LE, v0)                                                                                                      \
+    X(U32_LE, v1)                                                                                                      \
+    X(U32_VARINT, count)
+
+LWUTIL_SCHEMA_STRUCT(bench_tlm_t, BENCH_TLM_FIELDS);
+LWUTIL_SCHEMA_FUNCS(bench_tlm, bench_tlm_t, BENCH_TLM_FIELDS);
+
+/**
+ * \brief           Input data distribution for single benchmark
+ */
+typedef struct {
+    const char* name;                               /*!< Distribution name */
+    uint16_t vals16[BENCH_COUNT];                   /*!< Input values for 16-bit functions */
+    uint32_t vals[BENCH_COUNT];                     /*!< Input values */
+    uint64_t vals64[BENCH_COUNT];                   /*!< Input values for 64-bit functions */
+    uint8_t enc[BENCH_COUNT * 10U];                 /*!< Values encoded as varints */
+    size_t enc_len;                                 /*!< Length of encoded data in `enc` */
+    uint32_t enc_index[BENCH_COUNT / BENCH_STRIDE]; /*!< Offset of every `BENCH_STRIDE`-th value in `enc` */
+    uint8_t enc64[BENCH_COUNT * 10U];               /*!< 64-bit values encoded as varints */
+    size_t enc64_len;                               /*!< Length of encoded data in `enc64` */
+    uint8_t penc[BENCH_COUNT * 10U];                /*!< Values encoded as prefix varints */
+    size_t penc_len;                                /*!< Length of encoded data in `penc` */
+    uint8_t col[BENCH_COUNT * 5U];                  /*!< Values encoded with column codec, frame of reference only */
+    size_t col_len;                                 /*!< Length of encoded data in `col` */
+    char dec[BENCH_COUNT * 11U + 1U];               /*!< Values formatted as comma-separated decimal text */
+    size_t dec_len;                                 /*!< Length of text in `dec`, without NULL termination */
+    char dec64[BENCH_COUNT * 21U + 1U];             /*!< 64-bit values formatted as comma-separated decimal text */
+    size_t dec64_len;                               /*!< Length of text in `dec64`, without NULL termination */
+} bench_dist_t;
+
+/**
+ * \brief           Single benchmark case
+ */
+typedef struct {
+    const char* name;                          /*!< Function name */
+    size_t (*fn)(const bench_dist_t* dist);    /*!< Runs `BENCH_COUNT` operations, returns checksum */
+    size_t (*bytes)(const bench_dist_t* dist); /*!< Input bytes processed by single call of `fn` */
+    uint8_t uses_dist;                         /*!< Set to `1` if results depend on distribution */
+} bench_case_t;
+
+/**
+ * \brief           Single benchmark result
+ */
+typedef struct {
+    char name[48];    /*!< Function name */
+    char dist[16];    /*!< Distribution name */
+    double ns_per_op; /*!< Nanoseconds per single value */
+    double gb_per_s;  /*!< Processed bytes throughput */
+} bench_result_t;
+
+static bench_dist_t dists[6];
+static uint8_t scratch[BENCH_COUNT * 10U];
+static uint32_t scratch_u32[BENCH_COUNT];
+static uint64_t scratch_u64[BENCH_COUNT];
+static char scratch_hex[BENCH_COUNT * 2U * 8U];
+static char scratch_dec[BENCH_COUNT * LWUTIL_DEC_U64_MAX_LEN];
+static int16_t adc_s16[BENCH_COUNT], scratch_s16[BENCH_COUNT];
+static float adc_f32[BENCH_COUNT], scratch_f32[BENCH_COUNT];
+static lwutil_map_t adc_map;
+static int32_t ntc_adc[2][17], ntc_temp[17]; /* Thermistor breakpoints, equally and unequally spaced */
+static lwutil_interp_seg_t ntc_segs[2][16];
+static lwutil_interp_t ntc_tbl[2];
+static uint32_t adc_u32[BENCH_COUNT];
+static uint8_t adc_packed[BENCH_COUNT * 12U / 8U]; /* ADC samples packed as 12-bit fields */
+static uint64_t slot_words[3][BENCH_COUNT];
+static lwutil_bitmap_t slots, slots_full, slots_tmp; /* Sparse, fully set and scratch slot occupancy bitmaps */
+static uint32_t ts_u32[BENCH_COUNT];     /* Timestamps with 1000 ms period and jitter */
+static uint8_t ts_col[BENCH_COUNT * 5U]; /* Timestamps encoded with column codec */
+static size_t ts_col_len;
+static uint8_t tlm_enc[BENCH_COUNT * LWUTIL_SCHEMA_MAX_LEN(BENCH_TLM_FIELDS)]; /* Encoded telemetry records */
+static uint8_t tlm_out[BENCH_COUNT * LWUTIL_SCHEMA_MAX_LEN(BENCH_TLM_FIELDS)];
+static size_t tlm_enc_len;
+static lwutil_ring_t frame_ring;
+static uint8_t frame_ring_data[4096];
+static int32_t adc_range[4] = {0, 4095, -1000, 1000}; /* Not constant, so that the macro is not folded */
+static volatile size_t sink; /* Keeps results alive, so that benchmark loops are not optimized out */
+static uint64_t rnd_state = 0x9E3779B97F4A7C15ULL;
+
+/**
+ * \brief           Get monotonic time
+ * \return          Time in nanoseconds
+ */
+static double
+prv_now_ns(void) {
+#if defined(_WIN32)
+    LARGE_INTEGER cnt, freq;
+    QueryPerformanceCounter(&cnt);
+    QueryPerformanceFrequency(&freq);
+    return (double)cnt.QuadPart * 1e9 / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+#endif /* defined(_WIN32) */
+}
+
+/**
+ * \brief           Get pseudo-random number, xorshift generator
+ * \return          Random `64-bit` number
+ */
+static uint64_t
+prv_rnd(void) {
+    rnd_state ^= rnd_state << 13U;
+    rnd_state ^= rnd_state >> 7U;
+    rnd_state ^= rnd_state << 17U;
+    return rnd_state;
+}
+
+/**
+ * \brief           Get random value that is encoded as varint with `len` bytes
+ * \param[in]       len: Varint length, `1` to `5`
+ * \return          Random value
+ */
+static uint32_t
+prv_rnd_varint_val(uint32_t len) {
+    uint32_t min = len > 1U ? (1UL << (7U * (len - 1U))) : 0;
+    uint32_t max = len < 5U ? ((1UL << (7U * len)) - 1U) : 0xFFFFFFFFU;
+
+    return min + (uint32_t)(prv_rnd() % ((uint64_t)max - min + 1U));
+}
+
+/**
+ * \brief           Prepare input data distributions
+ */
+static void
+prv_dists_init(void) {
+    static const char* names[] = {"len1", "len2", "len3", "len5", "uniform", "skewed"};
+
+    for (size_t d = 0; d < LWUTIL_ASZ(dists); ++d) {
+        bench_dist_t* dist = &dists[d];
+        lwutil_vstream_t vs;
+
+        dist->name = names[d];
+        for (size_t i = 0; i < BENCH_COUNT; ++i) {
+            uint32_t len, r;
+
+            switch (d) {
+                case 0: len = 1U; break;
+                case 1: len = 2U; break;
+                case 2: len = 3U; break;
+                case 3: len = 5U; break;
+                case 4: len = 1U + (uint32_t)(prv_rnd() % 5U); break;
+                default:
+                    /* Mostly small values, with rare large outliers */
+                    r = (uint32_t)(prv_rnd() % 100U);
+                    len = r < 90U ? 1U : r < 99U ? 2U : 5U;
+                    break;
+            }
+            dist->vals[i] = prv_rnd_varint_val(len);
+            dist->vals16[i] = (uint16_t)dist->vals[i];
+            dist->vals64[i] = ((uint64_t)dist->vals[i] << (7U * (len - 1U))) | dist->vals[i];
+        }
+        dist->enc_len = lwutil_st_u32_varint_array(dist->vals, BENCH_COUNT, dist->enc, sizeof(dist->enc));
+        lwutil_vstream_init(&vs, scratch, sizeof(scratch), dist->enc_index, LWUTIL_ASZ(dist->enc_index), BENCH_STRIDE);
+        lwutil_vstream_put_u32_array(&vs, dist->vals, BENCH_COUNT);
+        dist->col_len = lwutil_column_enc_u32(dist->vals, BENCH_COUNT, 0, dist->col, sizeof(dist->col));
+        dist->penc_len = lwutil_st_u32_pvarint_array(dist->vals, BENCH_COUNT, dist->penc, sizeof(dist->penc));
+        dist->enc64_len = 0;
+        for (size_t i = 0; i < BENCH_COUNT; ++i) {
+            dist->enc64_len += lwutil_st_u64_varint(dist->vals64[i], &dist->enc64[dist->enc64_len],
+                                                    sizeof(dist->enc64) - dist->enc64_len);
+        }
+        dist->dec_len = lwutil_u32_to_dec_array(dist->vals, BENCH_COUNT, dist->dec, sizeof(dist->dec) - 1U, ',');
+        dist->dec[dist->dec_len] = '\0';
+        dist->dec64_len = lwutil_u64_to_dec_array(dist->vals64, BENCH_COUNT, dist->dec64, sizeof(dist->dec64) - 1U, ',');
+        dist->dec64[dist->dec64_len] = '\0';
+    }
+}
+
+/* Byte count functions */
+static size_t
+prv_bytes_enc(const bench_dist_t* dist) {
+    return dist->enc_len;
+}
+
+static size_t
+prv_bytes_enc64(const bench_dist_t* dist) {
+    return dist->enc64_len;
+}
+
+static size_t
+prv_bytes_dec(const bench_dist_t* dist) {
+    return dist->dec_len;
+}
+
+static size_t
+prv_bytes_dec64(const bench_dist_t* dist) {
+    return dist->dec64_len;
+}
+
+static size_t
+prv_bytes_u8(const bench_dist_t* dist) {
+    LWUTIL_UNUSED(dist);
+    return BENCH_COUNT;
+}
+
+static size_t
+prv_bytes_u16(const bench_dist_t* dist) {
+    LWUTIL_UNUSED(dist);
+    return BENCH_COUNT * 2U;
+}
+
+static size_t
+prv_bytes_u32(const bench_dist_t* dist) {
+    LWUTIL_UNUSED(dist);
+    return BENCH_COUNT * 4U;
+}
+
+static size_t
+prv_bytes_u64(const bench_dist_t* dist) {
+    LWUTIL_UNUSED(dist);
+    return BENCH_COUNT * 8U;
+}
+
+static size_t
+prv_bytes_tlm(const bench_dist_t* dist) {
+    LWUTIL_UNUSED(dist);
+    return tlm_enc_len;
+}
+
+/* Load and store */
+static size_t
+prv_st_u16_le(const bench_dist_t* dist) {
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        lwutil_st_u16_le((uint16_t)dist->vals[i], &scratch[2U * i]);
+    }
+    return scratch[0];
+}
+
+static size_t
+prv_st_u32_be(const bench_dist_t* dist) {
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        lwutil_st_u32_be(dist->vals[i], &scratch[4U * i]);
+    }
+    return scratch[0];
+}
+
+static size_t
+prv_st_u64_be(const bench_dist_t* dist) {
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        lwutil_st_u64_be(dist->vals64[i], &scratch[8U * i]);
+    }
+    return scratch[0];
+}
+
+static size_t
+prv_ld_u32_le(const bench_dist_t* dist) {
+    size_t sum = 0;
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        sum += lwutil_ld_u32_le(&dist->enc[4U * i]);
+    }
+    return sum;
+}
+
+static size_t
+prv_ld_u32_be(const bench_dist_t* dist) {
+    size_t sum = 0;
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        sum += lwutil_ld_u32_be(&dist->enc[4U * i]);
+    }
+    return sum;
+}
+
+static size_t
+prv_ld_u64_be(const bench_dist_t* dist) {
+    size_t sum = 0;
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        sum += (size_t)lwutil_ld_u64_be(&dist->enc[8U * i]);
+    }
+    return sum;
+}
+
+static size_t
+prv_st_u16_be_array(const bench_dist_t* dist) {
+    lwutil_st_u16_be_array(dist->vals16, BENCH_COUNT, scratch);
+    return scratch[0];
+}
+
+static size_t
+prv_st_u32_be_array(const bench_dist_t* dist) {
+    lwutil_st_u32_be_array(dist->vals, BENCH_COUNT, scratch);
+    return scratch[0];
+}
+
+static size_t
+prv_st_u64_be_array(const bench_dist_t* dist) {
+    lwutil_st_u64_be_array(dist->vals64, BENCH_COUNT, scratch);
+    return scratch[0];
+}
+
+static size_t
+prv_ld_u32_be_array(const bench_dist_t* dist) {
+    lwutil_ld_u32_be_array(dist->enc, BENCH_COUNT, scratch_u32);
+    return scratch_u32[0];
+}
+
+static size_t
+prv_ld_u64_be_array(const bench_dist_t* dist) {
+    lwutil_ld_u64_be_array(dist->enc, BENCH_COUNT, scratch_u64);
+    return (size_t)scratch_u64[0];
+}
+
+/* Hex */
+static size_t
+prv_u8_to_2asciis(const bench_dist_t* dist) {
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        lwutil_u8_to_2asciis((uint8_t)dist->vals[i], &scratch_hex[2U * i]);
+    }
+    return (size_t)scratch_hex[0];
+}
+
+static size_t
+prv_u16_to_4asciis(const bench_dist_t* dist) {
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        lwutil_u16_to_4asciis((uint16_t)dist->vals[i], &scratch_hex[4U * i]);
+    }
+    return (size_t)scratch_hex[0];
+}
+
+static size_t
+prv_u32_to_8asciis(const bench_dist_t* dist) {
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        lwutil_u32_to_8asciis(dist->vals[i], &scratch_hex[8U * i]);
+    }
+    return (size_t)scratch_hex[0];
+}
+
+static size_t
+prv_u32_to_dec(const bench_dist_t* dist) {
+    size_t len = 0;
+
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        len += lwutil_u32_to_dec(dist->vals[i], &scratch_dec[len], 0);
+    }
+    return len;
+}
+
+static size_t
+prv_u32_to_dec_snprintf(const bench_dist_t* dist) {
+    size_t len = 0;
+
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        len += (size_t)snprintf(&scratch_dec[len], sizeof(scratch_dec) - len, "%lu", (unsigned long)dist->vals[i]);
+    }
+    return len;
+}
+
+static size_t
+prv_u64_to_dec(const bench_dist_t* dist) {
+    size_t len = 0;
+
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        len += lwutil_u64_to_dec(dist->vals64[i], &scratch_dec[len], 0);
+    }
+    return len;
+}
+
+static size_t
+prv_s32_to_dec_array(const bench_dist_t* dist) {
+    return lwutil_s32_to_dec_array((const int32_t*)dist->vals, BENCH_COUNT, scratch_hex, sizeof(scratch_hex), ',');
+}
+
+static size_t
+prv_parse_u32(const bench_dist_t* dist) {
+    const char* p = dist->dec;
+    const char* end = &dist->dec[dist->dec_len];
+    size_t sum = 0, n;
+    uint32_t val;
+
+    while ((n = lwutil_parse_u32(p, (size_t)(end - p), &val)) > 0) {
+        sum += val;
+        p += n + (p + n < end);
+    }
+    return sum;
+}
+
+static size_t
+prv_parse_u32_strtoul(const bench_dist_t* dist) {
+    const char* p = dist->dec;
+    const char* end = &dist->dec[dist->dec_len];
+    size_t sum = 0;
+
+    while (p < end) {
+        char* next;
+        sum += (size_t)strtoul(p, &next, 10);
+        p = next + 1;
+    }
+    return sum;
+}
+
+static size_t
+prv_parse_u64(const bench_dist_t* dist) {
+    const char* p = dist->dec64;
+    const char* end = &dist->dec64[dist->dec64_len];
+    size_t sum = 0, n;
+    uint64_t val;
+
+    while ((n = lwutil_parse_u64(p, (size_t)(end - p), &val)) > 0) {
+        sum += (size_t)val;
+        p += n + (p + n < end);
+    }
+    return sum;
+}
+
+static size_t
+prv_base64_encode(const bench_dist_t* dist) {
+    return lwutil_base64_encode(dist->enc, BENCH_COUNT * 4U, scratch_hex, LWUTIL_BASE64_STD, 1);
+}
+
+static size_t
+prv_base64_decode(const bench_dist_t* dist) {
+    static char b64[BENCH_COUNT * 4U / 3U * 4U + 4U];
+    static size_t len;
+
+    if (len == 0) {
+        len = lwutil_base64_encode(dist->enc, BENCH_COUNT * 4U, b64, LWUTIL_BASE64_URL, 0);
+    }
+    return lwutil_base64_decode(b64, len, scratch, LWUTIL_BASE64_URL, 0);
+}
+
+static size_t
+prv_hex_encode(const bench_dist_t* dist) {
+    return lwutil_hex_encode(dist->enc, BENCH_COUNT * 4U, scratch_hex, 0);
+}
+
+static size_t
+prv_hex_encode_upper(const bench_dist_t* dist) {
+    return lwutil_hex_encode(dist->enc, BENCH_COUNT * 4U, scratch_hex, 1);
+}
+
+static size_t
+prv_hex_decode(const bench_dist_t* dist) {
+    static char hex[BENCH_COUNT * 8U];
+    static uint8_t init;
+
+    if (!init) {
+        lwutil_hex_encode(dist->enc, BENCH_COUNT * 4U, hex, 0);
+        init = 1;
+    }
+    return lwutil_hex_decode(hex, sizeof(hex), scratch);
+}
+
+/* Variable length integers */
+static size_t
+prv_st_u32_varint(const bench_dist_t* dist) {
+    size_t pos = 0;
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        pos += lwutil_st_u32_varint(dist->vals[i], &scratch[pos], sizeof(scratch) - pos);
+    }
+    return pos;
+}
+
+static size_t
+prv_ld_u32_varint(const bench_dist_t* dist) {
+    size_t pos = 0, sum = 0;
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        uint32_t val = 0;
+        pos += lwutil_ld_u32_varint(&dist->enc[pos], dist->enc_len - pos, &val);
+        sum += val;
+    }
+    return sum + pos;
+}
+
+static size_t
+prv_st_u32_varint_array(const bench_dist_t* dist) {
+    return lwutil_st_u32_varint_array(dist->vals, BENCH_COUNT, scratch, sizeof(scratch));
+}
+
+static size_t
+prv_ld_u32_varint_array(const bench_dist_t* dist) {
+    return lwutil_ld_u32_varint_array(dist->enc, dist->enc_len, scratch_u32, BENCH_COUNT);
+}
+
+/* Random access into varint stream with sparse index */
+static size_t
+prv_vstream_get_u32(const bench_dist_t* dist) {
+    lwutil_vstream_t vs;
+    size_t sum = 0;
+
+    lwutil_vstream_init_const(&vs, dist->enc, dist->enc_len, dist->enc_index, BENCH_STRIDE, BENCH_COUNT);
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        uint32_t val = 0;
+
+        lwutil_vstream_get_u32(&vs, (i * 2654435761U) % BENCH_COUNT, &val);
+        sum += val;
+    }
+    return sum;
+}
+
+/* Column codec, frame of reference only */
+static size_t
+prv_column_enc_u32(const bench_dist_t* dist) {
+    return lwutil_column_enc_u32(dist->vals, BENCH_COUNT, 0, scratch, sizeof(scratch));
+}
+
+static size_t
+prv_column_dec_u32(const bench_dist_t* dist) {
+    return lwutil_column_dec_u32(dist->col, dist->col_len, scratch_u32, BENCH_COUNT);
+}
+
+/* Column codec, timestamps with delta and zigzag transforms */
+static size_t
+prv_column_enc_ts(const bench_dist_t* dist) {
+    LWUTIL_UNUSED(dist);
+    return lwutil_column_enc_u32(ts_u32, BENCH_COUNT, LWUTIL_COLUMN_DELTA | LWUTIL_COLUMN_ZIGZAG, scratch,
+                                 sizeof(scratch));
+}
+
+static size_t
+prv_column_dec_ts(const bench_dist_t* dist) {
+    LWUTIL_UNUSED(dist);
+    return lwutil_column_dec_u32(ts_col, ts_col_len, scratch_u32, BENCH_COUNT);
+}
+
+/* Telemetry records, generated schema functions against hand-written code */
+static size_t
+prv_schema_enc(const bench_dist_t* dist) {
+    bench_tlm_t tlm = {1, 0, 1700000000U, 0, 0, 0};
+    size_t pos = 0;
+
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        tlm.seq = (uint16_t)i;
+        tlm.v0 = tlm.v1 = tlm.count = dist->vals[i];
+        pos += bench_tlm_enc(&tlm, &tlm_out[pos], sizeof(tlm_out) - pos);
+    }
+    return pos;
+}
+
+static size_t
+prv_schema_enc_manual(const bench_dist_t* dist) {
+    bench_tlm_t tlm = {1, 0, 1700000000U, 0, 0, 0};
+    size_t pos = 0;
+
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        uint8_t* p = &tlm_out[pos];
+
+        tlm.seq = (uint16_t)i;
+        tlm.v0 = tlm.v1 = tlm.count = dist->vals[i];
+        if (sizeof(tlm_out) - pos < 20U) {
+            break;
+        }
+        p[0] = tlm.type;
+        lwutil_st_u16_be(tlm.seq, &p[1]);
+        lwutil_st_u32_le(tlm.ts, &p[3]);
+        lwutil_st_u32_le(tlm.v0, &p[7]);
+        lwutil_st_u32_le(tlm.v1, &p[11]);
+        pos += 15U + lwutil_st_u32_varint(tlm.count, &p[15], 5U);
+    }
+    return pos;
+}
+
+static size_t
+prv_schema_dec(const bench_dist_t* dist) {
+    bench_tlm_t tlm;
+    size_t pos = 0, sum = 0;
+
+    LWUTIL_UNUSED(dist);
+    memset(&tlm, 0x00, sizeof(tlm));
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        pos += bench_tlm_dec(&tlm_enc[pos], tlm_enc_len - pos, &tlm);
+        sum += tlm.seq + tlm.count;
+    }
+    return sum;
+}
+
+static size_t
+prv_st_u64_varint(const bench_dist_t* dist) {
+    size_t pos = 0;
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        pos += lwutil_st_u64_varint(dist->vals64[i], &scratch[pos], sizeof(scratch) - pos);
+    }
+    return pos;
+}
+
+static size_t
+prv_ld_u64_varint(const bench_dist_t* dist) {
+    size_t pos = 0, sum = 0;
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        uint64_t val = 0;
+        pos += lwutil_ld_u64_varint(&dist->enc64[pos], dist->enc64_len - pos, &val);
+        sum += (size_t)val;
+    }
+    return sum + pos;
+}
+
+static size_t
+prv_st_s64_varint(const bench_dist_t* dist) {
+    size_t pos = 0;
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        pos += lwutil_st_s64_varint((int64_t)dist->vals64[i], &scratch[pos], sizeof(scratch) - pos);
+    }
+    return pos;
+}
+
+static size_t
+prv_u32_varint_len(const bench_dist_t* dist) {
+    size_t sum = 0;
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        sum += lwutil_u32_varint_len(dist->vals[i]);
+    }
+    return sum;
+}
+
+/* Prefix varints, compared with continuation-bit varints */
+static size_t
+prv_st_u32_pvarint(const bench_dist_t* dist) {
+    size_t pos = 0;
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        pos += lwutil_st_u32_pvarint(dist->vals[i], &scratch[pos], sizeof(scratch) - pos);
+    }
+    return pos;
+}
+
+static size_t
+prv_ld_u32_pvarint(const bench_dist_t* dist) {
+    size_t pos = 0, sum = 0;
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        uint32_t val = 0;
+        pos += lwutil_ld_u32_pvarint(&dist->penc[pos], dist->penc_len - pos, &val);
+        sum += val;
+    }
+    return sum + pos;
+}
+
+static size_t
+prv_st_u32_pvarint_array(const bench_dist_t* dist) {
+    return lwutil_st_u32_pvarint_array(dist->vals, BENCH_COUNT, scratch, sizeof(scratch));
+}
+
+static size_t
+prv_ld_u32_pvarint_array(const bench_dist_t* dist) {
+    return lwutil_ld_u32_pvarint_array(dist->penc, dist->penc_len, scratch_u32, BENCH_COUNT);
+}
+
+/* Range mapping of 12-bit ADC samples, compared with the macro */
+static size_t
+prv_map_macro_s16(const bench_dist_t* dist) {
+    LWUTIL_UNUSED(dist);
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        scratch_s16[i] = (int16_t)LWUTIL_MAP(adc_s16[i], adc_range[0], adc_range[1], adc_range[2], adc_range[3]);
+    }
+    return (size_t)scratch_s16[BENCH_COUNT - 1U];
+}
+
+static size_t
+prv_map_s16_array(const bench_dist_t* dist) {
+    LWUTIL_UNUSED(dist);
+    lwutil_map_s16_array(&adc_map, adc_s16, scratch_s16, BENCH_COUNT, 1);
+    return (size_t)scratch_s16[BENCH_COUNT - 1U];
+}
+
+static size_t
+prv_map_s32_array(const bench_dist_t* dist) {
+    lwutil_map_s32_array(&adc_map, (const int32_t*)dist->vals, (int32_t*)scratch_u32, BENCH_COUNT, 1);
+    return (size_t)scratch_u32[BENCH_COUNT - 1U];
+}
+
+static size_t
+prv_map_f32_array(const bench_dist_t* dist) {
+    LWUTIL_UNUSED(dist);
+    lwutil_map_f32_array(&adc_map, adc_f32, scratch_f32, BENCH_COUNT, 1);
+    return (size_t)scratch_f32[BENCH_COUNT - 1U];
+}
+
+/* Thermistor linearization of 12-bit ADC samples, compared with linear search and the macro */
+static size_t
+prv_interp_macro_s16(const bench_dist_t* dist) {
+    LWUTIL_UNUSED(dist);
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        size_t s = 0;
+
+        for (; s < LWUTIL_ASZ(ntc_temp) - 2U && adc_s16[i] >= ntc_adc[1][s + 1U]; ++s) {}
+        scratch_s16[i] = (int16_t)LWUTIL_MAP(adc_s16[i], ntc_adc[1][s], ntc_adc[1][s + 1U], ntc_temp[s],
+                                             ntc_temp[s + 1U]);
+    }
+    return (size_t)scratch_s16[BENCH_COUNT - 1U];
+}
+
+static size_t
+prv_interp_s16_array(const bench_dist_t* dist) {
+    LWUTIL_UNUSED(dist);
+    lwutil_interp_s16_array(&ntc_tbl[0], adc_s16, scratch_s16, BENCH_COUNT, 1);
+    return (size_t)scratch_s16[BENCH_COUNT - 1U];
+}
+
+static size_t
+prv_interp_s16_array_search(const bench_dist_t* dist) {
+    LWUTIL_UNUSED(dist);
+    lwutil_interp_s16_array(&ntc_tbl[1], adc_s16, scratch_s16, BENCH_COUNT, 1);
+    return (size_t)scratch_s16[BENCH_COUNT - 1U];
+}
+
+/* Array kernels over sensor samples */
+static size_t
+prv_minmax_s16_array(const bench_dist_t* dist) {
+    int16_t mn, mx;
+    LWUTIL_UNUSED(dist);
+    lwutil_minmax_s16_array(adc_s16, BENCH_COUNT, &mn, &mx);
+    return (size_t)(mn + mx);
+}
+
+static size_t
+prv_minmax_f32_array(const bench_dist_t* dist) {
+    float mn, mx;
+    LWUTIL_UNUSED(dist);
+    lwutil_minmax_f32_array(adc_f32, BENCH_COUNT, &mn, &mx);
+    return (size_t)(mn + mx);
+}
+
+static size_t
+prv_clamp_s16_array(const bench_dist_t* dist) {
+    LWUTIL_UNUSED(dist);
+    lwutil_clamp_s16_array(adc_s16, scratch_s16, BENCH_COUNT, 100, 4000);
+    return (size_t)scratch_s16[BENCH_COUNT - 1U];
+}
+
+static size_t
+prv_abs_sat_s32_array(const bench_dist_t* dist) {
+    lwutil_abs_sat_s32_array((const int32_t*)dist->vals, (int32_t*)scratch_u32, BENCH_COUNT);
+    return (size_t)scratch_u32[BENCH_COUNT - 1U];
+}
+
+/* Bit-stream with 12-bit ADC samples */
+static size_t
+prv_bitwriter_put_bits(const bench_dist_t* dist) {
+    lwutil_bitwriter_t wr;
+
+    LWUTIL_UNUSED(dist);
+    lwutil_bitwriter_init(&wr, scratch, sizeof(scratch), LWUTIL_BITORDER_MSB_FIRST);
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        lwutil_bitwriter_put_bits(&wr, adc_u32[i], 12);
+    }
+    return lwutil_bitwriter_flush(&wr);
+}
+
+static size_t
+prv_bitreader_get_bits(const bench_dist_t* dist) {
+    lwutil_bitreader_t rd;
+    size_t sum = 0;
+
+    LWUTIL_UNUSED(dist);
+    lwutil_bitreader_init(&rd, adc_packed, sizeof(adc_packed), LWUTIL_BITORDER_MSB_FIRST);
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        sum += lwutil_bitreader_get_bits(&rd, 12);
+    }
+    return sum;
+}
+
+static size_t
+prv_bitreader_unpack(const bench_dist_t* dist) {
+    lwutil_bitreader_t rd;
+
+    LWUTIL_UNUSED(dist);
+    lwutil_bitreader_init(&rd, adc_packed, sizeof(adc_packed), LWUTIL_BITORDER_MSB_FIRST);
+    return lwutil_bitreader_unpack(&rd, scratch_u32, BENCH_COUNT, 12);
+}
+
+/* Checksum of 64-bit values, single operation processes 8 bytes */
+static size_t
+prv_crc16_ccitt(const bench_dist_t* dist) {
+    return lwutil_crc_calc(LWUTIL_CRC_16_CCITT, dist->vals64, sizeof(dist->vals64));
+}
+
+static size_t
+prv_crc32(const bench_dist_t* dist) {
+    return lwutil_crc_calc(LWUTIL_CRC_32, dist->vals64, sizeof(dist->vals64));
+}
+
+static size_t
+prv_crc32c(const bench_dist_t* dist) {
+    return lwutil_crc_calc(LWUTIL_CRC_32C, dist->vals64, sizeof(dist->vals64));
+}
+
+/* Checksum of 64-byte frames */
+static size_t
+prv_crc32c_frame64(const bench_dist_t* dist) {
+    size_t sum = 0;
+
+    for (size_t i = 0; i < BENCH_COUNT; i += 8U) {
+        sum += lwutil_crc_calc(LWUTIL_CRC_32C, &dist->vals64[i], 64U);
+    }
+    return sum;
+}
+
+/* Frames of 64 bytes, passed through the ring buffer in the same thread */
+static size_t
+prv_ring_frame64(const bench_dist_t* dist) {
+    lwutil_ring_rsv_t rsv;
+    const uint8_t* rec;
+    size_t sum = 0, len;
+
+    for (size_t i = 0; i < BENCH_COUNT; i += 8U) {
+        if (lwutil_ring_reserve(&frame_ring, 64U, &rsv)) {
+            memcpy(rsv.data, &dist->vals64[i], 64U);
+            lwutil_ring_commit(&frame_ring, &rsv, 64U);
+        }
+        if ((rec = lwutil_ring_peek(&frame_ring, &len)) != NULL) {
+            sum += rec[0] + len;
+            lwutil_ring_release(&frame_ring);
+        }
+    }
+    return sum;
+}
+
+/* Slot occupancy bitmaps, single operation processes one word */
+static size_t
+prv_bitmap_popcount(const bench_dist_t* dist) {
+    LWUTIL_UNUSED(dist);
+    return lwutil_bitmap_popcount(&slots);
+}
+
+static size_t
+prv_bitmap_find_first_zero(const bench_dist_t* dist) {
+    LWUTIL_UNUSED(dist);
+    return lwutil_bitmap_find_first_zero(&slots_full, 0);
+}
+
+static size_t
+prv_bitmap_and(const bench_dist_t* dist) {
+    LWUTIL_UNUSED(dist);
+    lwutil_bitmap_and(&slots_tmp, &slots, &slots_full);
+    return (size_t)slot_words[2][BENCH_COUNT - 1U];
+}
+
+static size_t
+prv_bitmap_iter_batch(const bench_dist_t* dist) {
+    lwutil_bitmap_iter_t it;
+    size_t idx[64], cnt, sum = 0;
+
+    LWUTIL_UNUSED(dist);
+    lwutil_bitmap_iter_init(&it, &slots, 0);
+    while ((cnt = lwutil_bitmap_iter_next_batch(&it, idx, LWUTIL_ASZ(idx))) > 0) {
+        sum += idx[cnt - 1U];
+    }
+    return sum;
+}
+
+static const bench_case_t cases[] = {
+    {"st_u16_le", prv_st_u16_le, prv_bytes_u16, 0},
+    {"st_u32_be", prv_st_u32_be, prv_bytes_u32, 0},
+    {"st_u64_be", prv_st_u64_be, prv_bytes_u64, 0},
+    {"ld_u32_le", prv_ld_u32_le, prv_bytes_u32, 0},
+    {"ld_u32_be", prv_ld_u32_be, prv_bytes_u32, 0},
+    {"ld_u64_be", prv_ld_u64_be, prv_bytes_u64, 0},
+    {"st_u16_be_array", prv_st_u16_be_array, prv_bytes_u16, 0},
+    {"st_u32_be_array", prv_st_u32_be_array, prv_bytes_u32, 0},
+    {"st_u64_be_array", prv_st_u64_be_array, prv_bytes_u64, 0},
+    {"ld_u32_be_array", prv_ld_u32_be_array, prv_bytes_u32, 0},
+    {"ld_u64_be_array", prv_ld_u64_be_array, prv_bytes_u64, 0},
+    {"u8_to_2asciis", prv_u8_to_2asciis, prv_bytes_u8, 0},
+    {"u16_to_4asciis", prv_u16_to_4asciis, prv_bytes_u16, 0},
+    {"u32_to_8asciis", prv_u32_to_8asciis, prv_bytes_u32, 0},
+    {"u32_to_dec", prv_u32_to_dec, prv_bytes_u32, 1},
+    {"u32_to_dec_snprintf", prv_u32_to_dec_snprintf, prv_bytes_u32, 1},
+    {"u64_to_dec", prv_u64_to_dec, prv_bytes_u64, 1},
+    {"s32_to_dec_array", prv_s32_to_dec_array, prv_bytes_u32, 1},
+    {"parse_u32", prv_parse_u32, prv_bytes_dec, 1},
+    {"parse_u32_strtoul", prv_parse_u32_strtoul, prv_bytes_dec, 1},
+    {"parse_u64", prv_parse_u64, prv_bytes_dec64, 1},
+    {"base64_encode", prv_base64_encode, prv_bytes_u32, 0},
+    {"base64_decode", prv_base64_decode, prv_bytes_u32, 0},
+    {"hex_encode", prv_hex_encode, prv_bytes_u32, 0},
+    {"hex_encode_upper", prv_hex_encode_upper, prv_bytes_u32, 0},
+    {"hex_decode", prv_hex_decode, prv_bytes_u32, 0},
+    {"st_u32_varint", prv_st_u32_varint, prv_bytes_enc, 1},
+    {"ld_u32_varint", prv_ld_u32_varint, prv_bytes_enc, 1},
+    {"st_u32_varint_array", prv_st_u32_varint_array, prv_bytes_enc, 1},
+    {"ld_u32_varint_array", prv_ld_u32_varint_array, prv_bytes_enc, 1},
+    {"vstream_get_u32", prv_vstream_get_u32, prv_bytes_u32, 1},
+    {"column_enc_u32", prv_column_enc_u32, prv_bytes_u32, 1},
+    {"column_dec_u32", prv_column_dec_u32, prv_bytes_u32, 1},
+    {"column_enc_ts", prv_column_enc_ts, prv_bytes_u32, 0},
+    {"column_dec_ts", prv_column_dec_ts, prv_bytes_u32, 0},
+    {"st_u64_varint", prv_st_u64_varint, prv_bytes_enc64, 1},
+    {"ld_u64_varint", prv_ld_u64_varint, prv_bytes_enc64, 1},
+    {"st_s64_varint", prv_st_s64_varint, prv_bytes_enc64, 1},
+    {"u32_varint_len", prv_u32_varint_len, prv_bytes_u32, 1},
+    {"st_u32_pvarint", prv_st_u32_pvarint, prv_bytes_enc, 1},
+    {"ld_u32_pvarint", prv_ld_u32_pvarint, prv_bytes_enc, 1},
+    {"st_u32_pvarint_array", prv_st_u32_pvarint_array, prv_bytes_enc, 1},
+    {"ld_u32_pvarint_array", prv_ld_u32_pvarint_array, prv_bytes_enc, 1},
+    {"map_macro_s16", prv_map_macro_s16, prv_bytes_u16, 0},
+    {"map_s16_array", prv_map_s16_array, prv_bytes_u16, 0},
+    {"map_s32_array", prv_map_s32_array, prv_bytes_u32, 0},
+    {"map_f32_array", prv_map_f32_array, prv_bytes_u32, 0},
+    {"interp_macro_s16", prv_interp_macro_s16, prv_bytes_u16, 0},
+    {"interp_s16_array", prv_interp_s16_array, prv_bytes_u16, 0},
+    {"interp_s16_array_search", prv_interp_s16_array_search, prv_bytes_u16, 0},
+    {"minmax_s16_array", prv_minmax_s16_array, prv_bytes_u16, 0},
+    {"minmax_f32_array", prv_minmax_f32_array, prv_bytes_u32, 0},
+    {"clamp_s16_array", prv_clamp_s16_array, prv_bytes_u16, 0},
+    {"abs_sat_s32_array", prv_abs_sat_s32_array, prv_bytes_u32, 0},
+    {"bitwriter_put_bits", prv_bitwriter_put_bits, prv_bytes_u16, 0},
+    {"bitreader_get_bits", prv_bitreader_get_bits, prv_bytes_u16, 0},
+    {"bitreader_unpack", prv_bitreader_unpack, prv_bytes_u16, 0},
+    {"crc16_ccitt", prv_crc16_ccitt, prv_bytes_u64, 0},
+    {"crc32", prv_crc32, prv_bytes_u64, 0},
+    {"crc32c", prv_crc32c, prv_bytes_u64, 0},
+    {"crc32c_frame64", prv_crc32c_frame64, prv_bytes_u64, 0},
+    {"ring_frame64", prv_ring_frame64, prv_bytes_u64, 0},
+    {"schema_enc", prv_schema_enc, prv_bytes_tlm, 1},
+    {"schema_enc_manual", prv_schema_enc_manual, prv_bytes_tlm, 1},
+    {"schema_dec", prv_schema_dec, prv_bytes_tlm, 0},
+    {"bitmap_popcount", prv_bitmap_popcount, prv_bytes_u64, 0},
+    {"bitmap_find_first_zero", prv_bitmap_find_first_zero, prv_bytes_u64, 0},
+    {"bitmap_and", prv_bitmap_and, prv_bytes_u64, 0},
+    {"bitmap_iter_batch", prv_bitmap_iter_batch, prv_bytes_u64, 0},
+};
+
+/**
+ * \brief           Measure single case with single distribution
+ * \param[in]       bc: Benchmark case
+ * \param[in]       dist: Input distribution
+ * \param[out]      res: Result to fill
+ */
+static void
+prv_run(const bench_case_t* bc, const bench_dist_t* dist, bench_result_t* res) {
+    double best = 0;
+    size_t iters = 1;
+
+    /* Calibrate number of iterations to run for at least minimum time */
+    for (;;) {
+        double start = prv_now_ns();
+        for (size_t i = 0; i < iters; ++i) {
+            sink = sink + bc->fn(dist);
+        }
+        if ((prv_now_ns() - start) >= BENCH_MIN_NS || iters >= (1UL << 24U)) {
+            break;
+        }
+        iters *= 2U;
+    }
+    for (size_t run = 0; run < BENCH_RUNS; ++run) {
+        double start = prv_now_ns(), elapsed;
+        for (size_t i = 0; i < iters; ++i) {
+            sink = sink + bc->fn(dist);
+        }
+        elapsed = (prv_now_ns() - start) / (double)iters;
+        if (run == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+    snprintf(res->name, sizeof(res->name), "%s", bc->name);
+    snprintf(res->dist, sizeof(res->dist), "%s", bc->uses_dist ? dist->name : "none");
+    res->ns_per_op = best / (double)BENCH_COUNT;
+    res->gb_per_s = (double)bc->bytes(dist) / best;
+}
+
+/**
+ * \brief           Load results from previously saved output
+ * \param[in]       file: File name
+ * \param[out]      res: Array to write results to
+ * \param[in]       res_size: Size of `res` array
+ * \return          Number of loaded results, `0` if file cannot be read or holds more than `res_size` results
+ */
+static size_t
+prv_load(const char* file, bench_result_t* res, size_t res_size) {
+    char line[256];
+    size_t cnt = 0;
+    FILE* f = fopen(file, "r");
+
+    if (f == NULL) {
+        return 0;
+    }
+    while (fgets(line, sizeof(line), f) != NULL) {
+        bench_result_t r;
+
+        if (sscanf(line, " {\"name\": \"%47[^\"]\", \"dist\": \"%15[^\"]\", \"ns_per_op\": %lf, \"gb_per_s\": %lf",
+                   r.name, r.dist, &r.ns_per_op, &r.gb_per_s)
+            == 4) {
+            if (cnt == res_size) {
+                fprintf(stderr, "Baseline holds more than %u results\r\n", (unsigned)res_size);
+                cnt = 0;
+                break;
+            }
+            res[cnt++] = r;
+        }
+    }
+    fclose(f);
+    return cnt;
+}
+
+int
+main(int argc, char** argv) {
+    /* Every case runs at most once per distribution */
+    static bench_result_t res[LWUTIL_ASZ(cases) * LWUTIL_ASZ(dists)], base[LWUTIL_ASZ(cases) * LWUTIL_ASZ(dists)];
+    const char *out_file = NULL, *cmp_file = NULL, *filter = NULL;
+    double threshold = 10.0;
+    size_t res_cnt = 0, base_cnt = 0, regressions = 0;
+    FILE* out = stdout;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--out") == 0 && (i + 1) < argc) {
+            out_file = argv[++i];
+        } else if (strcmp(argv[i], "--compare") == 0 && (i + 1) < argc) {
+            cmp_file = argv[++i];
+        } else if (strcmp(argv[i], "--threshold") == 0 && (i + 1) < argc) {
+            threshold = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--filter") == 0 && (i + 1) < argc) {
+            filter = argv[++i];
+        } else if (strcmp(argv[i], "--simd") == 0 && (i + 1) < argc) {
+            if (!lwutil_simd_set_level((lwutil_simd_t)atoi(argv[++i]))) {
+                fprintf(stderr, "SIMD level %s is not supported\r\n", argv[i]);
+                return 1;
+            }
+        } else {
+            fprintf(stderr,
+                    "Usage: %s [--out file] [--compare baseline] [--threshold percent] [--filter text] [--simd level]\r\n",
+                    argv[0]);
+            return 1;
+        }
+    }
+    if (cmp_file != NULL) {
+        base_cnt = prv_load(cmp_file, base, LWUTIL_ASZ(base));
+        if (base_cnt == 0) {
+            fprintf(stderr, "Cannot load baseline from %s\r\n", cmp_file);
+            return 1;
+        }
+    }
+
+    prv_dists_init();
+    lwutil_map_init(&adc_map, adc_range[0], adc_range[1], adc_range[2], adc_range[3]);
+    for (size_t i = 0; i < LWUTIL_ASZ(ntc_temp); ++i) {
+        ntc_adc[0][i] = (int32_t)(i * 256U);
+        ntc_adc[1][i] = (int32_t)(i * i * 16U);
+        ntc_temp[i] = 1500 - (int32_t)(i * i * 7U);
+    }
+    lwutil_interp_init(&ntc_tbl[0], ntc_segs[0], ntc_adc[0], ntc_temp, LWUTIL_ASZ(ntc_temp));
+    lwutil_interp_init(&ntc_tbl[1], ntc_segs[1], ntc_adc[1], ntc_temp, LWUTIL_ASZ(ntc_temp));
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        adc_s16[i] = (int16_t)(prv_rnd() & 0x0FFFU);
+        adc_f32[i] = (float)adc_s16[i];
+        adc_u32[i] = (uint32_t)adc_s16[i];
+    }
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        ts_u32[i] = 1700000000U + (uint32_t)i * 1000U + (uint32_t)(prv_rnd() % 8U);
+    }
+    ts_col_len = lwutil_column_enc_u32(ts_u32, BENCH_COUNT, LWUTIL_COLUMN_DELTA | LWUTIL_COLUMN_ZIGZAG, ts_col,
+                                       sizeof(ts_col));
+    for (size_t i = 0; i < BENCH_COUNT; ++i) {
+        bench_tlm_t tlm = {1, (uint16_t)i, 1700000000U + (uint32_t)i, (uint32_t)i, 0, (uint32_t)(prv_rnd() % 100000U)};
+
+        tlm_enc_len += bench_tlm_enc(&tlm, &tlm_enc[tlm_enc_len], sizeof(tlm_enc) - tlm_enc_len);
+    }
+    {
+        lwutil_bitwriter_t wr;
+
+        lwutil_bitwriter_init(&wr, adc_packed, sizeof(adc_packed), LWUTIL_BITORDER_MSB_FIRST);
+        lwutil_bitwriter_pack(&wr, adc_u32, BENCH_COUNT, 12);
+        lwutil_bitwriter_flush(&wr);
+    }
+    lwutil_bitmap_init(&slots, slot_words[0], BENCH_COUNT * 64U);
+    lwutil_bitmap_init(&slots_full, slot_words[1], BENCH_COUNT * 64U);
+    lwutil_bitmap_init(&slots_tmp, slot_words[2], BENCH_COUNT * 64U);
+    lwutil_ring_init(&frame_ring, frame_ring_data, sizeof(frame_ring_data), LWUTIL_RING_SPSC);
+    lwutil_bitmap_set_range(&slots_full, 0, BENCH_COUNT * 64U);
+    for (size_t i = 0; i < BENCH_COUNT * 64U; ++i) {
+        if ((prv_rnd() % 64U) == 0) {
+            lwutil_bitmap_set(&slots, i);
+        }
+    }
+    for (size_t c = 0; c < LWUTIL_ASZ(cases); ++c) {
+        if (filter != NULL && strstr(cases[c].name, filter) == NULL) {
+            continue;
+        }
+        for (size_t d = 0; d < (cases[c].uses_dist ? LWUTIL_ASZ(dists) : 1U); ++d) {
+            prv_run(&cases[c], &dists[cases[c].uses_dist ? d : 4U], &res[res_cnt++]);
+        }
+    }
+
+    if (out_file != NULL && (out = fopen(out_file, "w")) == NULL) {
+        fprintf(stderr, "Cannot open %s\r\n", out_file);
+        return 1;
+    }
+    fprintf(out, "{\n\"simd_level\": %d,\n\"results\": [\n", (int)lwutil_simd_get_level());
+    for (size_t i = 0; i < res_cnt; ++i) {
+        fprintf(out, "  {\"name\": \"%s\", \"dist\": \"%s\", \"ns_per_op\": %.3f, \"gb_per_s\": %.3f}%s\n", res[i].name,
+                res[i].dist, res[i].ns_per_op, res[i].gb_per_s, (i + 1U) < res_cnt ? "," : "");
+    }
+    fprintf(out, "]\n}\n");
+    if (out != stdout) {
+        fclose(out);
+    }
+
+    /* Compare against baseline */
+    for (size_t i = 0; i < res_cnt; ++i) {
+        for (size_t b = 0; b < base_cnt; ++b) {
+            if (strcmp(res[i].name, base[b].name) == 0 && strcmp(res[i].dist, base[b].dist) == 0) {
+                double change = (res[i].ns_per_op - base[b].ns_per_op) * 100.0 / base[b].ns_per_op;
+                if (change > threshold) {
+                    fprintf(stderr, "REGRESSION %s/%s: %.3f -> %.3f ns/op (+%.1f%%)\r\n", res[i].name, res[i].dist,
+                            base[b].ns_per_op, res[i].ns_per_op, change);
+                    ++regressions;
+                }
+                break;
+            }
+        }
+    }
+    if (cmp_file != NULL) {
+        fprintf(stderr, "%u regression(s) above %.1f%%\r\n", (unsigned)regressions, threshold);
+    }
+    return regressions > 0 ? 2 : 0;
+}
@@ -0,0 +1,48 @@
+/**
+ * \file            lwutil_opts.h
+ * \brief           LwUTIL application options
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwUTIL - Lightweight utility library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v1.3.0
+ */
+#ifndef LWUTIL_OPTS_HDR_H
+#define LWUTIL_OPTS_HDR_H
+
+/* Options for development build, see "include/lwutil/lwutil_opt.h" */
+
+/*
+ * Instrumentation is tested by the development build.
+ * Option is set for library and application alike, as it changes public declarations.
+ * Benchmark build overrides it with compile definition.
+ */
+#ifndef LWUTIL_CFG_STATS
+#define LWUTIL_CFG_STATS 1
+#endif /* LWUTIL_CFG_STATS */
+
+#endif /* LWUTIL_OPTS_HDR_H */
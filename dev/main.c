@@ -2,12 +2,87 @@
 #include <stdio.h>
 #include <string.h>
 #include "lwutil/lwutil.h"
+#include "lwutil/lwutil_array.h"
+#include "lwutil/lwutil_base64.h"
+#include "lwutil/lwutil_bitmap.h"
+#include "lwutil/lwutil_bitstream.h"
+#include "lwutil/lwutil_buf.h"
+#include "lwutil/lwutil_column.h"
+#include "lwutil/lwutil_crc.h"
+#include "lwutil/lwutil_interp.h"
+#include "lwutil/lwutil_map.h"
+#include "lwutil/lwutil_ring.h"
+#include "lwutil/lwutil_schema.h"
+#include "lwutil/lwutil_vstream.h"
+#if !defined(__STDC_NO_THREADS__)
+#include <threads.h>
+#endif /* !defined(__STDC_NO_THREADS__) */
 
 #define TEST_IF_TRUE(condition)                                                                                        \
     if (!(condition)) {                                                                                                \
         printf("Condition %s failed on line %d\r\n", #condition, (int)__LINE__);                                       \
     }
 
+/* C++ interface tests, implemented in test_cpp.cpp */
+void test_cpp(void);
+
+/* Streaming varint decoder callback */
+static void
+prv_varint_dec_cb(uint64_t val, void* arg) {
+    uint64_t* sum = arg;
+    *sum += val;
+}
+
+/* Instrumentation trace callback, counts traced errors */
+static void
+prv_stats_trace_cb(lwutil_stats_fn_t fn, size_t bytes, uint8_t err, void* arg) {
+    size_t* cnt = arg;
+
+    LWUTIL_UNUSED(fn);
+    LWUTIL_UNUSED(bytes);
+    *cnt += err;
+}
+
+#if !defined(__STDC_NO_THREADS__)
+/* Ring buffer producer thread, writes records with producer ID and sequence number */
+#define TEST_RING_PRODUCERS 3U
+#define TEST_RING_RECORDS   2000U
+
+typedef struct {
+    lwutil_ring_t* ring;
+    uint8_t id;
+} test_ring_producer_t;
+
+static int
+prv_ring_producer(void* arg) {
+    test_ring_producer_t* prod = arg;
+    lwutil_ring_rsv_t rsv;
+
+    for (uint32_t seq = 0; seq < TEST_RING_RECORDS; ++seq) {
+        /* Some records are committed shorter than reserved, and leave padding */
+        while (!lwutil_ring_reserve(prod->ring, 5U + (seq % 4U), &rsv)) {
+            thrd_yield();
+        }
+        rsv.data[0] = prod->id;
+        lwutil_st_u32_le(seq, &rsv.data[1]);
+        lwutil_ring_commit(prod->ring, &rsv, 5U);
+    }
+    return 0;
+}
+#endif /* !defined(__STDC_NO_THREADS__) */
+
+/* Record with fixed-width and varint fields, for schema serializer */
+#define TEST_REC_FIELDS(X)                                                                                             \
+    X(U8, type)                                                                                                        \
+    X(U16_BE, seq)                                                                                                     \
+    X(U32_LE, ts)                                                                                                      \
+    X(S32_VARINT, offset)                                                                                              \
+    X(U64_BE, id)                                                                                                      \
+    X(U32_VARINT, count)
+
+LWUTIL_SCHEMA_STRUCT(test_rec_t, TEST_REC_FIELDS);
+LWUTIL_SCHEMA_FUNCS(test_rec, test_rec_t, TEST_REC_FIELDS);
+
 int
 main(void) {
     /* Test storing integer device */
@@ -46,6 +121,41 @@ main(void) {
         u32 = lwutil_ld_u32_be(arr);
         TEST_IF_TRUE(u32 == 0x12345678U);
     }
+    /* 64-bit and array load and store */
+    {
+        uint8_t arr[40];
+        uint16_t u16[5] = {0x0102U, 0x0304U, 0x0506U, 0x0708U, 0x090AU};
+        uint32_t u32[10];
+        uint64_t u64[5];
+
+        lwutil_st_u64_le(0x0102030405060708ULL, arr);
+        TEST_IF_TRUE(arr[0] == 0x08U && arr[7] == 0x01U && lwutil_ld_u64_le(arr) == 0x0102030405060708ULL);
+        lwutil_st_u64_be(0x0102030405060708ULL, arr);
+        TEST_IF_TRUE(arr[0] == 0x01U && arr[7] == 0x08U && lwutil_ld_u64_be(arr) == 0x0102030405060708ULL);
+
+        lwutil_st_u16_be_array(u16, LWUTIL_ASZ(u16), arr);
+        TEST_IF_TRUE(arr[0] == 0x01U && arr[1] == 0x02U && arr[8] == 0x09U && arr[9] == 0x0AU);
+        lwutil_st_u16_le_array(u16, LWUTIL_ASZ(u16), arr);
+        TEST_IF_TRUE(arr[0] == 0x02U && arr[1] == 0x01U && arr[8] == 0x0AU && arr[9] == 0x09U);
+
+        /* Long enough for vector path, compare with scalar functions */
+        for (size_t i = 0; i < LWUTIL_ASZ(u32); ++i) {
+            u32[i] = 0x01020304U * (uint32_t)(i + 1U);
+        }
+        lwutil_st_u32_be_array(u32, LWUTIL_ASZ(u32), arr);
+        TEST_IF_TRUE(lwutil_ld_u32_be(&arr[0]) == u32[0] && lwutil_ld_u32_be(&arr[36]) == u32[9]);
+        lwutil_ld_u32_le_array(arr, LWUTIL_ASZ(u32), u32);
+        TEST_IF_TRUE(u32[0] == 0x04030201U && u32[9] == lwutil_ld_u32_le(&arr[36]));
+
+        /* In-place conversion */
+        for (size_t i = 0; i < LWUTIL_ASZ(u64); ++i) {
+            u64[i] = 0x0102030405060708ULL + i;
+        }
+        lwutil_st_u64_be_array(u64, LWUTIL_ASZ(u64), u64);
+        TEST_IF_TRUE(lwutil_ld_u64_be(&u64[4]) == 0x010203040506070CULL);
+        lwutil_ld_u64_be_array(u64, LWUTIL_ASZ(u64), u64);
+        TEST_IF_TRUE(u64[0] == 0x0102030405060708ULL && u64[4] == 0x010203040506070CULL);
+    }
     /* Bit set/reset */
     {
         uint32_t val;
@@ -74,6 +184,134 @@ main(void) {
         lwutil_u8_to_2asciis(0x6U, (char*)arr);
         TEST_IF_TRUE(strcmp(arr, "06") == 0);
     }
+    /* Hex encode and decode */
+    {
+        uint8_t data[70], data_out[70];
+        char hex[2U * sizeof(data) + 1U];
+        size_t len;
+
+        for (size_t i = 0; i < sizeof(data); ++i) {
+            data[i] = (uint8_t)(i * 37U + 0xA5U);
+        }
+        len = lwutil_hex_encode(data, 3, hex, 0);
+        hex[len] = '\0';
+        TEST_IF_TRUE(len == 6 && strcmp(hex, "a5caef") == 0);
+        len = lwutil_hex_encode(data, 3, hex, 1);
+        hex[len] = '\0';
+        TEST_IF_TRUE(len == 6 && strcmp(hex, "A5CAEF") == 0);
+
+        /* Long input goes through the vector path, when available */
+        len = lwutil_hex_encode(data, sizeof(data), hex, 0);
+        TEST_IF_TRUE(len == 2U * sizeof(data) && memcmp(&hex[2U * 69U], "9e", 2) == 0);
+        hex[0] = 'A';
+        hex[1] = 'F';
+        len = lwutil_hex_decode(hex, 2U * sizeof(data), data_out);
+        TEST_IF_TRUE(len == sizeof(data) && data_out[0] == 0xAFU && memcmp(&data[1], &data_out[1], len - 1U) == 0);
+
+        /* Invalid input */
+        TEST_IF_TRUE(lwutil_hex_decode(hex, 2U * sizeof(data) - 1U, data_out) == 0);
+        hex[41] = 'g';
+        TEST_IF_TRUE(lwutil_hex_decode(hex, 2U * sizeof(data), data_out) == 0);
+        TEST_IF_TRUE(lwutil_hex_decode("0:", 2, data_out) == 0);
+        TEST_IF_TRUE(lwutil_hex_decode("@0", 2, data_out) == 0);
+    }
+    /* Test Base64 encode and decode */
+    {
+        static const uint8_t data[] = {0xFB, 0xFF, 0x00, 'a', 'b'};
+        uint8_t data_out[sizeof(data) + 64U];
+        uint8_t long_in[90U], long_out[sizeof(long_in)];
+        char b64[128];
+
+        TEST_IF_TRUE(lwutil_base64_encoded_len(5, 1) == 8 && lwutil_base64_encoded_len(5, 0) == 7);
+        TEST_IF_TRUE(lwutil_base64_encode(data, sizeof(data), b64, LWUTIL_BASE64_STD, 1) == 8);
+        TEST_IF_TRUE(memcmp(b64, "+/8AYWI=", 8) == 0);
+        TEST_IF_TRUE(lwutil_base64_decoded_len(b64, 8, 1) == sizeof(data));
+        TEST_IF_TRUE(lwutil_base64_decode(b64, 8, data_out, LWUTIL_BASE64_STD, 1) == sizeof(data));
+        TEST_IF_TRUE(memcmp(data, data_out, sizeof(data)) == 0);
+        TEST_IF_TRUE(lwutil_base64_encode(data, sizeof(data), b64, LWUTIL_BASE64_URL, 0) == 7);
+        TEST_IF_TRUE(memcmp(b64, "-_8AYWI", 7) == 0);
+        TEST_IF_TRUE(lwutil_base64_decode(b64, 7, data_out, LWUTIL_BASE64_URL, 0) == sizeof(data));
+        TEST_IF_TRUE(memcmp(data, data_out, sizeof(data)) == 0);
+
+        /* Strict validation */
+        TEST_IF_TRUE(lwutil_base64_decode("-_8AYWI", 7, data_out, LWUTIL_BASE64_STD, 0) == 0);
+        TEST_IF_TRUE(lwutil_base64_decode("+/8AYWI=", 8, data_out, LWUTIL_BASE64_STD, 0) == 0);
+        TEST_IF_TRUE(lwutil_base64_decode("+/8AYWI", 7, data_out, LWUTIL_BASE64_STD, 1) == 0);
+        TEST_IF_TRUE(lwutil_base64_decode("+/8AYWJ=", 8, data_out, LWUTIL_BASE64_STD, 1) == 0);
+        TEST_IF_TRUE(lwutil_base64_decode("YQ==", 4, data_out, LWUTIL_BASE64_STD, 1) == 1 && data_out[0] == 'a');
+        TEST_IF_TRUE(lwutil_base64_decode("YR==", 4, data_out, LWUTIL_BASE64_STD, 1) == 0);
+        TEST_IF_TRUE(lwutil_base64_decode("Y===", 4, data_out, LWUTIL_BASE64_STD, 1) == 0);
+        TEST_IF_TRUE(lwutil_base64_decode("YWJj\n", 5, data_out, LWUTIL_BASE64_STD, 0) == 0);
+
+        /* Long input, processed in blocks by SIMD kernels */
+        for (size_t i = 0; i < sizeof(long_in); ++i) {
+            long_in[i] = (uint8_t)(i * 37U);
+        }
+        TEST_IF_TRUE(lwutil_base64_encode(long_in, sizeof(long_in), b64, LWUTIL_BASE64_STD, 1) == 120);
+        TEST_IF_TRUE(lwutil_base64_decode(b64, 120, long_out, LWUTIL_BASE64_STD, 1) == sizeof(long_in));
+        TEST_IF_TRUE(memcmp(long_in, long_out, sizeof(long_in)) == 0);
+        b64[40] = '*';
+        TEST_IF_TRUE(lwutil_base64_decode(b64, 120, long_out, LWUTIL_BASE64_STD, 1) == 0);
+    }
+    /* Test decimal formatting */
+    {
+        char str[64];
+        uint32_t u32_vals[] = {0, 7, 100, 4294967295UL};
+        int64_t s64_vals[] = {-1, INT64_MIN, 42};
+
+        TEST_IF_TRUE(lwutil_u32_to_dec(0, str, 1) == 1 && strcmp(str, "0") == 0);
+        TEST_IF_TRUE(lwutil_u32_to_dec(4294967295UL, str, 1) == LWUTIL_DEC_U32_MAX_LEN && strcmp(str, "4294967295") == 0);
+        TEST_IF_TRUE(lwutil_s32_to_dec(INT32_MIN, str, 1) == LWUTIL_DEC_S32_MAX_LEN && strcmp(str, "-2147483648") == 0);
+        TEST_IF_TRUE(lwutil_u64_to_dec(UINT64_MAX, str, 1) == LWUTIL_DEC_U64_MAX_LEN
+                     && strcmp(str, "18446744073709551615") == 0);
+        TEST_IF_TRUE(lwutil_s64_to_dec(INT64_MIN, str, 1) == LWUTIL_DEC_S64_MAX_LEN
+                     && strcmp(str, "-9223372036854775808") == 0);
+        str[4] = 'x';
+        TEST_IF_TRUE(lwutil_s64_to_dec(-100, str, 0) == 4 && memcmp(str, "-100x", 5) == 0);
+        TEST_IF_TRUE(lwutil_u32_dec_len(9) == 1 && lwutil_u32_dec_len(10) == 2 && lwutil_u64_dec_len(UINT64_MAX) == 20);
+
+        /* Fixed width */
+        TEST_IF_TRUE(lwutil_u32_to_dec_fixed(42, str, 5, 1) == 5 && strcmp(str, "00042") == 0);
+        TEST_IF_TRUE(lwutil_s32_to_dec_fixed(-42, str, 5, 1) == 5 && strcmp(str, "-0042") == 0);
+        TEST_IF_TRUE(lwutil_u64_to_dec_fixed(123456, str, 6, 1) == 6 && strcmp(str, "123456") == 0);
+        TEST_IF_TRUE(lwutil_u64_to_dec_fixed(123456, str, 5, 1) == 0);
+        TEST_IF_TRUE(lwutil_s64_to_dec_fixed(-1000, str, 4, 1) == 0);
+
+        /* Arrays */
+        TEST_IF_TRUE(lwutil_u32_to_dec_array(u32_vals, LWUTIL_ASZ(u32_vals), str, sizeof(str), ',') == 18);
+        TEST_IF_TRUE(memcmp(str, "0,7,100,4294967295", 18) == 0);
+        TEST_IF_TRUE(lwutil_u32_to_dec_array(u32_vals, LWUTIL_ASZ(u32_vals), str, 17, ',') == 0);
+        TEST_IF_TRUE(lwutil_s64_to_dec_array(s64_vals, LWUTIL_ASZ(s64_vals), str, sizeof(str), ';') == 26);
+        TEST_IF_TRUE(memcmp(str, "-1;-9223372036854775808;42", 26) == 0);
+    }
+    /* Test decimal parsing */
+    {
+        const char* csv = "4294967295,-2147483648,0007;";
+        const char* digits = "12345678901234567890123";
+        uint32_t u32;
+        int32_t s32;
+        uint64_t u64;
+        int64_t s64;
+
+        TEST_IF_TRUE(lwutil_parse_u32(csv, strlen(csv), &u32) == 10 && u32 == 4294967295UL);
+        TEST_IF_TRUE(lwutil_parse_s32(&csv[11], strlen(csv) - 11U, &s32) == 11 && s32 == INT32_MIN);
+        TEST_IF_TRUE(lwutil_parse_u32(&csv[23], strlen(csv) - 23U, &u32) == 4 && u32 == 7);
+        TEST_IF_TRUE(lwutil_parse_u32("4294967296", 10, &u32) == 0);
+        TEST_IF_TRUE(lwutil_parse_s32("2147483648", 10, &s32) == 0);
+        TEST_IF_TRUE(lwutil_parse_u32("-1", 2, &u32) == 0 && lwutil_parse_s32("-", 1, &s32) == 0);
+        TEST_IF_TRUE(lwutil_parse_u32("123", 2, &u32) == 2 && u32 == 12);
+        TEST_IF_TRUE(lwutil_parse_u32("", 0, &u32) == 0 && lwutil_parse_u32(" 1", 2, &u32) == 0);
+
+        /* Long runs, including leading zeros and exact overflow boundary */
+        TEST_IF_TRUE(lwutil_parse_u64(digits, 19, &u64) == 19 && u64 == 1234567890123456789ULL);
+        TEST_IF_TRUE(lwutil_parse_u64(digits, 20, &u64) == 20 && u64 == 12345678901234567890ULL);
+        TEST_IF_TRUE(lwutil_parse_u64(digits, strlen(digits), &u64) == 0);
+        TEST_IF_TRUE(lwutil_parse_u64("000000000000000000000018446744073709551615x", 43, &u64) == 42
+                     && u64 == UINT64_MAX);
+        TEST_IF_TRUE(lwutil_parse_u64("18446744073709551616", 20, &u64) == 0);
+        TEST_IF_TRUE(lwutil_parse_s64("-9223372036854775808", 20, &s64) == 20 && s64 == INT64_MIN);
+        TEST_IF_TRUE(lwutil_parse_s64("9223372036854775808", 19, &s64) == 0);
+    }
     /* Test variable integer */
     {
         uint8_t arr[10] = {0};
@@ -113,6 +351,210 @@ main(void) {
         len = lwutil_st_u32_varint(86942U, arr, 2);
         TEST_IF_TRUE(len == 0);
     }
+    /* Test 64-bit and signed variable integer */
+    {
+        uint8_t arr[12] = {0};
+        uint64_t val64;
+        int64_t s64;
+        int32_t s32;
+        size_t len;
+
+        /* Maximum value uses 10 bytes, with terminator after the fast 8-byte load */
+        len = lwutil_st_u64_varint(0xFFFFFFFFFFFFFFFFULL, arr, sizeof(arr));
+        TEST_IF_TRUE(len == 10 && arr[0] == 0xFFU && arr[8] == 0xFFU && arr[9] == 0x01U);
+        len = lwutil_ld_u64_varint(arr, sizeof(arr), &val64);
+        TEST_IF_TRUE(len == 10 && val64 == 0xFFFFFFFFFFFFFFFFULL);
+        len = lwutil_ld_u64_varint(arr, 9, &val64);
+        TEST_IF_TRUE(len == 0 && val64 == 0);
+        len = lwutil_st_u64_varint(0xFFFFFFFFFFFFFFFFULL, arr, 9);
+        TEST_IF_TRUE(len == 0);
+
+        /* Same value, on fast and on checked path */
+        len = lwutil_st_u64_varint(86942U, arr, sizeof(arr));
+        TEST_IF_TRUE(len == 3 && arr[0] == 0x9EU && arr[1] == 0xA7U && arr[2] == 0x05U);
+        len = lwutil_ld_u64_varint(arr, sizeof(arr), &val64);
+        TEST_IF_TRUE(len == 3 && val64 == 86942U);
+        len = lwutil_ld_u64_varint(arr, 3, &val64);
+        TEST_IF_TRUE(len == 3 && val64 == 86942U);
+
+        /* 32-bit varint longer than 5 bytes is an error */
+        memset(arr, 0x80, sizeof(arr));
+        len = lwutil_ld_u32_varint(arr, sizeof(arr), (uint32_t*)&s32);
+        TEST_IF_TRUE(len == 0 && s32 == 0);
+
+        /* Zigzag */
+        len = lwutil_st_s32_varint(-1, arr, sizeof(arr));
+        TEST_IF_TRUE(len == 1 && arr[0] == 0x01U);
+        len = lwutil_st_s32_varint(-65, arr, sizeof(arr));
+        TEST_IF_TRUE(len == 2 && arr[0] == 0x81U && arr[1] == 0x01U);
+        len = lwutil_ld_s32_varint(arr, sizeof(arr), &s32);
+        TEST_IF_TRUE(len == 2 && s32 == -65);
+        len = lwutil_st_s32_varint(INT32_MIN, arr, sizeof(arr));
+        TEST_IF_TRUE(len == 5);
+        len = lwutil_ld_s32_varint(arr, sizeof(arr), &s32);
+        TEST_IF_TRUE(len == 5 && s32 == INT32_MIN);
+        len = lwutil_st_s64_varint(INT64_MIN, arr, sizeof(arr));
+        TEST_IF_TRUE(len == 10);
+        len = lwutil_ld_s64_varint(arr, sizeof(arr), &s64);
+        TEST_IF_TRUE(len == 10 && s64 == INT64_MIN);
+        len = lwutil_st_s64_varint(INT64_MAX, arr, sizeof(arr));
+        len = lwutil_ld_s64_varint(arr, sizeof(arr), &s64);
+        TEST_IF_TRUE(len == 10 && s64 == INT64_MAX);
+
+        /* Length calculation */
+        TEST_IF_TRUE(lwutil_u32_varint_len(0) == 1 && lwutil_u32_varint_len(127U) == 1);
+        TEST_IF_TRUE(lwutil_u32_varint_len(128U) == 2 && lwutil_u32_varint_len(0xFFFFFFFFU) == 5);
+        TEST_IF_TRUE(lwutil_u64_varint_len(0x00FFFFFFFFFFFFFFULL) == 8);
+        TEST_IF_TRUE(lwutil_u64_varint_len(0x0100000000000000ULL) == 9);
+        TEST_IF_TRUE(lwutil_u64_varint_len(0x8000000000000000ULL) == 10);
+    }
+    /* Test variable integer arrays */
+    {
+        uint32_t vals[100], vals_out[100];
+        uint8_t arr[sizeof(vals) / sizeof(vals[0]) * 5U], arr_ref[sizeof(arr)];
+        size_t len, len_ref = 0;
+
+        /* Mix runs of single-byte values with longer ones */
+        for (size_t i = 0; i < LWUTIL_ASZ(vals); ++i) {
+            vals[i] = (i % 37U) == 36U ? (0xFFFFFFFFU >> (i % 5U)) : (i % 23U) == 22U ? 300U : (uint32_t)(i & 0x7FU);
+            len_ref += lwutil_st_u32_varint(vals[i], &arr_ref[len_ref], sizeof(arr_ref) - len_ref);
+        }
+
+        /* Output must be byte-identical to single-value function */
+        len = lwutil_st_u32_varint_array(vals, LWUTIL_ASZ(vals), arr, sizeof(arr));
+        TEST_IF_TRUE(len == len_ref && memcmp(arr, arr_ref, len) == 0);
+
+        len = lwutil_ld_u32_varint_array(arr, len_ref, vals_out, LWUTIL_ASZ(vals_out));
+        TEST_IF_TRUE(len == len_ref && memcmp(vals, vals_out, sizeof(vals)) == 0);
+
+        /* Test arrays too short */
+        len = lwutil_st_u32_varint_array(vals, LWUTIL_ASZ(vals), arr, len_ref - 1U);
+        TEST_IF_TRUE(len == 0);
+        len = lwutil_ld_u32_varint_array(arr, len_ref - 1U, vals_out, LWUTIL_ASZ(vals_out));
+        TEST_IF_TRUE(len == 0);
+    }
+    /* Prefix varint */
+    {
+        uint8_t arr[20] = {0};
+        uint64_t vals64[4] = {0, 0x7FU, 0x00FFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL}, vals64_out[4];
+        uint32_t val;
+        uint64_t val64;
+        size_t len;
+
+        /* 150 uses 2 bytes, length stored in trailing zero bits of the first byte */
+        len = lwutil_st_u32_pvarint(150U, arr, sizeof(arr));
+        TEST_IF_TRUE(len == 2 && arr[0] == 0x5AU && arr[1] == 0x02U);
+        len = lwutil_ld_u32_pvarint(arr, sizeof(arr), &val);
+        TEST_IF_TRUE(len == 2 && val == 150U);
+        len = lwutil_ld_u32_pvarint(arr, 1, &val);
+        TEST_IF_TRUE(len == 0 && val == 0);
+        len = lwutil_st_u32_pvarint(0xFFFFFFFFU, arr, sizeof(arr));
+        TEST_IF_TRUE(len == 5 && arr[0] == 0xF0U);
+        len = lwutil_ld_u32_pvarint(arr, 5, &val);
+        TEST_IF_TRUE(len == 5 && val == 0xFFFFFFFFU);
+        len = lwutil_st_u32_pvarint(0xFFFFFFFFU, arr, 4);
+        TEST_IF_TRUE(len == 0);
+
+        /* 64-bit uses 9 bytes at most */
+        len = lwutil_st_u64_pvarint(0xFFFFFFFFFFFFFFFFULL, arr, sizeof(arr));
+        TEST_IF_TRUE(len == 9 && arr[0] == 0x00U && lwutil_u64_pvarint_len(0xFFFFFFFFFFFFFFFFULL) == 9);
+        len = lwutil_ld_u64_pvarint(arr, 9, &val64);
+        TEST_IF_TRUE(len == 9 && val64 == 0xFFFFFFFFFFFFFFFFULL);
+        len = lwutil_ld_u32_pvarint(arr, sizeof(arr), &val);
+        TEST_IF_TRUE(len == 0);
+
+        len = lwutil_st_u64_pvarint_array(vals64, LWUTIL_ASZ(vals64), arr, sizeof(arr));
+        TEST_IF_TRUE(len == 1 + 1 + 8 + 9);
+        TEST_IF_TRUE(lwutil_ld_u64_pvarint_array(arr, len, vals64_out, LWUTIL_ASZ(vals64_out)) == len);
+        TEST_IF_TRUE(memcmp(vals64, vals64_out, sizeof(vals64)) == 0);
+        TEST_IF_TRUE(lwutil_ld_u64_pvarint_array(arr, len - 1U, vals64_out, LWUTIL_ASZ(vals64_out)) == 0);
+    }
+    /* Streaming varint decoder */
+    {
+        uint32_t vals[50], vals_out[50];
+        uint8_t arr[sizeof(vals) / sizeof(vals[0]) * 5U];
+        uint64_t sum = 0, sum_out = 0;
+        size_t len, pos = 0, cnt, cnt_total = 0;
+        lwutil_varint_dec_t dec;
+
+        for (size_t i = 0; i < LWUTIL_ASZ(vals); ++i) {
+            vals[i] = (uint32_t)(0x12345678U >> (i % 32U));
+            sum += vals[i];
+        }
+        len = lwutil_st_u32_varint_array(vals, LWUTIL_ASZ(vals), arr, sizeof(arr));
+
+        /* Feed data in chunks of different sizes, splitting values */
+        lwutil_varint_dec_init(&dec);
+        for (size_t chunk = 1; pos < len; chunk = (chunk % 7U) + 1U) {
+            size_t chunk_len = LWUTIL_MIN(chunk, len - pos);
+            TEST_IF_TRUE(lwutil_varint_dec_u32(&dec, &arr[pos], chunk_len, &vals_out[cnt_total],
+                                               LWUTIL_ASZ(vals_out) - cnt_total, &cnt)
+                         == chunk_len);
+            pos += chunk_len;
+            cnt_total += cnt;
+        }
+        TEST_IF_TRUE(cnt_total == LWUTIL_ASZ(vals) && memcmp(vals, vals_out, sizeof(vals)) == 0);
+        TEST_IF_TRUE(!lwutil_varint_dec_is_pending(&dec));
+
+        /* Output array full, remaining data must be fed again */
+        lwutil_varint_dec_init(&dec);
+        pos = lwutil_varint_dec_u32(&dec, arr, len, vals_out, 10, &cnt);
+        TEST_IF_TRUE(cnt == 10 && pos < len);
+
+        /* Callback */
+        lwutil_varint_dec_init(&dec);
+        TEST_IF_TRUE(lwutil_varint_dec_cb(&dec, arr, len - 1U, prv_varint_dec_cb, &sum_out) == len - 1U);
+        TEST_IF_TRUE(lwutil_varint_dec_is_pending(&dec) && sum_out < sum);
+        TEST_IF_TRUE(lwutil_varint_dec_cb(&dec, &arr[len - 1U], 1U, prv_varint_dec_cb, &sum_out) == 1U);
+        TEST_IF_TRUE(sum_out == sum);
+
+        /* Too long value */
+        memset(arr, 0x80, 6);
+        lwutil_varint_dec_init(&dec);
+        TEST_IF_TRUE(lwutil_varint_dec_u32(&dec, arr, 3, vals_out, 1, &cnt) == 3U && cnt == 0);
+        TEST_IF_TRUE(lwutil_varint_dec_u32(&dec, &arr[3], 3, vals_out, 1, &cnt) < 3U && dec.err);
+
+        /* Too long 64-bit value, split between chunks, is rejected at the 11th byte */
+        {
+            uint64_t val64;
+
+            memset(arr, 0x80, 12);
+            lwutil_varint_dec_init(&dec);
+            TEST_IF_TRUE(lwutil_varint_dec_u64(&dec, arr, 6, &val64, 1, &cnt) == 6U && cnt == 0);
+            TEST_IF_TRUE(lwutil_varint_dec_u64(&dec, &arr[6], 6, &val64, 1, &cnt) == 4U && cnt == 0 && dec.err);
+        }
+    }
+    /* Buffer reader and writer */
+    {
+        uint8_t arr[20];
+        lwutil_buf_t buf;
+
+        lwutil_buf_init(&buf, arr, sizeof(arr));
+        lwutil_buf_put_u8(&buf, 0x01U);
+        lwutil_buf_put_u16_be(&buf, 0x0203U);
+        lwutil_buf_put_u32_varint(&buf, 150U);
+        lwutil_buf_put_s32_varint(&buf, -1);
+        if (lwutil_buf_reserve(&buf, 12U)) {
+            lwutil_buf_put_u32_le_unchecked(&buf, 0x07060504U);
+            lwutil_buf_put_u64_be_unchecked(&buf, 0x08090A0B0C0D0E0FULL);
+        }
+        TEST_IF_TRUE(lwutil_buf_ok(&buf) && lwutil_buf_len(&buf) == 18U && lwutil_buf_remaining(&buf) == 2U);
+        TEST_IF_TRUE(arr[0] == 0x01U && arr[1] == 0x02U && arr[3] == 0x96U && arr[5] == 0x01U && arr[6] == 0x04U);
+
+        /* Error is sticky, even if following operation would fit */
+        TEST_IF_TRUE(lwutil_buf_put_u32_be(&buf, 0) == 0 && !lwutil_buf_ok(&buf));
+        TEST_IF_TRUE(lwutil_buf_put_u8(&buf, 0) == 0 && lwutil_buf_len(&buf) == 18U);
+
+        lwutil_buf_init_const(&buf, arr, 18U);
+        TEST_IF_TRUE(lwutil_buf_get_u8(&buf) == 0x01U);
+        TEST_IF_TRUE(lwutil_buf_get_u16_be(&buf) == 0x0203U);
+        TEST_IF_TRUE(lwutil_buf_get_u32_varint(&buf) == 150U);
+        TEST_IF_TRUE(lwutil_buf_get_s32_varint(&buf) == -1);
+        TEST_IF_TRUE(lwutil_buf_get_u32_le(&buf) == 0x07060504U);
+        TEST_IF_TRUE(lwutil_buf_get_u64_be(&buf) == 0x08090A0B0C0D0E0FULL);
+        TEST_IF_TRUE(lwutil_buf_ok(&buf) && lwutil_buf_remaining(&buf) == 0);
+        TEST_IF_TRUE(lwutil_buf_get_u8(&buf) == 0 && !lwutil_buf_ok(&buf));
+    }
     /* Test min max constrain */
     {
         uint32_t val;
@@ -153,6 +595,622 @@ main(void) {
         val = LWUTIL_MAP(10, 5, 15, 90, 50);
         TEST_IF_TRUE(val == 70);
     }
+    /* Test precomputed range mapper */
+    {
+        lwutil_map_t map;
+        int16_t samples[100], mapped[100], mapped_ref[100];
+        int32_t vals[4] = {-100, 0, 4095, 5000}, vals_out[4];
+        float fvals[4] = {-100.0f, 0.0f, 2048.0f, 4095.0f}, fvals_out[4];
+        uint8_t ok = 1;
+
+        TEST_IF_TRUE(!lwutil_map_init(&map, 10, 10, 0, 100));
+        TEST_IF_TRUE(!lwutil_map_init(&map, 0, 1, 0, 0x7FFFFFFF));
+
+        /* Results within 1 of the macro, exact for power of 2 ratio */
+        TEST_IF_TRUE(lwutil_map_init(&map, 0, 4095, 0, 3300));
+        for (int32_t x = -4096; x < 8192; ++x) {
+            int32_t diff = lwutil_map_s32(&map, x) - LWUTIL_MAP(x, 0, 4095, 0, 3300);
+            ok = ok && diff >= -1 && diff <= 1;
+        }
+        TEST_IF_TRUE(ok);
+        TEST_IF_TRUE(lwutil_map_init(&map, -512, 512, 1000, -3096));
+        for (int32_t x = -2048; x < 2048; ++x) {
+            ok = ok && lwutil_map_s32(&map, x) == LWUTIL_MAP(x, -512, 512, 1000, -3096);
+        }
+        TEST_IF_TRUE(ok);
+
+        /* Fused constrain */
+        TEST_IF_TRUE(lwutil_map_init(&map, 0, 4095, 1000, -1000));
+        lwutil_map_s32_array(&map, vals, vals_out, LWUTIL_ASZ(vals), 1);
+        TEST_IF_TRUE(vals_out[0] == 1000 && vals_out[1] == 1000 && vals_out[2] == -1000 && vals_out[3] == -1000);
+        lwutil_map_s32_array(&map, vals, vals_out, LWUTIL_ASZ(vals), 0);
+        TEST_IF_TRUE(vals_out[0] == LWUTIL_MAP(-100, 0, 4095, 1000, -1000) && vals_out[3] < -1000);
+        lwutil_map_f32_array(&map, fvals, fvals_out, LWUTIL_ASZ(fvals), 1);
+        TEST_IF_TRUE(fvals_out[0] == 1000.0f && fvals_out[3] == -1000.0f);
+        TEST_IF_TRUE(fvals_out[2] > -0.5f && fvals_out[2] < 0.0f);
+
+        /* Vector and scalar code produce identical results */
+        for (size_t i = 0; i < LWUTIL_ASZ(samples); ++i) {
+            samples[i] = (int16_t)(i * 673U);
+        }
+        TEST_IF_TRUE(lwutil_map_init(&map, -20000, 20000, 30000, -30000));
+        for (uint8_t constrain = 0; constrain < 2U; ++constrain) {
+            lwutil_simd_set_level(LWUTIL_SIMD_NONE);
+            lwutil_map_s16_array(&map, samples, mapped_ref, LWUTIL_ASZ(samples), constrain);
+            lwutil_simd_set_level(lwutil_simd_get_max_level());
+            lwutil_map_s16_array(&map, samples, mapped, LWUTIL_ASZ(samples), constrain);
+            TEST_IF_TRUE(memcmp(mapped, mapped_ref, sizeof(mapped)) == 0);
+        }
+        TEST_IF_TRUE(mapped[0] == 0 && mapped[1] == -1009);
+    }
+    /* Test array kernels */
+    {
+        int16_t s16[75], s16_out[75], s16_min, s16_max;
+        int32_t s32[75], s32_min, s32_max;
+        uint16_t u16_abs[75];
+        uint32_t u32_abs[75];
+        uint8_t u8[75], u8_min, u8_max;
+        float f32[75], f32_min, f32_max;
+
+        for (size_t i = 0; i < LWUTIL_ASZ(s16); ++i) {
+            s16[i] = (int16_t)((int32_t)(i * 997U % 2001U) - 1000);
+            s32[i] = (int32_t)s16[i] * 1000;
+            u8[i] = (uint8_t)(i * 37U);
+            f32[i] = (float)s16[i] / 4.0f;
+        }
+        s16[70] = INT16_MIN;
+        s32[3] = INT32_MIN;
+        f32[40] = 0.0f / 0.0f;
+
+        TEST_IF_TRUE(!lwutil_minmax_s16_array(s16, 0, &s16_min, &s16_max));
+        TEST_IF_TRUE(lwutil_minmax_s16_array(s16, LWUTIL_ASZ(s16), &s16_min, &s16_max));
+        TEST_IF_TRUE(s16_min == INT16_MIN && s16_max == 994);
+        TEST_IF_TRUE(lwutil_min_s32_array(s32, LWUTIL_ASZ(s32), &s32_min) && s32_min == INT32_MIN);
+        TEST_IF_TRUE(lwutil_max_s32_array(s32, LWUTIL_ASZ(s32), &s32_max) && s32_max == 994000);
+        TEST_IF_TRUE(lwutil_minmax_u8_array(u8, LWUTIL_ASZ(u8), &u8_min, &u8_max) && u8_min == 0 && u8_max == 249);
+        TEST_IF_TRUE(lwutil_minmax_f32_array(f32, LWUTIL_ASZ(f32), &f32_min, &f32_max));
+        TEST_IF_TRUE(f32_min == -250.0f && f32_max == 248.5f);
+
+        lwutil_clamp_s16_array(s16, s16_out, LWUTIL_ASZ(s16), -100, 100);
+        TEST_IF_TRUE(lwutil_minmax_s16_array(s16_out, LWUTIL_ASZ(s16_out), &s16_min, &s16_max));
+        TEST_IF_TRUE(s16_min == -100 && s16_max == 100 && s16_out[0] == -100 && s16_out[70] == -100);
+        lwutil_clamp_f32_array(f32, f32, LWUTIL_ASZ(f32), -10.0f, 10.0f);
+        TEST_IF_TRUE(f32[40] == -10.0f && f32[0] == -10.0f);
+
+        lwutil_abs_s16_array(s16, u16_abs, LWUTIL_ASZ(s16));
+        TEST_IF_TRUE(u16_abs[70] == 32768U && u16_abs[0] == 1000U);
+        lwutil_abs_sat_s16_array(s16, s16_out, LWUTIL_ASZ(s16));
+        TEST_IF_TRUE(s16_out[70] == INT16_MAX && s16_out[0] == 1000);
+        lwutil_abs_s32_array(s32, u32_abs, LWUTIL_ASZ(s32));
+        TEST_IF_TRUE(u32_abs[3] == 0x80000000UL && u32_abs[0] == 1000000UL);
+        lwutil_abs_sat_s32_array(s32, s32, LWUTIL_ASZ(s32));
+        TEST_IF_TRUE(s32[3] == INT32_MAX && s32[0] == 1000000);
+    }
+    /* Test bitmap */
+    {
+        uint64_t w1[LWUTIL_BITMAP_WORDS(2000)], w2[LWUTIL_BITMAP_WORDS(2000)], w3[LWUTIL_BITMAP_WORDS(2000)];
+        lwutil_bitmap_t bm1, bm2, bm3;
+        lwutil_bitmap_iter_t it;
+        size_t idx[8], idx_cnt, cnt;
+
+        TEST_IF_TRUE(lwutil_bitmap_init(&bm1, w1, 2000));
+        TEST_IF_TRUE(lwutil_bitmap_init(&bm2, w2, 2000));
+        TEST_IF_TRUE(lwutil_bitmap_init(&bm3, w3, 1999));
+        TEST_IF_TRUE(lwutil_bitmap_find_first_set(&bm1, 0) == LWUTIL_BITMAP_NONE);
+        TEST_IF_TRUE(lwutil_bitmap_find_first_zero(&bm1, 1999) == 1999);
+
+        lwutil_bitmap_set(&bm1, 1500);
+        lwutil_bitmap_set(&bm1, 2000);
+        TEST_IF_TRUE(lwutil_bitmap_is_set(&bm1, 1500) && !lwutil_bitmap_is_set(&bm1, 2000));
+        TEST_IF_TRUE(lwutil_bitmap_find_first_set(&bm1, 3) == 1500);
+        TEST_IF_TRUE(lwutil_bitmap_find_first_set(&bm1, 1501) == LWUTIL_BITMAP_NONE);
+        lwutil_bitmap_toggle(&bm1, 1500);
+        TEST_IF_TRUE(lwutil_bitmap_popcount(&bm1) == 0);
+
+        TEST_IF_TRUE(lwutil_bitmap_set_range(&bm1, 60, 1300));
+        TEST_IF_TRUE(!lwutil_bitmap_set_range(&bm1, 1990, 11));
+        TEST_IF_TRUE(lwutil_bitmap_popcount(&bm1) == 1300);
+        TEST_IF_TRUE(lwutil_bitmap_is_set_all_range(&bm1, 60, 1300) && !lwutil_bitmap_is_set_all_range(&bm1, 59, 2));
+        TEST_IF_TRUE(!lwutil_bitmap_is_set_any_range(&bm1, 0, 60) && lwutil_bitmap_is_set_any_range(&bm1, 1359, 641));
+        TEST_IF_TRUE(lwutil_bitmap_find_first_set(&bm1, 0) == 60 && lwutil_bitmap_find_first_zero(&bm1, 60) == 1360);
+        TEST_IF_TRUE(lwutil_bitmap_clear_range(&bm1, 100, 1000));
+        TEST_IF_TRUE(lwutil_bitmap_popcount(&bm1) == 300 && lwutil_bitmap_find_first_set(&bm1, 100) == 1100);
+        TEST_IF_TRUE(lwutil_bitmap_set_range(&bm1, 0, 2000) && lwutil_bitmap_find_first_zero(&bm1, 0) == LWUTIL_BITMAP_NONE);
+        TEST_IF_TRUE(lwutil_bitmap_clear_range(&bm1, 0, 2000) && lwutil_bitmap_set_range(&bm1, 60, 1300));
+        TEST_IF_TRUE(lwutil_bitmap_clear_range(&bm1, 100, 1000));
+
+        for (size_t i = 0; i < 2000; i += 3) {
+            lwutil_bitmap_set(&bm2, i);
+        }
+        TEST_IF_TRUE(!lwutil_bitmap_and(&bm3, &bm1, &bm2));
+        TEST_IF_TRUE(lwutil_bitmap_and(&bm2, &bm1, &bm2) && lwutil_bitmap_popcount(&bm2) == 101);
+        TEST_IF_TRUE(lwutil_bitmap_andnot(&bm1, &bm1, &bm2) && lwutil_bitmap_popcount(&bm1) == 199);
+        TEST_IF_TRUE(lwutil_bitmap_or(&bm1, &bm1, &bm2) && lwutil_bitmap_popcount(&bm1) == 300);
+        TEST_IF_TRUE(lwutil_bitmap_xor(&bm1, &bm1, &bm2) && lwutil_bitmap_popcount(&bm1) == 199);
+
+        cnt = 0;
+        lwutil_bitmap_iter_init(&it, &bm2, 0);
+        while (lwutil_bitmap_iter_next(&it, &idx[0])) {
+            TEST_IF_TRUE(idx[0] % 3U == 0 && lwutil_bitmap_is_set(&bm2, idx[0]));
+            ++cnt;
+        }
+        TEST_IF_TRUE(cnt == 101);
+        cnt = 0;
+        lwutil_bitmap_iter_init(&it, &bm1, 61);
+        while ((idx_cnt = lwutil_bitmap_iter_next_batch(&it, idx, LWUTIL_ASZ(idx))) > 0) {
+            TEST_IF_TRUE(idx[0] >= 61 && idx[0] % 3U != 0 && lwutil_bitmap_is_set(&bm1, idx[idx_cnt - 1U]));
+            cnt += idx_cnt;
+        }
+        TEST_IF_TRUE(cnt == 199);
+    }
+    /* Test bit-stream reader and writer */
+    {
+        uint8_t data[32];
+        uint32_t fields[20], fields_dec[20];
+        lwutil_bitwriter_t wr;
+        lwutil_bitreader_t rd;
+
+        /* 3-bit version, 11-bit length and 23-bit timestamp, followed by 1-bit flag */
+        TEST_IF_TRUE(lwutil_bitwriter_init(&wr, data, sizeof(data), LWUTIL_BITORDER_MSB_FIRST));
+        lwutil_bitwriter_put_bits(&wr, 0x05U, 3);
+        lwutil_bitwriter_put_bits(&wr, 0x7FFU, 11);
+        lwutil_bitwriter_put_bits(&wr, 0x123456U, 23);
+        lwutil_bitwriter_put_bits(&wr, 0xFFU, 1);
+        TEST_IF_TRUE(lwutil_bitwriter_bits(&wr) == 38);
+        TEST_IF_TRUE(lwutil_bitwriter_flush(&wr) == 5);
+        TEST_IF_TRUE(data[0] == 0xBFU && data[1] == 0xFCU && data[2] == 0x91U && data[3] == 0xA2U && data[4] == 0xB4U);
+
+        TEST_IF_TRUE(lwutil_bitreader_init(&rd, data, 5, LWUTIL_BITORDER_MSB_FIRST));
+        TEST_IF_TRUE(lwutil_bitreader_peek_bits(&rd, 3) == 0x05U && lwutil_bitreader_get_bits(&rd, 3) == 0x05U);
+        TEST_IF_TRUE(lwutil_bitreader_skip_bits(&rd, 11));
+        TEST_IF_TRUE(lwutil_bitreader_get_bits(&rd, 23) == 0x123456U && lwutil_bitreader_get_bits(&rd, 1) == 1U);
+        TEST_IF_TRUE(lwutil_bitreader_bits_left(&rd) == 2 && lwutil_bitreader_align(&rd));
+        TEST_IF_TRUE(lwutil_bitreader_ok(&rd) && lwutil_bitreader_get_bits(&rd, 1) == 0 && !lwutil_bitreader_ok(&rd));
+
+        TEST_IF_TRUE(lwutil_bitwriter_init(&wr, data, sizeof(data), LWUTIL_BITORDER_LSB_FIRST));
+        lwutil_bitwriter_put_bits(&wr, 0x05U, 3);
+        lwutil_bitwriter_put_bits64(&wr, 0x0123456789ABCDEFULL, 64);
+        TEST_IF_TRUE(lwutil_bitwriter_flush(&wr) == 9);
+        TEST_IF_TRUE(data[0] == 0x7DU && data[8] == 0x00U);
+        TEST_IF_TRUE(lwutil_bitreader_init(&rd, data, 9, LWUTIL_BITORDER_LSB_FIRST));
+        TEST_IF_TRUE(lwutil_bitreader_get_bits(&rd, 3) == 0x05U);
+        TEST_IF_TRUE(lwutil_bitreader_get_bits64(&rd, 64) == 0x0123456789ABCDEFULL);
+
+        for (size_t i = 0; i < LWUTIL_ASZ(fields); ++i) {
+            fields[i] = (uint32_t)(i * 0x9E3779B9UL) & 0x7FFU;
+        }
+        TEST_IF_TRUE(lwutil_bitwriter_init(&wr, data, sizeof(data), LWUTIL_BITORDER_MSB_FIRST));
+        TEST_IF_TRUE(lwutil_bitwriter_pack(&wr, fields, LWUTIL_ASZ(fields), 11));
+        TEST_IF_TRUE(lwutil_bitwriter_flush(&wr) == 28);
+        TEST_IF_TRUE(lwutil_bitreader_init(&rd, data, 28, LWUTIL_BITORDER_MSB_FIRST));
+        TEST_IF_TRUE(lwutil_bitreader_unpack(&rd, fields_dec, LWUTIL_ASZ(fields_dec), 11) == LWUTIL_ASZ(fields_dec));
+        TEST_IF_TRUE(memcmp(fields, fields_dec, sizeof(fields)) == 0);
+        TEST_IF_TRUE(lwutil_bitreader_unpack(&rd, fields_dec, 1, 11) == 0 && !lwutil_bitreader_ok(&rd));
+
+        TEST_IF_TRUE(lwutil_bitwriter_init(&wr, data, 2, LWUTIL_BITORDER_MSB_FIRST));
+        lwutil_bitwriter_put_bits(&wr, 0x1FFFFU, 17);
+        TEST_IF_TRUE(lwutil_bitwriter_flush(&wr) == 0 && !lwutil_bitwriter_ok(&wr));
+    }
+    /* Test CRC */
+    {
+        static const char check[] = "123456789";
+        uint8_t data[1000];
+        uint32_t crc_ref[3];
+        lwutil_crc_t crc;
+        lwutil_simd_t max_level = lwutil_simd_get_max_level();
+
+        TEST_IF_TRUE(lwutil_crc_calc(LWUTIL_CRC_16_CCITT, check, 9) == 0x29B1U);
+        TEST_IF_TRUE(lwutil_crc_calc(LWUTIL_CRC_32, check, 9) == 0xCBF43926UL);
+        TEST_IF_TRUE(lwutil_crc_calc(LWUTIL_CRC_32C, check, 9) == 0xE3069283UL);
+        TEST_IF_TRUE(lwutil_crc_init(&crc, LWUTIL_CRC_32));
+        TEST_IF_TRUE(lwutil_crc_update(&crc, check, 4) && lwutil_crc_update(&crc, &check[4], 5));
+        TEST_IF_TRUE(lwutil_crc_final(&crc) == 0xCBF43926UL);
+        TEST_IF_TRUE(!lwutil_crc_init(&crc, (lwutil_crc_type_t)3));
+
+        /* Checksums of chunks combined to checksum of whole data */
+        for (size_t i = 0; i < sizeof(data); ++i) {
+            data[i] = (uint8_t)(i * 31U + (i >> 3U));
+        }
+        for (size_t t = 0; t < LWUTIL_ASZ(crc_ref); ++t) {
+            lwutil_crc_type_t type = (lwutil_crc_type_t)t;
+
+            crc_ref[t] = lwutil_crc_calc(type, data, sizeof(data));
+            TEST_IF_TRUE(lwutil_crc_combine(type, lwutil_crc_calc(type, data, 333),
+                                            lwutil_crc_calc(type, &data[333], sizeof(data) - 333U),
+                                            sizeof(data) - 333U)
+                         == crc_ref[t]);
+        }
+
+        /* Accelerated kernels match table lookups */
+        for (int level = (int)LWUTIL_SIMD_NONE; level <= (int)max_level; ++level) {
+            TEST_IF_TRUE(lwutil_simd_set_level((lwutil_simd_t)level));
+            for (size_t t = 0; t < LWUTIL_ASZ(crc_ref); ++t) {
+                TEST_IF_TRUE(lwutil_crc_calc((lwutil_crc_type_t)t, data, sizeof(data)) == crc_ref[t]);
+            }
+        }
+        lwutil_simd_set_level(max_level);
+    }
+    /* Test record ring buffer */
+    {
+        uint8_t ring_data[64], out[64];
+        lwutil_ring_t ring;
+        lwutil_ring_rsv_t rsv;
+        const uint8_t* rec;
+        size_t len = 0;
+
+        TEST_IF_TRUE(!lwutil_ring_init(&ring, ring_data, 48, LWUTIL_RING_SPSC));
+        TEST_IF_TRUE(lwutil_ring_init(&ring, ring_data, sizeof(ring_data), LWUTIL_RING_SPSC));
+        TEST_IF_TRUE(lwutil_ring_peek(&ring, &len) == NULL);
+        TEST_IF_TRUE(!lwutil_ring_release(&ring));
+
+        /* Copy in and out, empty record is valid */
+        TEST_IF_TRUE(lwutil_ring_write(&ring, "abc", 3));
+        TEST_IF_TRUE(lwutil_ring_write(&ring, NULL, 0));
+        TEST_IF_TRUE(!lwutil_ring_read(&ring, out, 2, &len) && len == 3);
+        TEST_IF_TRUE(lwutil_ring_read(&ring, out, sizeof(out), &len) && len == 3 && memcmp(out, "abc", 3) == 0);
+        TEST_IF_TRUE(lwutil_ring_read(&ring, out, sizeof(out), &len) && len == 0);
+        TEST_IF_TRUE(!lwutil_ring_read(&ring, out, sizeof(out), &len));
+
+        /* Zero-copy, committed shorter than reserved, with 2-byte header */
+        TEST_IF_TRUE(lwutil_ring_reserve(&ring, 40, &rsv) && rsv.len == 40);
+        memcpy(rsv.data, "frame", 5);
+        TEST_IF_TRUE(!lwutil_ring_commit(&ring, &rsv, 41));
+        TEST_IF_TRUE(lwutil_ring_commit(&ring, &rsv, 5));
+        rec = lwutil_ring_peek(&ring, &len);
+        TEST_IF_TRUE(rec != NULL && len == 5 && memcmp(rec, "frame", 5) == 0);
+        TEST_IF_TRUE(lwutil_ring_peek(&ring, &len) == rec);
+        TEST_IF_TRUE(lwutil_ring_release(&ring) && !lwutil_ring_release(&ring));
+
+        /* Record does not fit before the end, it wraps to the beginning */
+        memset(out, 'a', sizeof(out));
+        TEST_IF_TRUE(lwutil_ring_write(&ring, out, 48));
+        TEST_IF_TRUE(!lwutil_ring_write(&ring, "012345678901", 12));
+        TEST_IF_TRUE(lwutil_ring_read(&ring, out, sizeof(out), &len) && len == 48);
+        TEST_IF_TRUE(lwutil_ring_write(&ring, "012345678901", 12));
+        rec = lwutil_ring_peek(&ring, &len);
+        TEST_IF_TRUE(rec == &ring_data[1] && len == 12 && memcmp(rec, "012345678901", 12) == 0);
+        TEST_IF_TRUE(lwutil_ring_release(&ring) && lwutil_ring_peek(&ring, &len) == NULL);
+        TEST_IF_TRUE(!lwutil_ring_reserve(&ring, 65, &rsv));
+
+        /* Multi-producer mode, reservations committed out of order */
+        {
+            lwutil_ring_rsv_t rsv2;
+
+            TEST_IF_TRUE(lwutil_ring_init(&ring, ring_data, sizeof(ring_data), LWUTIL_RING_MPSC));
+            TEST_IF_TRUE(lwutil_ring_reserve(&ring, 8, &rsv) && lwutil_ring_reserve(&ring, 8, &rsv2));
+            TEST_IF_TRUE(lwutil_ring_cancel(&ring, &rsv));
+            memcpy(rsv2.data, "xy", 2);
+            TEST_IF_TRUE(lwutil_ring_commit(&ring, &rsv2, 2));
+            TEST_IF_TRUE(lwutil_ring_reserve(&ring, 8, &rsv));
+            TEST_IF_TRUE(lwutil_ring_commit(&ring, &rsv, 1));
+            TEST_IF_TRUE(lwutil_ring_read(&ring, out, sizeof(out), &len) && len == 2 && memcmp(out, "xy", 2) == 0);
+            TEST_IF_TRUE(lwutil_ring_read(&ring, out, sizeof(out), &len) && len == 1);
+            TEST_IF_TRUE(!lwutil_ring_read(&ring, out, sizeof(out), &len));
+        }
+
+#if !defined(__STDC_NO_THREADS__)
+        /* Producer threads and consumer, records of every producer are received in order */
+        {
+            test_ring_producer_t prod[TEST_RING_PRODUCERS];
+            thrd_t thr[TEST_RING_PRODUCERS];
+            uint32_t next[TEST_RING_PRODUCERS] = {0}, total = 0, bad = 0;
+            uint8_t thr_ring_data[256];
+
+            TEST_IF_TRUE(lwutil_ring_init(&ring, thr_ring_data, sizeof(thr_ring_data), LWUTIL_RING_MPSC));
+            for (size_t i = 0; i < TEST_RING_PRODUCERS; ++i) {
+                prod[i].ring = &ring;
+                prod[i].id = (uint8_t)i;
+                TEST_IF_TRUE(thrd_create(&thr[i], prv_ring_producer, &prod[i]) == thrd_success);
+            }
+            while (total < TEST_RING_PRODUCERS * TEST_RING_RECORDS) {
+                rec = lwutil_ring_peek(&ring, &len);
+                if (rec == NULL) {
+                    thrd_yield();
+                    continue;
+                }
+                if (len != 5U || rec[0] >= TEST_RING_PRODUCERS || lwutil_ld_u32_le(&rec[1]) != next[rec[0]]) {
+                    ++bad;
+                } else {
+                    ++next[rec[0]];
+                }
+                ++total;
+                lwutil_ring_release(&ring);
+            }
+            for (size_t i = 0; i < TEST_RING_PRODUCERS; ++i) {
+                thrd_join(thr[i], NULL);
+                TEST_IF_TRUE(next[i] == TEST_RING_RECORDS);
+            }
+            TEST_IF_TRUE(bad == 0);
+            TEST_IF_TRUE(lwutil_ring_peek(&ring, &len) == NULL);
+        }
+#endif /* !defined(__STDC_NO_THREADS__) */
+    }
+    /* Test seekable varint stream */
+    {
+        uint32_t vals[100], vals_out[100], val, index[4];
+        uint8_t enc[500];
+        lwutil_vstream_t vs, vs_rd;
+        size_t offset;
+
+        for (size_t i = 0; i < LWUTIL_ASZ(vals); ++i) {
+            vals[i] = (i % 5U) == 0 ? (uint32_t)(i << 20U) : (uint32_t)i;
+        }
+        TEST_IF_TRUE(lwutil_vstream_index_len(100, 32) == 4 && lwutil_vstream_index_len(96, 32) == 3);
+        TEST_IF_TRUE(!lwutil_vstream_init(&vs, enc, sizeof(enc), index, LWUTIL_ASZ(index), 0));
+        TEST_IF_TRUE(lwutil_vstream_init(&vs, enc, sizeof(enc), index, LWUTIL_ASZ(index), 32));
+        TEST_IF_TRUE(lwutil_vstream_put_u32(&vs, vals[0]));
+        TEST_IF_TRUE(lwutil_vstream_put_u32_array(&vs, &vals[1], 99) == 99 && vs.count == 100);
+        TEST_IF_TRUE(vs.len == lwutil_st_u32_varint_array(vals, 100, enc + 250, 250));
+        TEST_IF_TRUE(memcmp(enc, enc + 250, vs.len) == 0);
+        TEST_IF_TRUE(lwutil_vstream_seek(&vs, 100, &offset) && offset == vs.len);
+        TEST_IF_TRUE(!lwutil_vstream_seek(&vs, 101, &offset));
+
+        /* Random access and block decoding from separate reader */
+        TEST_IF_TRUE(lwutil_vstream_init_const(&vs_rd, enc, vs.len, index, 32, 100));
+        for (size_t i = 0; i < LWUTIL_ASZ(vals); ++i) {
+            TEST_IF_TRUE(lwutil_vstream_get_u32(&vs_rd, i, &val) && val == vals[i]);
+        }
+        TEST_IF_TRUE(!lwutil_vstream_get_u32(&vs_rd, 100, &val));
+        for (size_t b = 0; b < 4U; ++b) {
+            TEST_IF_TRUE(lwutil_vstream_get_u32_array(&vs_rd, b * 32U, &vals_out[b * 32U], 32) == (b < 3U ? 32U : 4U));
+        }
+        TEST_IF_TRUE(memcmp(vals, vals_out, sizeof(vals)) == 0);
+        TEST_IF_TRUE(lwutil_vstream_get_u32_array(&vs_rd, 37, vals_out, 10) == 10 && vals_out[0] == vals[37]);
+
+        /* Index or data array full */
+        TEST_IF_TRUE(lwutil_vstream_init(&vs, enc, sizeof(enc), index, 1, 32));
+        TEST_IF_TRUE(lwutil_vstream_put_u32_array(&vs, vals, 100) == 32);
+        TEST_IF_TRUE(lwutil_vstream_init(&vs, enc, 20, index, LWUTIL_ASZ(index), 8));
+        TEST_IF_TRUE(lwutil_vstream_put_u32_array(&vs, vals, 100) == 14 && vs.len == 20);
+    }
+    /* Test integer column codec */
+    {
+        uint32_t vals[300], vals_dec[300];
+        uint64_t vals64[150], vals64_dec[150];
+        uint8_t enc[1600];
+        size_t len;
+
+        for (size_t i = 0; i < LWUTIL_ASZ(vals); ++i) {
+            vals[i] = (i % 7U) == 0 ? (uint32_t)(0xFFFFFFFFUL - i) : (uint32_t)(i * 13U);
+        }
+        TEST_IF_TRUE(lwutil_column_bound_u32(300) <= sizeof(enc));
+        for (uint8_t flags = 0; flags < 4U; ++flags) {
+            len = lwutil_column_enc_u32(vals, LWUTIL_ASZ(vals), flags, enc, sizeof(enc));
+            TEST_IF_TRUE(len > 0 && lwutil_column_count(enc, len) == 300);
+            memset(vals_dec, 0x00, sizeof(vals_dec));
+            TEST_IF_TRUE(lwutil_column_dec_u32(enc, len, vals_dec, LWUTIL_ASZ(vals_dec)) == 300);
+            TEST_IF_TRUE(memcmp(vals, vals_dec, sizeof(vals)) == 0);
+            TEST_IF_TRUE(lwutil_column_dec_u32(enc, len, vals_dec, 299) == 0);
+            TEST_IF_TRUE(lwutil_column_dec_u64(enc, len, vals64_dec, LWUTIL_ASZ(vals64_dec)) == 0);
+        }
+        TEST_IF_TRUE(lwutil_column_enc_u32(vals, LWUTIL_ASZ(vals), 0x04, enc, sizeof(enc)) == 0);
+        TEST_IF_TRUE(lwutil_column_enc_u32(vals, LWUTIL_ASZ(vals), 0, enc, 100) == 0);
+
+        /* Timestamps with constant interval need only block headers */
+        for (size_t i = 0; i < LWUTIL_ASZ(vals); ++i) {
+            vals[i] = (uint32_t)(1700000000UL + i * 60U);
+        }
+        len = lwutil_column_enc_u32(vals, LWUTIL_ASZ(vals), LWUTIL_COLUMN_DELTA, enc, sizeof(enc));
+        TEST_IF_TRUE(len == 3U * 12U);
+        TEST_IF_TRUE(lwutil_column_dec_u32(enc, len, vals_dec, LWUTIL_ASZ(vals_dec)) == 300);
+        TEST_IF_TRUE(memcmp(vals, vals_dec, sizeof(vals)) == 0);
+        TEST_IF_TRUE(lwutil_column_dec_u32(enc, len - 1U, vals_dec, LWUTIL_ASZ(vals_dec)) == 0);
+
+        /* Signed 64-bit values around zero */
+        for (size_t i = 0; i < LWUTIL_ASZ(vals64); ++i) {
+            vals64[i] = (uint64_t)((int64_t)(i * 1000003ULL) * ((i & 1U) ? -1 : 1)) << 20U;
+        }
+        len = lwutil_column_enc_u64(vals64, LWUTIL_ASZ(vals64), LWUTIL_COLUMN_ZIGZAG, enc, sizeof(enc));
+        TEST_IF_TRUE(len > 0 && lwutil_column_count(enc, len) == 150);
+        TEST_IF_TRUE(lwutil_column_dec_u64(enc, len, vals64_dec, LWUTIL_ASZ(vals64_dec)) == 150);
+        TEST_IF_TRUE(memcmp(vals64, vals64_dec, sizeof(vals64)) == 0);
+        TEST_IF_TRUE(lwutil_column_dec_u32(enc, len, vals_dec, LWUTIL_ASZ(vals_dec)) == 0);
+    }
+    /* Test schema serializer */
+    {
+        test_rec_t rec = {0x12U, 0x3456U, 0x789ABCDEUL, -300, 0x0102030405060708ULL, 1000U}, rec_dec;
+        uint8_t enc[LWUTIL_SCHEMA_MAX_LEN(TEST_REC_FIELDS)], enc_man[sizeof(enc)], short_enc[20];
+        size_t len, pos = 0;
+
+        TEST_IF_TRUE(sizeof(enc) == 1U + 2U + 4U + 5U + 8U + 5U);
+        TEST_IF_TRUE(test_rec_len(&rec) == 19U);
+
+        /* Same bytes as hand-written store sequence */
+        enc_man[pos++] = rec.type;
+        lwutil_st_u16_be(rec.seq, &enc_man[pos]);
+        pos += 2U;
+        lwutil_st_u32_le(rec.ts, &enc_man[pos]);
+        pos += 4U;
+        pos += lwutil_st_s32_varint(rec.offset, &enc_man[pos], sizeof(enc_man) - pos);
+        lwutil_st_u64_be(rec.id, &enc_man[pos]);
+        pos += 8U;
+        pos += lwutil_st_u32_varint(rec.count, &enc_man[pos], sizeof(enc_man) - pos);
+        len = test_rec_enc(&rec, enc, sizeof(enc));
+        TEST_IF_TRUE(len == 19U && pos == 19U && memcmp(enc, enc_man, len) == 0);
+
+        /* Short output array, exact fit and one byte less */
+        TEST_IF_TRUE(test_rec_enc(&rec, short_enc, 19U) == 19U && memcmp(short_enc, enc, 19U) == 0);
+        TEST_IF_TRUE(test_rec_enc(&rec, short_enc, 18U) == 0);
+        TEST_IF_TRUE(test_rec_enc_unchecked(&rec, enc_man) == 19U && memcmp(enc_man, enc, 19U) == 0);
+
+        /* Decoding from long and exact-length input, truncated and malformed input */
+        memset(&rec_dec, 0x00, sizeof(rec_dec));
+        TEST_IF_TRUE(test_rec_dec(enc, sizeof(enc), &rec_dec) == 19U);
+        TEST_IF_TRUE(rec_dec.type == rec.type && rec_dec.seq == rec.seq && rec_dec.ts == rec.ts
+                     && rec_dec.offset == rec.offset && rec_dec.id == rec.id && rec_dec.count == rec.count);
+        memset(&rec_dec, 0x00, sizeof(rec_dec));
+        TEST_IF_TRUE(test_rec_dec(enc, 19U, &rec_dec) == 19U && rec_dec.count == rec.count);
+        TEST_IF_TRUE(test_rec_dec(enc, 18U, &rec_dec) == 0);
+        TEST_IF_TRUE(test_rec_dec(enc, 5U, &rec_dec) == 0);
+        memset(&enc[7], 0xFF, 5U);
+        TEST_IF_TRUE(test_rec_dec(enc, sizeof(enc), &rec_dec) == 0);
+    }
+    /* Test instrumentation counters */
+    {
+        lwutil_stats_t st;
+        const uint8_t enc[] = {0x96U, 0x01U, 0x80U};
+        uint8_t arr[25], ring_data[16];
+        uint32_t val, vals[22];
+        char hex[6];
+        size_t traced = 0, cnt;
+        lwutil_varint_dec_t dec;
+        lwutil_ring_t ring;
+
+        lwutil_stats_reset();
+        lwutil_stats_set_trace(prv_stats_trace_cb, &traced);
+        TEST_IF_TRUE(lwutil_ld_u32_varint(enc, sizeof(enc), &val) == 2U && val == 150U);
+        TEST_IF_TRUE(lwutil_ld_u32_varint(enc, 1U, &val) == 0);
+        TEST_IF_TRUE(lwutil_ld_u32_varint(&enc[2], 1U, &val) == 0);
+        TEST_IF_TRUE(lwutil_hex_encode(enc, sizeof(enc), hex, 0) == 6U);
+        TEST_IF_TRUE(lwutil_hex_decode("0g", 2U, &val) == 0);
+        lwutil_stats_set_trace(NULL, NULL);
+
+        /* Array and streaming decoders feed varint length histogram, ring buffer headers do not */
+        memset(arr, 0x01U, 20U);
+        memcpy(&arr[20], "\x96\x01\x80\x80\x01", 5U);
+        TEST_IF_TRUE(lwutil_ld_u32_varint_array(arr, sizeof(arr), vals, LWUTIL_ASZ(vals)) == sizeof(arr));
+        lwutil_varint_dec_init(&dec);
+        TEST_IF_TRUE(lwutil_varint_dec_u32(&dec, arr, 23U, vals, LWUTIL_ASZ(vals), &cnt) == 23U && cnt == 21U);
+        TEST_IF_TRUE(lwutil_varint_dec_u32(&dec, &arr[23], 2U, vals, LWUTIL_ASZ(vals), &cnt) == 2U && cnt == 1U);
+        lwutil_u16_to_4asciis(0x1234U, hex);
+        TEST_IF_TRUE(lwutil_ring_init(&ring, ring_data, sizeof(ring_data), LWUTIL_RING_SPSC));
+        TEST_IF_TRUE(lwutil_ring_write(&ring, "abc", 3U) && lwutil_ring_peek(&ring, &cnt) != NULL && cnt == 3U);
+#if LWUTIL_CFG_STATS
+        TEST_IF_TRUE(lwutil_stats_snapshot(&st));
+        TEST_IF_TRUE(st.fn[LWUTIL_STATS_LD_U32_VARINT].calls == 3U && st.fn[LWUTIL_STATS_LD_U32_VARINT].errors == 2U
+                     && st.fn[LWUTIL_STATS_LD_U32_VARINT].bytes == 2U);
+        TEST_IF_TRUE(st.varint_len[0] == 40U && st.varint_len[1] == 3U && st.varint_len[2] == 2U);
+        TEST_IF_TRUE(st.fn[LWUTIL_STATS_LD_U32_VARINT_ARRAY].calls == 1U
+                     && st.fn[LWUTIL_STATS_LD_U32_VARINT_ARRAY].bytes == sizeof(arr));
+        TEST_IF_TRUE(st.fn[LWUTIL_STATS_U16_TO_4ASCIIS].calls == 1U && st.fn[LWUTIL_STATS_U16_TO_4ASCIIS].bytes == 2U);
+        TEST_IF_TRUE(st.fn[LWUTIL_STATS_HEX_ENCODE].calls == 1U && st.fn[LWUTIL_STATS_HEX_ENCODE].bytes == 3U);
+        TEST_IF_TRUE(st.fn[LWUTIL_STATS_HEX_DECODE].errors == 1U && st.fn[LWUTIL_STATS_CRC_UPDATE].calls == 0);
+        TEST_IF_TRUE(traced == 3U);
+        TEST_IF_TRUE(lwutil_stats_get_name(LWUTIL_STATS_HEX_DECODE) != NULL
+                     && strcmp(lwutil_stats_get_name(LWUTIL_STATS_HEX_DECODE), "hex_decode") == 0);
+        TEST_IF_TRUE(lwutil_stats_get_name(LWUTIL_STATS_FN_END) == NULL);
+        lwutil_stats_reset();
+        TEST_IF_TRUE(lwutil_stats_snapshot(&st) && st.fn[LWUTIL_STATS_LD_U32_VARINT].calls == 0);
+#else
+        TEST_IF_TRUE(!lwutil_stats_snapshot(&st) && traced == 0);
+#endif /* LWUTIL_CFG_STATS */
+    }
+    /* Test interpolation table */
+    {
+        static const int32_t xs_u[] = {0, 100, 200, 300};
+        static const int32_t ys_u[] = {0, 1000, 1500, 1600};
+        static const int32_t xs_n[] = {-1000, 0, 7, 1000, 40000};
+        static const int32_t ys_n[] = {5, 7, -3, 30000, -32768};
+        static const int32_t xs_bad[] = {0, 10, 10};
+        int16_t in16[6] = {-10, 0, 50, 150, 300, 400}, out16[6];
+        int32_t in32[3] = {-2000, 20000, 50000}, out32[3];
+        lwutil_interp_seg_t segs[4];
+        lwutil_interp_t it;
+
+        TEST_IF_TRUE(lwutil_interp_init(&it, segs, xs_u, ys_u, 1) == 0);
+        TEST_IF_TRUE(lwutil_interp_init(&it, segs, xs_bad, ys_u, 3) == 0);
+        TEST_IF_TRUE(lwutil_interp_init(&it, segs, xs_u, ys_u, 2) == 1 && it.step == 100U);
+
+        /* Equally spaced breakpoints, direct segment index */
+        TEST_IF_TRUE(lwutil_interp_init(&it, segs, xs_u, ys_u, LWUTIL_ASZ(xs_u)) == 1 && it.step == 100U);
+        TEST_IF_TRUE(lwutil_interp_s32(&it, 50) == 500 && lwutil_interp_s32(&it, 150) == 1250);
+        TEST_IF_TRUE(lwutil_interp_s32(&it, 199) == 1495 && lwutil_interp_s32(&it, 200) == 1500);
+        TEST_IF_TRUE(lwutil_interp_s32(&it, 300) == 1600 && lwutil_interp_s32(&it, 400) == 1700);
+        TEST_IF_TRUE(lwutil_interp_s32(&it, -10) == -100 && lwutil_interp_s32(&it, INT32_MIN) == INT32_MIN);
+        lwutil_interp_s16_array(&it, in16, out16, LWUTIL_ASZ(in16), 1);
+        TEST_IF_TRUE(out16[0] == 0 && out16[1] == 0 && out16[2] == 500 && out16[3] == 1250 && out16[4] == 1600
+                     && out16[5] == 1600);
+        lwutil_interp_s16_array(&it, in16, in16, LWUTIL_ASZ(in16), 0);
+        TEST_IF_TRUE(in16[0] == -100 && in16[5] == 1700);
+
+        /* Unequally spaced breakpoints, binary search */
+        TEST_IF_TRUE(lwutil_interp_init(&it, segs, xs_n, ys_n, LWUTIL_ASZ(xs_n)) == 1 && it.step == 0);
+        TEST_IF_TRUE(lwutil_interp_s32(&it, -1000) == 5 && lwutil_interp_s32(&it, 7) == -3);
+        TEST_IF_TRUE(lwutil_interp_s32(&it, -500) == 6 && lwutil_interp_s32(&it, 40000) == -32768);
+        lwutil_interp_s32_array(&it, in32, out32, LWUTIL_ASZ(in32), 1);
+        TEST_IF_TRUE(out32[0] == 5 && out32[2] == -32768);
+        lwutil_interp_s16_array(&it, (const int16_t[]){INT16_MAX}, out16, 1, 0);
+        TEST_IF_TRUE(out16[0] == (int16_t)lwutil_interp_s32(&it, INT16_MAX));
+
+        /* Every input differs from exact interpolation by less than 1 */
+        for (int32_t x = -1000; x <= 40000; x += 3) {
+            size_t i = 0;
+            int64_t dx, exact_num, y = lwutil_interp_s32(&it, x);
+
+            for (; x > xs_n[i + 1U]; ++i) {}
+            dx = (int64_t)xs_n[i + 1U] - xs_n[i];
+            exact_num = (int64_t)ys_n[i] * dx + ((int64_t)x - xs_n[i]) * ((int64_t)ys_n[i + 1U] - ys_n[i]);
+            TEST_IF_TRUE(LWUTIL_ABS(y * dx - exact_num) < dx);
+        }
+
+        /* Too steep segment */
+        TEST_IF_TRUE(lwutil_interp_init(&it, segs, (const int32_t[]){0, 1}, (const int32_t[]){0, 1 << 30}, 2) == 0);
+    }
+    /* Test SIMD levels produce identical output */
+    {
+        uint32_t vals[100], vals_dec[100], mix_ref[200], mix_dec[200], seed = 1;
+        uint8_t bytes[200], enc[500], enc_ref[500], mix[1000], bad[48];
+        char hex[400], hex_ref[400];
+        size_t enc_len, enc_ref_len = 0, mix_len = 0, mix_pos = 0;
+        lwutil_simd_t max_level = lwutil_simd_get_max_level();
+
+        TEST_IF_TRUE(lwutil_simd_get_level() == max_level);
+        TEST_IF_TRUE(!lwutil_simd_set_level((lwutil_simd_t)(max_level + 1)));
+        for (size_t i = 0; i < LWUTIL_ASZ(vals); ++i) {
+            vals[i] = (i % 37U) == 36U ? (uint32_t)(i * 1000U) : (uint32_t)i;
+        }
+        for (size_t i = 0; i < LWUTIL_ASZ(bytes); ++i) {
+            bytes[i] = (uint8_t)(i * 7U);
+        }
+
+        /* Pseudo-random lengths from `1` to `5` bytes, including non-minimal and truncated `5-byte` values */
+        for (size_t i = 0; i < LWUTIL_ASZ(mix_ref); ++i) {
+            size_t n;
+
+            seed = seed * 1103515245U + 12345U;
+            n = (seed >> 16U) % 8U;
+            n = n < 3U ? 1U : (n - 2U);
+            for (size_t k = 0; k < n; ++k) {
+                mix[mix_len++] = (uint8_t)(((seed >> (k * 5U)) & 0x7FU) | (k + 1U < n ? 0x80U : 0));
+            }
+        }
+        for (size_t i = 0; i < LWUTIL_ASZ(mix_ref); ++i) {
+            mix_pos += lwutil_ld_u32_varint(&mix[mix_pos], mix_len - mix_pos, &mix_ref[i]);
+        }
+        TEST_IF_TRUE(mix_pos == mix_len);
+
+        /* Value of `6` bytes inside a run of single-byte values */
+        memset(bad, 0x01, sizeof(bad));
+        memset(&bad[20], 0x80, 5U);
+        for (int level = (int)max_level; level >= (int)LWUTIL_SIMD_NONE; --level) {
+            TEST_IF_TRUE(lwutil_simd_set_level((lwutil_simd_t)level));
+            TEST_IF_TRUE(lwutil_simd_get_level() == (lwutil_simd_t)level);
+
+            enc_len = lwutil_st_u32_varint_array(vals, LWUTIL_ASZ(vals), enc, sizeof(enc));
+            TEST_IF_TRUE(lwutil_ld_u32_varint_array(enc, enc_len, vals_dec, LWUTIL_ASZ(vals)) == enc_len);
+            TEST_IF_TRUE(memcmp(vals, vals_dec, sizeof(vals)) == 0);
+            TEST_IF_TRUE(lwutil_ld_u32_varint_array(mix, mix_len, mix_dec, LWUTIL_ASZ(mix_dec)) == mix_len);
+            TEST_IF_TRUE(memcmp(mix_ref, mix_dec, sizeof(mix_ref)) == 0);
+            TEST_IF_TRUE(lwutil_ld_u32_varint_array(bad, sizeof(bad), mix_dec, 30U) == 0);
+            TEST_IF_TRUE(lwutil_hex_encode(bytes, sizeof(bytes), hex, 1) == sizeof(hex));
+            TEST_IF_TRUE(lwutil_hex_decode(hex, sizeof(hex), enc) == sizeof(bytes));
+            TEST_IF_TRUE(memcmp(enc, bytes, sizeof(bytes)) == 0);
+            lwutil_st_u32_be_array(vals, LWUTIL_ASZ(vals), vals_dec);
+            TEST_IF_TRUE(lwutil_ld_u32_be(&vals_dec[50]) == vals[50]);
+            if (level == (int)max_level) {
+                enc_ref_len = lwutil_st_u32_varint_array(vals, LWUTIL_ASZ(vals), enc_ref, sizeof(enc_ref));
+                memcpy(hex_ref, hex, sizeof(hex));
+            } else {
+                TEST_IF_TRUE(enc_len == enc_ref_len);
+                TEST_IF_TRUE(lwutil_st_u32_varint_array(vals, LWUTIL_ASZ(vals), enc, sizeof(enc)) == enc_ref_len
+                             && memcmp(enc, enc_ref, enc_ref_len) == 0);
+                TEST_IF_TRUE(memcmp(hex, hex_ref, sizeof(hex)) == 0);
+            }
+        }
+        lwutil_simd_set_level(max_level);
+    }
+    /* Test C++ interface */
+    test_cpp();
     printf("Done\r\n");
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,219 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "lwutil/lwutil.hpp"
+#include "lwutil/lwutil_schema.h"
+
+#define TEST_IF_TRUE(condition)                                                                                        \
+    if (!(condition)) {                                                                                                \
+        printf("Condition %s failed on line %d\r\n", #condition, (int)__LINE__);                                       \
+    }
+
+using lwutil::endian;
+
+/* Tables built at compile time */
+static constexpr auto test_magic = lwutil::to_bytes<endian::big>(UINT32_C(0xCAFEBABE));
+static constexpr auto test_key = lwutil::hex_array("00017f80FEff");
+static constexpr auto test_varint = lwutil::varint_array<300U>();
+static constexpr auto test_svarint = lwutil::varint_array<-65>();
+
+static_assert(test_magic[0] == 0xCA && test_magic[3] == 0xBE, "to_bytes");
+static_assert(lwutil::from_bytes<uint32_t, endian::little>(test_magic) == 0xBEBAFECAU, "from_bytes");
+static_assert(test_key.size() == 6 && test_key[2] == 0x7F && test_key[4] == 0xFE && test_key[5] == 0xFF, "hex_array");
+static_assert(test_varint.size() == 2 && test_varint[0] == 0xAC && test_varint[1] == 0x02, "varint_array");
+static_assert(test_svarint.size() == 2 && test_svarint[0] == 0x81 && test_svarint[1] == 0x01, "zigzag");
+static_assert(lwutil::varint_max_len<uint32_t> == 5 && lwutil::varint_max_len<uint64_t> == 10, "varint_max_len");
+static_assert(lwutil::varint_len(UINT64_MAX) == 10 && lwutil::varint_len(INT32_MIN) == 5, "varint_len");
+static_assert(lwutil::byteswap(static_cast<uint16_t>(0x1234)) == 0x3412U, "byteswap");
+static_assert(lwutil::byteswap(UINT64_C(0x0102030405060708)) == UINT64_C(0x0807060504030201), "byteswap");
+static_assert(lwutil::load<uint16_t, endian::big>(test_magic.data()) == 0xCAFEU, "load");
+static_assert(lwutil::load<int16_t, endian::little>(test_key.data() + 4) == -2, "load");
+static_assert((lwutil::min)(3, 4) == 3 && (lwutil::max)(3U, 4U) == 4U, "min/max");
+static_assert(lwutil::constrain(-5, 0, 10) == 0 && lwutil::constrain(15, 0, 10) == 10, "constrain");
+static_assert(lwutil::map(50, 0, 100, 0, 1000) == 500 && lwutil::map(0.5F, 0.0F, 1.0F, -1.0F, 1.0F) == 0.0F, "map");
+
+/* Decode varint at compile time and return the value */
+template <typename T, size_t N>
+static constexpr T
+prv_varint_value(const std::array<uint8_t, N>& bytes) {
+    T val{};
+    lwutil::load_varint(bytes.data(), bytes.size(), val);
+    return val;
+}
+
+static_assert(prv_varint_value<uint32_t>(test_varint) == 300U, "load_varint");
+static_assert(prv_varint_value<int32_t>(test_svarint) == -65, "load_varint");
+
+/* Same record as in main.c, with C functions and C++ schema of the same layout */
+#define TEST_REC_FIELDS(X)                                                                                             \
+    X(U8, type)                                                                                                        \
+    X(U16_BE, seq)                                                                                                     \
+    X(U32_LE, ts)                                                                                                      \
+    X(S32_VARINT, offset)                                                                                              \
+    X(U64_BE, id)                                                                                                      \
+    X(U32_VARINT, count)
+
+LWUTIL_SCHEMA_STRUCT(test_rec_t, TEST_REC_FIELDS);
+LWUTIL_SCHEMA_FUNCS(test_rec, test_rec_t, TEST_REC_FIELDS);
+
+using test_rec_schema = lwutil::schema<test_rec_t, lwutil::field<lwutil::codec::u8, &test_rec_t::type>,
+                                       lwutil::field<lwutil::codec::u16_be, &test_rec_t::seq>,
+                                       lwutil::field<lwutil::codec::u32_le, &test_rec_t::ts>,
+                                       lwutil::field<lwutil::codec::s32_varint, &test_rec_t::offset>,
+                                       lwutil::field<lwutil::codec::u64_be, &test_rec_t::id>,
+                                       lwutil::field<lwutil::codec::u32_varint, &test_rec_t::count>>;
+
+static_assert(test_rec_schema::max_len == LWUTIL_SCHEMA_MAX_LEN(TEST_REC_FIELDS), "schema max_len");
+
+/* Test C++ interface at run time, results must match C functions */
+extern "C" void
+test_cpp(void) {
+    /* Test load and store */
+    {
+        uint8_t arr[8], ref[8];
+
+        lwutil::store<uint32_t, endian::big>(0x12345678U, arr);
+        lwutil_st_u32_be(0x12345678U, ref);
+        TEST_IF_TRUE(memcmp(arr, ref, 4) == 0);
+        TEST_IF_TRUE((lwutil::load<uint32_t, endian::big>(arr) == 0x12345678U));
+        TEST_IF_TRUE((lwutil::load<uint16_t, endian::little>(arr) == 0x3412U));
+
+        lwutil::store<int64_t, endian::little>(-2, arr);
+        TEST_IF_TRUE(lwutil_ld_u64_le(arr) == UINT64_C(0xFFFFFFFFFFFFFFFE));
+        TEST_IF_TRUE((lwutil::load<int64_t, endian::little>(arr) == -2));
+    }
+
+    /* Test array functions */
+    {
+        uint32_t vals[37], out[37];
+        int16_t svals[5] = {-1, 2, -300, 400, -32768}, sout[5];
+        uint8_t buf[sizeof(vals)], ref[sizeof(vals)];
+
+        for (size_t i = 0; i < LWUTIL_ARRAYSIZE(vals); ++i) {
+            vals[i] = (uint32_t)(i * 0x01020304U);
+        }
+        lwutil::store_array<uint32_t, endian::big>(vals, LWUTIL_ARRAYSIZE(vals), buf);
+        lwutil_st_u32_be_array(vals, LWUTIL_ARRAYSIZE(vals), ref);
+        TEST_IF_TRUE(memcmp(buf, ref, sizeof(buf)) == 0);
+        lwutil::load_array<uint32_t, endian::big>(buf, LWUTIL_ARRAYSIZE(out), out);
+        TEST_IF_TRUE(memcmp(vals, out, sizeof(vals)) == 0);
+
+        lwutil::store_array<int16_t, endian::little>(svals, LWUTIL_ARRAYSIZE(svals), buf);
+        TEST_IF_TRUE(lwutil_ld_u16_le(&buf[4]) == (uint16_t)-300);
+        lwutil::load_array<int16_t, endian::little>(buf, LWUTIL_ARRAYSIZE(sout), sout);
+        TEST_IF_TRUE(memcmp(svals, sout, sizeof(svals)) == 0);
+
+#if defined(__cpp_lib_span)
+        std::vector<uint64_t> vec(3);
+        uint8_t b8[20] = {0};
+
+        b8[0] = 0x01;
+        b8[15] = 0x02;
+        TEST_IF_TRUE((lwutil::load<uint64_t, endian::little>(b8, vec) == 2));
+        TEST_IF_TRUE(vec[0] == 1 && vec[1] == UINT64_C(0x0200000000000000) && vec[2] == 0);
+        TEST_IF_TRUE((lwutil::store<uint64_t, endian::big>(vec, std::span<uint8_t>(b8, 12)) == 1));
+        TEST_IF_TRUE(b8[7] == 0x01 && b8[0] == 0x00);
+#endif /* defined(__cpp_lib_span) */
+    }
+
+    /* Test varint codec against C functions */
+    {
+        static const uint64_t u64_vals[] = {0, 1, 127, 128, 300, 16383, 16384, UINT32_MAX, UINT64_MAX};
+        static const int32_t s32_vals[] = {0, -1, 1, -64, 64, INT32_MIN, INT32_MAX};
+        uint8_t buf[10], ref[10];
+
+        for (size_t i = 0; i < LWUTIL_ARRAYSIZE(u64_vals); ++i) {
+            uint64_t v = u64_vals[i], out;
+            size_t len = lwutil::store_varint(v, buf, sizeof(buf));
+
+            TEST_IF_TRUE(len == lwutil_st_u64_varint(v, ref, sizeof(ref)) && memcmp(buf, ref, len) == 0);
+            TEST_IF_TRUE(len == lwutil::varint_len(v));
+            TEST_IF_TRUE(lwutil::load_varint(buf, len, out) == len && out == v);
+            TEST_IF_TRUE(lwutil::store_varint(v, buf, len - 1) == 0);
+            TEST_IF_TRUE(lwutil::load_varint(buf, len - 1, out) == 0 && out == 0);
+        }
+        for (size_t i = 0; i < LWUTIL_ARRAYSIZE(s32_vals); ++i) {
+            int32_t v = s32_vals[i], out;
+            size_t len = lwutil::store_varint(v, buf, sizeof(buf));
+
+            TEST_IF_TRUE(len == lwutil_st_s32_varint(v, ref, sizeof(ref)) && memcmp(buf, ref, len) == 0);
+            TEST_IF_TRUE(lwutil::load_varint(buf, len, out) == len && out == v);
+        }
+
+        /* 32-bit varint longer than 5 bytes is rejected */
+        memset(buf, 0x80, sizeof(buf));
+        buf[5] = 0x00;
+        {
+            uint32_t out;
+            TEST_IF_TRUE(lwutil::load_varint(buf, sizeof(buf), out) == 0);
+        }
+    }
+
+    /* Test hex codec */
+    {
+        static const uint8_t data[] = {0x00, 0x9A, 0xFF};
+        char hex[6];
+        uint8_t out[3];
+
+        TEST_IF_TRUE(lwutil::hex_encode(data, sizeof(data), hex) == 6 && memcmp(hex, "009aff", 6) == 0);
+        TEST_IF_TRUE(lwutil::hex_encode(data, sizeof(data), hex, true) == 6 && memcmp(hex, "009AFF", 6) == 0);
+        TEST_IF_TRUE(lwutil::hex_decode("009AfF", 6, out) == 3 && memcmp(out, data, 3) == 0);
+        TEST_IF_TRUE(lwutil::hex_decode("009", 3, out) == 0);
+        TEST_IF_TRUE(lwutil::hex_decode("0g", 2, out) == 0);
+    }
+
+    /* Test record schema against C functions, for every output and input length */
+    {
+        static const test_rec_t recs[] = {
+            {0, 0, 0, 0, 0, 0},
+            {0x12, 0x3456, 0x789ABCDEU, -300, UINT64_C(0x0102030405060708), 128},
+            {0xFF, 0xFFFF, UINT32_MAX, INT32_MIN, UINT64_MAX, UINT32_MAX},
+        };
+        uint8_t buf[test_rec_schema::max_len], ref[test_rec_schema::max_len];
+
+        for (size_t i = 0; i < LWUTIL_ARRAYSIZE(recs); ++i) {
+            size_t len = test_rec_schema::len(recs[i]);
+
+            TEST_IF_TRUE(len == test_rec_len(&recs[i]));
+            for (size_t out_size = 0; out_size <= sizeof(buf); ++out_size) {
+                memset(buf, 0xAA, sizeof(buf));
+                memset(ref, 0xAA, sizeof(ref));
+                TEST_IF_TRUE(test_rec_schema::enc(recs[i], buf, out_size) == test_rec_enc(&recs[i], ref, out_size));
+                TEST_IF_TRUE(memcmp(buf, ref, sizeof(buf)) == 0);
+            }
+            TEST_IF_TRUE(test_rec_schema::enc_unchecked(recs[i], buf) == len && memcmp(buf, ref, len) == 0);
+
+            /* Decode from every length, full record is decoded with and without bounds check */
+            for (size_t in_len = 0; in_len <= sizeof(buf); ++in_len) {
+                test_rec_t out, out_ref;
+                size_t cnt = test_rec_schema::dec(ref, in_len, out);
+
+                TEST_IF_TRUE(cnt == test_rec_dec(ref, in_len, &out_ref));
+                TEST_IF_TRUE(cnt == (in_len >= len ? len : 0));
+                if (cnt > 0) {
+                    TEST_IF_TRUE(out.type == recs[i].type && out.seq == recs[i].seq && out.ts == recs[i].ts
+                                 && out.offset == recs[i].offset && out.id == recs[i].id
+                                 && out.count == recs[i].count);
+                }
+            }
+        }
+
+        /* Malformed varint is rejected */
+        memset(buf, 0xFF, sizeof(buf));
+        {
+            test_rec_t out, out_ref;
+
+            TEST_IF_TRUE(test_rec_schema::dec(buf, sizeof(buf), out) == 0);
+            TEST_IF_TRUE(test_rec_dec(buf, sizeof(buf), &out_ref) == 0);
+        }
+    }
+
+    /* Test single evaluation */
+    {
+        int a = 1, b = 5;
+
+        TEST_IF_TRUE((lwutil::max)(a++, b) == 5 && a == 2);
+        TEST_IF_TRUE(lwutil::constrain(b++, 0, 3) == 3 && b == 6);
+    }
+}
@@ -6,16 +6,30 @@
 #
 # Before this file is included to the root CMakeLists file (using include() function), user can set some variables:
 #
+# LWUTIL_OPTS_FILE: If defined, it is the path to the user options file. If not defined, one will be generated for you automatically
 # LWUTIL_COMPILE_OPTIONS: If defined, it provide compiler options for generated library.
 # LWUTIL_COMPILE_DEFINITIONS: If defined, it provides "-D" definitions to the library build
+# LWUTIL_BUILD_STATIC: If set to ON, library is built as static library with interprocedural optimization, when supported
 #
 
+option(LWUTIL_BUILD_STATIC "Build lwutil as static library with interprocedural optimization" OFF)
+
 # Custom include directory
 set(LWUTIL_CUSTOM_INC_DIR ${CMAKE_CURRENT_BINARY_DIR}/lib_inc)
 
 # Library core sources
 set(lwutil_core_SRCS 
     ${CMAKE_CURRENT_LIST_DIR}/src/lwutil/lwutil.c
+    ${CMAKE_CURRENT_LIST_DIR}/src/lwutil/lwutil_array.c
+    ${CMAKE_CURRENT_LIST_DIR}/src/lwutil/lwutil_base64.c
+    ${CMAKE_CURRENT_LIST_DIR}/src/lwutil/lwutil_bitmap.c
+    ${CMAKE_CURRENT_LIST_DIR}/src/lwutil/lwutil_bitstream.c
+    ${CMAKE_CURRENT_LIST_DIR}/src/lwutil/lwutil_column.c
+    ${CMAKE_CURRENT_LIST_DIR}/src/lwutil/lwutil_crc.c
+    ${CMAKE_CURRENT_LIST_DIR}/src/lwutil/lwutil_interp.c
+    ${CMAKE_CURRENT_LIST_DIR}/src/lwutil/lwutil_map.c
+    ${CMAKE_CURRENT_LIST_DIR}/src/lwutil/lwutil_ring.c
+    ${CMAKE_CURRENT_LIST_DIR}/src/lwutil/lwutil_vstream.c
 )
 
 # Setup include directories
@@ -25,8 +39,36 @@ set(lwutil_include_DIRS
 )
 
 # Register library to the system
-add_library(lwutil INTERFACE)
-target_sources(lwutil INTERFACE ${lwutil_core_SRCS})
-target_include_directories(lwutil INTERFACE ${lwutil_include_DIRS})
-target_compile_options(lwutil PRIVATE ${LWUTIL_COMPILE_OPTIONS})
-target_compile_definitions(lwutil PRIVATE ${LWUTIL_COMPILE_DEFINITIONS})
+if(LWUTIL_BUILD_STATIC)
+    add_library(lwutil STATIC ${lwutil_core_SRCS})
+    target_include_directories(lwutil PUBLIC ${lwutil_include_DIRS})
+    target_compile_options(lwutil PRIVATE ${LWUTIL_COMPILE_OPTIONS})
+
+    # Definitions configure public headers too, application must see the same values
+    target_compile_definitions(lwutil PUBLIC ${LWUTIL_COMPILE_DEFINITIONS})
+
+    include(CheckIPOSupported)
+    check_ipo_supported(RESULT lwutil_ipo_supported OUTPUT lwutil_ipo_output LANGUAGES C)
+    if(lwutil_ipo_supported)
+        set_property(TARGET lwutil PROPERTY INTERPROCEDURAL_OPTIMIZATION ON)
+    else()
+        message(WARNING "lwutil: interprocedural optimization is not supported: ${lwutil_ipo_output}")
+    endif()
+else()
+    add_library(lwutil INTERFACE)
+    target_sources(lwutil INTERFACE ${lwutil_core_SRCS})
+    target_include_directories(lwutil INTERFACE ${lwutil_include_DIRS})
+
+    # Sources are compiled by the linking target, options must be propagated to it
+    target_compile_options(lwutil INTERFACE ${LWUTIL_COMPILE_OPTIONS})
+    target_compile_definitions(lwutil INTERFACE ${LWUTIL_COMPILE_DEFINITIONS})
+endif()
+
+# Create config file if user didn't provide one info himself
+if(NOT LWUTIL_OPTS_FILE)
+    message(STATUS "Using default lwutil_opts.h file")
+    set(LWUTIL_OPTS_FILE ${CMAKE_CURRENT_LIST_DIR}/src/include/lwutil/lwutil_opts_template.h)
+else()
+    message(STATUS "Using custom lwutil_opts.h file from ${LWUTIL_OPTS_FILE}")
+endif()
+configure_file(${LWUTIL_OPTS_FILE} ${LWUTIL_CUSTOM_INC_DIR}/lwutil_opts.h COPYONLY)
@@ -36,6 +36,7 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include "lwutil/lwutil_opt.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -47,6 +48,28 @@ extern "C" {
  * \{
  */
 
+/**
+ * \brief           Force inline function attribute
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define LWUTIL_FORCE_INLINE inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define LWUTIL_FORCE_INLINE __forceinline
+#else
+#define LWUTIL_FORCE_INLINE inline
+#endif
+
+/**
+ * \brief           Storage class of the library functions.
+ *                  Functions are static and force-inlined in header-only mode
+ * \sa              LWUTIL_CFG_HEADER_ONLY
+ */
+#if LWUTIL_CFG_HEADER_ONLY
+#define LWUTIL_API static LWUTIL_FORCE_INLINE
+#else
+#define LWUTIL_API
+#endif
+
 /**
  * \brief           Get size of statically allocated array
  * Array must be declared in a form of `type var_name[element_count]`
@@ -235,6 +258,107 @@ extern "C" {
  */
 #define lwutil_bits_toggle(val, bit_mask)     ((val) ^ (bit_mask))
 
+/**
+ * \brief           Maximum number of decimal ASCII characters of `unsigned 32-bit` value, without NULL termination
+ */
+#define LWUTIL_DEC_U32_MAX_LEN 10U
+
+/**
+ * \brief           Maximum number of decimal ASCII characters of `signed 32-bit` value, without NULL termination
+ */
+#define LWUTIL_DEC_S32_MAX_LEN 11U
+
+/**
+ * \brief           Maximum number of decimal ASCII characters of `unsigned 64-bit` value, without NULL termination
+ */
+#define LWUTIL_DEC_U64_MAX_LEN 20U
+
+/**
+ * \brief           Maximum number of decimal ASCII characters of `signed 64-bit` value, without NULL termination
+ */
+#define LWUTIL_DEC_S64_MAX_LEN 20U
+
+/**
+ * \brief           SIMD instruction set level, used by the accelerated functions
+ */
+typedef enum {
+    LWUTIL_SIMD_NONE = 0,  /*!< Scalar code only */
+    LWUTIL_SIMD_SSSE3 = 1, /*!< SSSE3 kernels */
+    LWUTIL_SIMD_SSE41 = 2, /*!< SSE4.1 and SSSE3 kernels */
+    LWUTIL_SIMD_AVX2 = 3,  /*!< AVX2, SSE4.1 and SSSE3 kernels */
+} lwutil_simd_t;
+
+/**
+ * \brief           Instrumented functions, see \ref lwutil_stats_snapshot
+ *
+ * Signed varint functions are counted together with unsigned ones, that they call.
+ */
+typedef enum {
+    LWUTIL_STATS_LD_U32_VARINT = 0,   /*!< \ref lwutil_ld_u32_varint */
+    LWUTIL_STATS_LD_U64_VARINT,       /*!< \ref lwutil_ld_u64_varint */
+    LWUTIL_STATS_ST_U32_VARINT,       /*!< \ref lwutil_st_u32_varint */
+    LWUTIL_STATS_ST_U64_VARINT,       /*!< \ref lwutil_st_u64_varint */
+    LWUTIL_STATS_LD_U32_VARINT_ARRAY, /*!< \ref lwutil_ld_u32_varint_array */
+    LWUTIL_STATS_ST_U32_VARINT_ARRAY, /*!< \ref lwutil_st_u32_varint_array */
+    LWUTIL_STATS_HEX_ENCODE,          /*!< \ref lwutil_hex_encode */
+    LWUTIL_STATS_HEX_DECODE,          /*!< \ref lwutil_hex_decode */
+    LWUTIL_STATS_U8_TO_2ASCIIS,       /*!< \ref lwutil_u8_to_2asciis */
+    LWUTIL_STATS_U16_TO_4ASCIIS,      /*!< \ref lwutil_u16_to_4asciis */
+    LWUTIL_STATS_U32_TO_8ASCIIS,      /*!< \ref lwutil_u32_to_8asciis */
+    LWUTIL_STATS_BASE64_ENCODE,       /*!< `lwutil_base64_encode` */
+    LWUTIL_STATS_BASE64_DECODE,       /*!< `lwutil_base64_decode` */
+    LWUTIL_STATS_CRC_UPDATE,          /*!< `lwutil_crc_update`, also used by `lwutil_crc_calc` */
+    LWUTIL_STATS_FN_END,              /*!< Number of instrumented functions */
+} lwutil_stats_fn_t;
+
+/**
+ * \brief           Maximal length of varint in units of bytes, size of varint length histogram
+ */
+#define LWUTIL_STATS_VARINT_LEN_MAX 10U
+
+/**
+ * \brief           Counters of single instrumented function
+ */
+typedef struct {
+    uint64_t calls;  /*!< Number of calls */
+    uint64_t bytes;  /*!< Number of binary bytes, encoded or decoded by successful calls */
+    uint64_t errors; /*!< Number of calls, that returned an error */
+} lwutil_stats_fn_cnt_t;
+
+/**
+ * \brief           Snapshot of instrumentation counters, summed over all threads
+ */
+typedef struct {
+    lwutil_stats_fn_cnt_t fn[LWUTIL_STATS_FN_END];    /*!< Counters, indexed by \ref lwutil_stats_fn_t */
+    uint64_t varint_len[LWUTIL_STATS_VARINT_LEN_MAX]; /*!< Decoded varints by length, index `0` for `1` byte.
+                                                           Single, array and streaming decoders are included */
+} lwutil_stats_t;
+
+/**
+ * \brief           Trace callback function, called after every instrumented call
+ * \param[in]       fn: Instrumented function
+ * \param[in]       bytes: Number of bytes, encoded or decoded by the call
+ * \param[in]       err: Set to `1` if call returned an error, `0` otherwise
+ * \param[in]       arg: Custom user argument
+ */
+typedef void (*lwutil_stats_trace_fn)(lwutil_stats_fn_t fn, size_t bytes, uint8_t err, void* arg);
+
+/**
+ * \brief           Streaming variable length integer decoder
+ */
+typedef struct {
+    uint64_t val; /*!< Partially decoded value */
+    uint8_t cnt;  /*!< Number of bytes of partially decoded value */
+    uint8_t err;  /*!< Error flag, set when too long varint has been found */
+} lwutil_varint_dec_t;
+
+/**
+ * \brief           Callback function for every value decoded by streaming decoder
+ * \param[in]       val: Decoded value
+ * \param[in]       arg: Custom user argument
+ */
+typedef void (*lwutil_varint_dec_fn)(uint64_t val, void* arg);
+
 /**
  * \brief           Store `16-bit` value to bytes array in little-endian format
  * \param[in]       val: Value to write to output array
@@ -271,7 +395,7 @@ lwutil_st_u32_le(uint32_t val, void* ptr) {
 static inline uint16_t
 lwutil_ld_u16_le(const void* ptr) {
     const uint8_t* p = (const uint8_t*)ptr;
-    return p[1] << 8 | p[0];
+    return (uint16_t)(p[1] << 8 | p[0]);
 }
 
 /**
@@ -282,7 +406,7 @@ lwutil_ld_u16_le(const void* ptr) {
 static inline uint32_t
 lwutil_ld_u32_le(const void* ptr) {
     const uint8_t* p = (const uint8_t*)ptr;
-    return p[3] << 24 | p[2] << 16 | p[1] << 8 | p[0];
+    return (uint32_t)p[3] << 24 | (uint32_t)p[2] << 16 | (uint32_t)p[1] << 8 | p[0];
 }
 
 /**
@@ -321,7 +445,7 @@ lwutil_st_u32_be(uint32_t val, void* ptr) {
 static inline uint16_t
 lwutil_ld_u16_be(const void* ptr) {
     const uint8_t* p = (const uint8_t*)ptr;
-    return p[0] << 8 | p[1];
+    return (uint16_t)(p[0] << 8 | p[1]);
 }
 
 /**
@@ -332,14 +456,173 @@ lwutil_ld_u16_be(const void* ptr) {
 static inline uint32_t
 lwutil_ld_u32_be(const void* ptr) {
     const uint8_t* p = (const uint8_t*)ptr;
-    return p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+    return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
 }
 
-void lwutil_u8_to_2asciis(uint8_t hex, char* ascii);
-void lwutil_u16_to_4asciis(uint16_t hex, char* ascii);
-void lwutil_u32_to_8asciis(uint32_t hex, char* ascii);
-uint8_t lwutil_ld_u32_varint(const void* ptr, size_t ptr_len, uint32_t* val_out);
-uint8_t lwutil_st_u32_varint(uint32_t val, void* ptr, size_t ptr_len);
+/**
+ * \brief           Store `64-bit` value to bytes array in little-endian format
+ * \param[in]       val: Value to write to output array
+ * \param[out]      ptr: Minimum `8-bytes` long output array to write value to
+ */
+static inline void
+lwutil_st_u64_le(uint64_t val, void* ptr) {
+    uint8_t* p = (uint8_t*)ptr;
+
+    lwutil_st_u32_le((uint32_t)val, &p[0]);
+    lwutil_st_u32_le((uint32_t)(val >> 32), &p[4]);
+}
+
+/**
+ * \brief           Load `64-bit` value from bytes array in little-endian format
+ * \param[in]       ptr: Minimum `8-bytes` long input array to extract bytes from
+ * \return          `64-bit` value extracted from input array
+ */
+static inline uint64_t
+lwutil_ld_u64_le(const void* ptr) {
+    const uint8_t* p = (const uint8_t*)ptr;
+    return (uint64_t)lwutil_ld_u32_le(&p[4]) << 32 | lwutil_ld_u32_le(&p[0]);
+}
+
+/**
+ * \brief           Store `64-bit` value to bytes array in big-endian format
+ * \param[in]       val: Value to write to output array
+ * \param[out]      ptr: Minimum `8-bytes` long output array to write value to
+ */
+static inline void
+lwutil_st_u64_be(uint64_t val, void* ptr) {
+    uint8_t* p = (uint8_t*)ptr;
+
+    lwutil_st_u32_be((uint32_t)(val >> 32), &p[0]);
+    lwutil_st_u32_be((uint32_t)val, &p[4]);
+}
+
+/**
+ * \brief           Load `64-bit` value from bytes array in big-endian format
+ * \param[in]       ptr: Minimum `8-bytes` long input array to extract bytes from
+ * \return          `64-bit` value extracted from input array
+ */
+static inline uint64_t
+lwutil_ld_u64_be(const void* ptr) {
+    const uint8_t* p = (const uint8_t*)ptr;
+    return (uint64_t)lwutil_ld_u32_be(&p[0]) << 32 | lwutil_ld_u32_be(&p[4]);
+}
+
+/**
+ * \brief           Zigzag encode signed `32-bit` value to unsigned value
+ * 
+ * Values are interleaved, so that small absolute values map to small unsigned values:
+ * `0 -> 0`, `-1 -> 1`, `1 -> 2`, `-2 -> 3`, ...
+ * 
+ * \param[in]       val: Signed value to encode
+ * \return          Zigzag encoded value
+ */
+static inline uint32_t
+lwutil_zigzag_enc_s32(int32_t val) {
+    return ((uint32_t)val << 1U) ^ (0U - ((uint32_t)val >> 31U));
+}
+
+/**
+ * \brief           Zigzag decode unsigned value to signed `32-bit` value
+ * \param[in]       val: Zigzag encoded value
+ * \return          Decoded signed value
+ */
+static inline int32_t
+lwutil_zigzag_dec_s32(uint32_t val) {
+    return (int32_t)((val >> 1U) ^ (0U - (val & 0x01U)));
+}
+
+/**
+ * \brief           Zigzag encode signed `64-bit` value to unsigned value
+ * \param[in]       val: Signed value to encode
+ * \return          Zigzag encoded value
+ */
+static inline uint64_t
+lwutil_zigzag_enc_s64(int64_t val) {
+    return ((uint64_t)val << 1U) ^ (0U - ((uint64_t)val >> 63U));
+}
+
+/**
+ * \brief           Zigzag decode unsigned value to signed `64-bit` value
+ * \param[in]       val: Zigzag encoded value
+ * \return          Decoded signed value
+ */
+static inline int64_t
+lwutil_zigzag_dec_s64(uint64_t val) {
+    return (int64_t)((val >> 1U) ^ (0U - (val & 0x01U)));
+}
+
+LWUTIL_API void lwutil_u8_to_2asciis(uint8_t hex, char* ascii);
+LWUTIL_API void lwutil_u16_to_4asciis(uint16_t hex, char* ascii);
+LWUTIL_API void lwutil_u32_to_8asciis(uint32_t hex, char* ascii);
+LWUTIL_API size_t lwutil_hex_encode(const void* buf, size_t len, char* out, uint8_t upper);
+LWUTIL_API size_t lwutil_hex_decode(const char* hex, size_t hex_len, void* out);
+LWUTIL_API uint8_t lwutil_u32_dec_len(uint32_t val);
+LWUTIL_API uint8_t lwutil_u64_dec_len(uint64_t val);
+LWUTIL_API size_t lwutil_u32_to_dec(uint32_t val, char* out, uint8_t nul);
+LWUTIL_API size_t lwutil_s32_to_dec(int32_t val, char* out, uint8_t nul);
+LWUTIL_API size_t lwutil_u64_to_dec(uint64_t val, char* out, uint8_t nul);
+LWUTIL_API size_t lwutil_s64_to_dec(int64_t val, char* out, uint8_t nul);
+LWUTIL_API size_t lwutil_u32_to_dec_fixed(uint32_t val, char* out, uint8_t width, uint8_t nul);
+LWUTIL_API size_t lwutil_s32_to_dec_fixed(int32_t val, char* out, uint8_t width, uint8_t nul);
+LWUTIL_API size_t lwutil_u64_to_dec_fixed(uint64_t val, char* out, uint8_t width, uint8_t nul);
+LWUTIL_API size_t lwutil_s64_to_dec_fixed(int64_t val, char* out, uint8_t width, uint8_t nul);
+LWUTIL_API size_t lwutil_u32_to_dec_array(const uint32_t* vals, size_t count, char* out, size_t out_len, char sep);
+LWUTIL_API size_t lwutil_s32_to_dec_array(const int32_t* vals, size_t count, char* out, size_t out_len, char sep);
+LWUTIL_API size_t lwutil_u64_to_dec_array(const uint64_t* vals, size_t count, char* out, size_t out_len, char sep);
+LWUTIL_API size_t lwutil_s64_to_dec_array(const int64_t* vals, size_t count, char* out, size_t out_len, char sep);
+LWUTIL_API size_t lwutil_parse_u32(const char* str, size_t len, uint32_t* val_out);
+LWUTIL_API size_t lwutil_parse_s32(const char* str, size_t len, int32_t* val_out);
+LWUTIL_API size_t lwutil_parse_u64(const char* str, size_t len, uint64_t* val_out);
+LWUTIL_API size_t lwutil_parse_s64(const char* str, size_t len, int64_t* val_out);
+LWUTIL_API uint8_t lwutil_ld_u32_varint(const void* ptr, size_t ptr_len, uint32_t* val_out);
+LWUTIL_API uint8_t lwutil_st_u32_varint(uint32_t val, void* ptr, size_t ptr_len);
+LWUTIL_API uint8_t lwutil_ld_u64_varint(const void* ptr, size_t ptr_len, uint64_t* val_out);
+LWUTIL_API uint8_t lwutil_st_u64_varint(uint64_t val, void* ptr, size_t ptr_len);
+LWUTIL_API uint8_t lwutil_ld_s32_varint(const void* ptr, size_t ptr_len, int32_t* val_out);
+LWUTIL_API uint8_t lwutil_st_s32_varint(int32_t val, void* ptr, size_t ptr_len);
+LWUTIL_API uint8_t lwutil_ld_s64_varint(const void* ptr, size_t ptr_len, int64_t* val_out);
+LWUTIL_API uint8_t lwutil_st_s64_varint(int64_t val, void* ptr, size_t ptr_len);
+LWUTIL_API uint8_t lwutil_u32_varint_len(uint32_t val);
+LWUTIL_API uint8_t lwutil_u64_varint_len(uint64_t val);
+LWUTIL_API void lwutil_st_u16_le_array(const uint16_t* vals, size_t count, void* ptr);
+LWUTIL_API void lwutil_st_u16_be_array(const uint16_t* vals, size_t count, void* ptr);
+LWUTIL_API void lwutil_st_u32_le_array(const uint32_t* vals, size_t count, void* ptr);
+LWUTIL_API void lwutil_st_u32_be_array(const uint32_t* vals, size_t count, void* ptr);
+LWUTIL_API void lwutil_st_u64_le_array(const uint64_t* vals, size_t count, void* ptr);
+LWUTIL_API void lwutil_st_u64_be_array(const uint64_t* vals, size_t count, void* ptr);
+LWUTIL_API void lwutil_ld_u16_le_array(const void* ptr, size_t count, uint16_t* vals_out);
+LWUTIL_API void lwutil_ld_u16_be_array(const void* ptr, size_t count, uint16_t* vals_out);
+LWUTIL_API void lwutil_ld_u32_le_array(const void* ptr, size_t count, uint32_t* vals_out);
+LWUTIL_API void lwutil_ld_u32_be_array(const void* ptr, size_t count, uint32_t* vals_out);
+LWUTIL_API void lwutil_ld_u64_le_array(const void* ptr, size_t count, uint64_t* vals_out);
+LWUTIL_API void lwutil_ld_u64_be_array(const void* ptr, size_t count, uint64_t* vals_out);
+LWUTIL_API size_t lwutil_ld_u32_varint_array(const void* ptr, size_t ptr_len, uint32_t* vals_out, size_t count);
+LWUTIL_API size_t lwutil_st_u32_varint_array(const uint32_t* vals, size_t count, void* ptr, size_t ptr_len);
+LWUTIL_API void lwutil_varint_dec_init(lwutil_varint_dec_t* dec);
+LWUTIL_API uint8_t lwutil_varint_dec_is_pending(const lwutil_varint_dec_t* dec);
+LWUTIL_API size_t lwutil_varint_dec_u32(lwutil_varint_dec_t* dec, const void* data, size_t len, uint32_t* vals_out,
+                                        size_t vals_max, size_t* vals_cnt);
+LWUTIL_API size_t lwutil_varint_dec_u64(lwutil_varint_dec_t* dec, const void* data, size_t len, uint64_t* vals_out,
+                                        size_t vals_max, size_t* vals_cnt);
+LWUTIL_API size_t lwutil_varint_dec_cb(lwutil_varint_dec_t* dec, const void* data, size_t len, lwutil_varint_dec_fn fn,
+                                       void* arg);
+LWUTIL_API uint8_t lwutil_ld_u32_pvarint(const void* ptr, size_t ptr_len, uint32_t* val_out);
+LWUTIL_API uint8_t lwutil_st_u32_pvarint(uint32_t val, void* ptr, size_t ptr_len);
+LWUTIL_API uint8_t lwutil_ld_u64_pvarint(const void* ptr, size_t ptr_len, uint64_t* val_out);
+LWUTIL_API uint8_t lwutil_st_u64_pvarint(uint64_t val, void* ptr, size_t ptr_len);
+LWUTIL_API uint8_t lwutil_u64_pvarint_len(uint64_t val);
+LWUTIL_API size_t lwutil_ld_u32_pvarint_array(const void* ptr, size_t ptr_len, uint32_t* vals_out, size_t count);
+LWUTIL_API size_t lwutil_st_u32_pvarint_array(const uint32_t* vals, size_t count, void* ptr, size_t ptr_len);
+LWUTIL_API size_t lwutil_ld_u64_pvarint_array(const void* ptr, size_t ptr_len, uint64_t* vals_out, size_t count);
+LWUTIL_API size_t lwutil_st_u64_pvarint_array(const uint64_t* vals, size_t count, void* ptr, size_t ptr_len);
+LWUTIL_API lwutil_simd_t lwutil_simd_get_level(void);
+LWUTIL_API lwutil_simd_t lwutil_simd_get_max_level(void);
+LWUTIL_API uint8_t lwutil_simd_set_level(lwutil_simd_t level);
+LWUTIL_API uint8_t lwutil_stats_snapshot(lwutil_stats_t* stats);
+LWUTIL_API void lwutil_stats_reset(void);
+LWUTIL_API void lwutil_stats_set_trace(lwutil_stats_trace_fn fn, void* arg);
+LWUTIL_API const char* lwutil_stats_get_name(lwutil_stats_fn_t fn);
+LWUTIL_API void lwutil_stats_record(lwutil_stats_fn_t fn, size_t bytes, uint8_t err);
 
 /**
  * \}
@@ -349,4 +632,11 @@ uint8_t lwutil_st_u32_varint(uint32_t val, void* ptr, size_t ptr_len);
 }
 #endif /* __cplusplus */
 
+/* Include implementation in header-only mode */
+#if LWUTIL_CFG_HEADER_ONLY && !defined(LWUTIL_HEADER_ONLY_IMPL)
+#define LWUTIL_HEADER_ONLY_IMPL
+#include "../../lwutil/lwutil.c"
+#undef LWUTIL_HEADER_ONLY_IMPL
+#endif /* LWUTIL_CFG_HEADER_ONLY && !defined(LWUTIL_HEADER_ONLY_IMPL) */
+
 #endif /* LWUTIL_HDR_H */
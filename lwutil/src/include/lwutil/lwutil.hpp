@@ -0,0 +1,679 @@
+/**
+ * \file            lwutil.hpp
+ * \brief           C++17 interface with compile-time codecs
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwUTIL - Lightweight utility library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v1.3.0
+ */
+#ifndef LWUTIL_HDR_HPP
+#define LWUTIL_HDR_HPP
+
+#if !(__cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L))
+#error "lwutil.hpp requires C++17 or later"
+#endif
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include "lwutil/lwutil.h"
+
+#if __has_include(<version>)
+#include <version>
+#endif
+#if defined(__cpp_lib_bit_cast) || defined(__cpp_lib_byteswap) || defined(__cpp_lib_endian)
+#include <bit>
+#endif
+#if defined(__cpp_lib_span)
+#include <span>
+#endif
+
+/* Constant evaluation check, to select between compile-time and run-time implementation */
+#if defined(__cpp_lib_is_constant_evaluated)
+#define LWUTIL_CPP_CONSTEVAL() std::is_constant_evaluated()
+#elif (defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define LWUTIL_CPP_CONSTEVAL() __builtin_is_constant_evaluated()
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define LWUTIL_CPP_CONSTEVAL() __builtin_is_constant_evaluated()
+#endif
+#endif
+#ifndef LWUTIL_CPP_CONSTEVAL
+#define LWUTIL_CPP_CONSTEVAL() true
+#endif
+
+namespace lwutil {
+
+/**
+ * \defgroup        LWUTIL_CPP C++ interface
+ * \brief           Type-safe, `constexpr` counterparts of the C functions
+ * \{
+ *
+ * Functions are templates, specialized by value type, width and byte order at compile time,
+ * and fully inlined into the caller instead of going through the C ABI.
+ * All single-value functions and codecs are `constexpr`, so they can build tables at compile time:
+ *
+ * \code{.cpp}
+static constexpr auto magic = lwutil::to_bytes<lwutil::endian::big>(UINT32_C(0xCAFEBABE));
+static constexpr auto key = lwutil::hex_array("000102030405060708090a0b0c0d0e0f");
+static constexpr auto hdr = lwutil::varint_array<300U>();
+
+uint32_t ts = lwutil::load<uint32_t, lwutil::endian::little>(&frame[4]);
+ * \endcode
+ *
+ * Bulk functions (arrays and hexadecimal codec) are forwarded to the C library at run time,
+ * to use its SSSE3/AVX2 kernels, and run inline when evaluated at compile time.
+ */
+
+/**
+ * \brief           Byte order of multi-byte values in memory
+ */
+enum class endian {
+    little, /*!< Least significant byte first */
+    big,    /*!< Most significant byte first */
+};
+
+namespace detail {
+
+/* Host byte order, when known at compile time */
+#if defined(__cpp_lib_endian)
+inline constexpr bool native_known =
+    std::endian::native == std::endian::little || std::endian::native == std::endian::big;
+inline constexpr endian native = std::endian::native == std::endian::big ? endian::big : endian::little;
+#elif (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || defined(_M_IX86) || defined(_M_X64)    \
+    || defined(_M_ARM64)
+inline constexpr bool native_known = true;
+inline constexpr endian native = endian::little;
+#elif defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+inline constexpr bool native_known = true;
+inline constexpr endian native = endian::big;
+#else
+inline constexpr bool native_known = false;
+inline constexpr endian native = endian::little;
+#endif
+
+/* Integer types, supported by the codecs */
+template <typename T>
+inline constexpr bool is_int_v = std::is_integral_v<T> && !std::is_same_v<T, bool>;
+
+/* C array functions for unsigned type `U` and byte order `E`, when available */
+template <typename U, endian E>
+struct array_fns {
+    static constexpr bool has = false;
+};
+
+#define LWUTIL_CPP_ARRAY_FNS(bits, e, sfx)                                                                             \
+    template <>                                                                                                        \
+    struct array_fns<uint##bits##_t, endian::e> {                                                                      \
+        static constexpr bool has = true;                                                                              \
+        static constexpr auto ld = &lwutil_ld_u##bits##_##sfx##_array;                                                 \
+        static constexpr auto st = &lwutil_st_u##bits##_##sfx##_array;                                                 \
+    }
+
+LWUTIL_CPP_ARRAY_FNS(16, little, le);
+LWUTIL_CPP_ARRAY_FNS(16, big, be);
+LWUTIL_CPP_ARRAY_FNS(32, little, le);
+LWUTIL_CPP_ARRAY_FNS(32, big, be);
+LWUTIL_CPP_ARRAY_FNS(64, little, le);
+LWUTIL_CPP_ARRAY_FNS(64, big, be);
+
+#undef LWUTIL_CPP_ARRAY_FNS
+
+/**
+ * \brief           Get unsigned varint representation of the value, zigzag-encoded for signed types
+ * \param[in]       val: Value to convert
+ * \return          Unsigned value to encode
+ */
+template <typename T>
+constexpr std::make_unsigned_t<T>
+varint_raw(T val) noexcept {
+    using U = std::make_unsigned_t<T>;
+
+    if constexpr (std::is_signed_v<T>) {
+        return static_cast<U>(static_cast<U>(static_cast<U>(val) << 1U) ^ (val < 0 ? static_cast<U>(~U(0)) : U(0)));
+    } else {
+        return val;
+    }
+}
+
+/**
+ * \brief           Get value of hexadecimal character
+ * \param[in]       c: Character to convert
+ * \return          Value between `0` and `15`, `-1` for invalid character
+ */
+constexpr int
+hex_nibble(char c) noexcept {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    } else if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    } else if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+/* Not a `constexpr` function, to fail compilation on invalid input in constant evaluation */
+inline void
+hex_invalid() noexcept {}
+
+} /* namespace detail */
+
+/**
+ * \brief           Get smaller value out of 2 inputs of the same type
+ *
+ * Unlike \ref LWUTIL_MIN, every input is evaluated exactly once.
+ *
+ * \param[in]       x: First input
+ * \param[in]       y: Second input
+ * \return          Smaller of both inputs
+ */
+template <typename T>
+constexpr T
+(min)(T x, T y) {
+    return x < y ? x : y;
+}
+
+/**
+ * \brief           Get larger value out of 2 inputs of the same type
+ *
+ * Unlike \ref LWUTIL_MAX, every input is evaluated exactly once.
+ *
+ * \param[in]       x: First input
+ * \param[in]       y: Second input
+ * \return          Larger of both inputs
+ */
+template <typename T>
+constexpr T
+(max)(T x, T y) {
+    return x > y ? x : y;
+}
+
+/**
+ * \brief           Constrain an input number within a range
+ * \note            Function does not check if `a < b`. This must be handled by the user.
+ * \param[in]       x: Number to constrain
+ * \param[in]       a: Minimum allowed number
+ * \param[in]       b: Maximum allowed number
+ * \return          `x` constrained between `a` and `b`
+ */
+template <typename T>
+constexpr T
+constrain(T x, T a, T b) {
+    return (min)((max)(x, a), b);
+}
+
+/**
+ * \brief           Map the input number from input range to output range
+ *
+ * Calculation is the same as in \ref LWUTIL_MAP, in type `T`.
+ * Integer types may overflow in the multiplication, when ranges are wide.
+ *
+ * \param[in]       x: Input value to map
+ * \param[in]       in_min: Minimum value to map from (input boundary)
+ * \param[in]       in_max: Maximum value to map from (input boundary)
+ * \param[in]       out_min: Minimum value to map to (output boundary)
+ * \param[in]       out_max: Maximum value to map to (output boundary)
+ * \return          Mapped value, not constrained to the output range
+ */
+template <typename T>
+constexpr T
+map(T x, T in_min, T in_max, T out_min, T out_max) {
+    return static_cast<T>((x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min);
+}
+
+/**
+ * \brief           Reverse byte order of the integer value
+ *
+ * Uses `std::byteswap` in C++23, or compiler built-in function.
+ *
+ * \param[in]       val: Value to swap
+ * \return          Value with reversed byte order
+ */
+template <typename T>
+constexpr T
+byteswap(T val) noexcept {
+    static_assert(detail::is_int_v<T>, "Type must be integer");
+#if defined(__cpp_lib_byteswap)
+    return std::byteswap(val);
+#else
+    using U = std::make_unsigned_t<T>;
+    U u = static_cast<U>(val);
+
+    if constexpr (sizeof(T) == 1U) {
+        return val;
+#if defined(__GNUC__) || defined(__clang__)
+    } else if constexpr (sizeof(T) == 2U) {
+        return static_cast<T>(__builtin_bswap16(u));
+    } else if constexpr (sizeof(T) == 4U) {
+        return static_cast<T>(__builtin_bswap32(u));
+    } else if constexpr (sizeof(T) == 8U) {
+        return static_cast<T>(__builtin_bswap64(u));
+#endif /* defined(__GNUC__) || defined(__clang__) */
+    } else {
+        U res = 0;
+
+        for (size_t i = 0; i < sizeof(T); ++i) {
+            res = static_cast<U>((res << 8U) | (u & 0xFFU));
+            u = static_cast<U>(u >> 8U);
+        }
+        return static_cast<T>(res);
+    }
+#endif /* defined(__cpp_lib_byteswap) */
+}
+
+/**
+ * \brief           Load integer value from byte array
+ *
+ * At run time, value is copied with single (unaligned) load and swapped when `E` differs from the host byte order.
+ *
+ * \tparam          T: Integer type to load
+ * \tparam          E: Byte order in the array
+ * \param[in]       ptr: Array to load value from, at least `sizeof(T)` bytes long
+ * \return          Loaded value
+ */
+template <typename T, endian E>
+constexpr T
+load(const uint8_t* ptr) noexcept {
+    static_assert(detail::is_int_v<T>, "Type must be integer");
+    using U = std::make_unsigned_t<T>;
+    U val = 0;
+
+    if constexpr (detail::native_known) {
+        if (!LWUTIL_CPP_CONSTEVAL()) {
+            std::memcpy(&val, ptr, sizeof(val));
+            return static_cast<T>(E == detail::native ? val : byteswap(val));
+        }
+    }
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        size_t shift = 8U * (E == endian::little ? i : (sizeof(T) - 1U - i));
+
+        val = static_cast<U>(val | (static_cast<U>(ptr[i]) << shift));
+    }
+    return static_cast<T>(val);
+}
+
+/**
+ * \brief           Store integer value to byte array
+ * \tparam          T: Integer type to store
+ * \tparam          E: Byte order in the array
+ * \param[in]       val: Value to store
+ * \param[out]      ptr: Array to store value to, at least `sizeof(T)` bytes long
+ */
+template <typename T, endian E>
+constexpr void
+store(T val, uint8_t* ptr) noexcept {
+    static_assert(detail::is_int_v<T>, "Type must be integer");
+    using U = std::make_unsigned_t<T>;
+    U u = static_cast<U>(val);
+
+    if constexpr (detail::native_known) {
+        if (!LWUTIL_CPP_CONSTEVAL()) {
+            u = E == detail::native ? u : byteswap(u);
+            std::memcpy(ptr, &u, sizeof(u));
+            return;
+        }
+    }
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        size_t shift = 8U * (E == endian::little ? i : (sizeof(T) - 1U - i));
+
+        ptr[i] = static_cast<uint8_t>(u >> shift);
+    }
+}
+
+/**
+ * \brief           Convert integer value to byte array
+ *
+ * Uses `std::bit_cast` in C++20, to keep the conversion a single register operation.
+ *
+ * \tparam          E: Byte order in the array
+ * \param[in]       val: Value to convert
+ * \return          Array of `sizeof(T)` bytes
+ */
+template <endian E, typename T>
+constexpr std::array<uint8_t, sizeof(T)>
+to_bytes(T val) noexcept {
+    static_assert(detail::is_int_v<T>, "Type must be integer");
+#if defined(__cpp_lib_bit_cast)
+    if constexpr (detail::native_known) {
+        return std::bit_cast<std::array<uint8_t, sizeof(T)>>(E == detail::native ? val : byteswap(val));
+    } else
+#endif /* defined(__cpp_lib_bit_cast) */
+    {
+        std::array<uint8_t, sizeof(T)> out{};
+
+        store<T, E>(val, out.data());
+        return out;
+    }
+}
+
+/**
+ * \brief           Convert byte array to integer value
+ *
+ * Uses `std::bit_cast` in C++20, to keep the conversion a single register operation.
+ *
+ * \tparam          T: Integer type to convert to
+ * \tparam          E: Byte order in the array
+ * \param[in]       bytes: Array of `sizeof(T)` bytes
+ * \return          Converted value
+ */
+template <typename T, endian E>
+constexpr T
+from_bytes(const std::array<uint8_t, sizeof(T)>& bytes) noexcept {
+    static_assert(detail::is_int_v<T>, "Type must be integer");
+#if defined(__cpp_lib_bit_cast)
+    if constexpr (detail::native_known) {
+        T val = std::bit_cast<T>(bytes);
+
+        return E == detail::native ? val : byteswap(val);
+    } else
+#endif /* defined(__cpp_lib_bit_cast) */
+    {
+        return load<T, E>(bytes.data());
+    }
+}
+
+/**
+ * \brief           Load array of integer values from byte array
+ *
+ * At run time, `16-bit`, `32-bit` and `64-bit` unsigned types use C array functions, with SSSE3/AVX2 byte shuffle.
+ *
+ * \tparam          T: Integer type to load
+ * \tparam          E: Byte order in the array
+ * \param[in]       ptr: Array to load values from, at least `count * sizeof(T)` bytes long
+ * \param[in]       count: Number of values to load
+ * \param[out]      vals: Array of at least `count` values
+ */
+template <typename T, endian E>
+constexpr void
+load_array(const uint8_t* ptr, size_t count, T* vals) noexcept {
+    using fns = detail::array_fns<std::make_unsigned_t<T>, E>;
+
+    if constexpr (fns::has) {
+        if (!LWUTIL_CPP_CONSTEVAL()) {
+            fns::ld(ptr, count, reinterpret_cast<std::make_unsigned_t<T>*>(vals));
+            return;
+        }
+    }
+    for (size_t i = 0; i < count; ++i) {
+        vals[i] = load<T, E>(&ptr[i * sizeof(T)]);
+    }
+}
+
+/**
+ * \brief           Store array of integer values to byte array
+ *
+ * At run time, `16-bit`, `32-bit` and `64-bit` unsigned types use C array functions, with SSSE3/AVX2 byte shuffle.
+ *
+ * \tparam          T: Integer type to store
+ * \tparam          E: Byte order in the array
+ * \param[in]       vals: Array of `count` values to store
+ * \param[in]       count: Number of values to store
+ * \param[out]      ptr: Array to store values to, at least `count * sizeof(T)` bytes long
+ */
+template <typename T, endian E>
+constexpr void
+store_array(const T* vals, size_t count, uint8_t* ptr) noexcept {
+    using fns = detail::array_fns<std::make_unsigned_t<T>, E>;
+
+    if constexpr (fns::has) {
+        if (!LWUTIL_CPP_CONSTEVAL()) {
+            fns::st(reinterpret_cast<const std::make_unsigned_t<T>*>(vals), count, ptr);
+            return;
+        }
+    }
+    for (size_t i = 0; i < count; ++i) {
+        store<T, E>(vals[i], &ptr[i * sizeof(T)]);
+    }
+}
+
+#if defined(__cpp_lib_span) || defined(__DOXYGEN__)
+
+/**
+ * \brief           Load integer values from byte span
+ * \tparam          T: Integer type to load
+ * \tparam          E: Byte order in the input
+ * \param[in]       in: Input bytes
+ * \param[out]      vals: Output values
+ * \return          Number of loaded values, smaller of `vals.size()` and number of complete values in `in`
+ */
+template <typename T, endian E>
+constexpr size_t
+load(std::span<const uint8_t> in, std::span<T> vals) noexcept {
+    size_t count = (min)(in.size() / sizeof(T), vals.size());
+
+    load_array<T, E>(in.data(), count, vals.data());
+    return count;
+}
+
+/**
+ * \brief           Store integer values to byte span
+ * \tparam          T: Integer type to store
+ * \tparam          E: Byte order in the output
+ * \param[in]       vals: Input values
+ * \param[out]      out: Output bytes
+ * \return          Number of stored values, smaller of `vals.size()` and number of values that fit `out`
+ */
+template <typename T, endian E>
+constexpr size_t
+store(std::span<const T> vals, std::span<uint8_t> out) noexcept {
+    size_t count = (min)(out.size() / sizeof(T), vals.size());
+
+    store_array<T, E>(vals.data(), count, out.data());
+    return count;
+}
+
+#endif /* defined(__cpp_lib_span) || defined(__DOXYGEN__) */
+
+/**
+ * \brief           Maximal varint length of integer type `T`, in units of bytes
+ */
+template <typename T>
+inline constexpr size_t varint_max_len = (8U * sizeof(T) + 6U) / 7U;
+
+/**
+ * \brief           Get varint length of the value
+ *
+ * Signed values are zigzag-encoded, same as in \ref lwutil_st_s32_varint.
+ *
+ * \param[in]       val: Value to check
+ * \return          Number of bytes required to store the value
+ */
+template <typename T>
+constexpr size_t
+varint_len(T val) noexcept {
+    static_assert(detail::is_int_v<T>, "Type must be integer");
+    auto u = detail::varint_raw(val);
+    size_t len = 1;
+
+    for (; u > 0x7FU; u = static_cast<decltype(u)>(u >> 7U)) {
+        ++len;
+    }
+    return len;
+}
+
+/**
+ * \brief           Store value in variable length integer format
+ *
+ * Output is the same as from \ref lwutil_st_u32_varint and other C varint functions of matching type.
+ *
+ * \param[in]       val: Value to store. Signed values are zigzag-encoded
+ * \param[out]      ptr: Array to store value to
+ * \param[in]       len: Length of `ptr` array
+ * \return          Number of bytes written. `0` if array is too short
+ */
+template <typename T>
+constexpr size_t
+store_varint(T val, uint8_t* ptr, size_t len) noexcept {
+    static_assert(detail::is_int_v<T>, "Type must be integer");
+    auto u = detail::varint_raw(val);
+
+    for (size_t cnt = 0; cnt < len;) {
+        uint8_t byt = static_cast<uint8_t>(u & 0x7FU);
+
+        u = static_cast<decltype(u)>(u >> 7U);
+        ptr[cnt++] = static_cast<uint8_t>(byt | (u > 0 ? 0x80U : 0x00U));
+        if (u == 0) {
+            return cnt;
+        }
+    }
+    return 0;
+}
+
+/**
+ * \brief           Load value in variable length integer format
+ *
+ * At most \ref varint_max_len bytes are accepted, same as in \ref lwutil_ld_u32_varint.
+ *
+ * \param[in]       ptr: Array to load value from
+ * \param[in]       len: Length of `ptr` array
+ * \param[out]      val: Loaded value. Signed values are zigzag-decoded. Set to `0` on failure
+ * \return          Number of bytes used for the value. `0` in case of an error
+ */
+template <typename T>
+constexpr size_t
+load_varint(const uint8_t* ptr, size_t len, T& val) noexcept {
+    static_assert(detail::is_int_v<T>, "Type must be integer");
+    using U = std::make_unsigned_t<T>;
+    U u = 0;
+
+    for (size_t cnt = 0; cnt < len && cnt < varint_max_len<T>;) {
+        uint8_t byt = ptr[cnt];
+
+        u = static_cast<U>(u | (static_cast<U>(byt & 0x7FU) << (7U * cnt)));
+        ++cnt;
+        if (byt < 0x80U) {
+            if constexpr (std::is_signed_v<T>) {
+                val = static_cast<T>(static_cast<U>(u >> 1U) ^ static_cast<U>(U(0) - static_cast<U>(u & 0x01U)));
+            } else {
+                val = u;
+            }
+            return cnt;
+        }
+    }
+    val = 0;
+    return 0;
+}
+
+/**
+ * \brief           Encode constant value to varint byte array at compile time
+ * \tparam          V: Value to encode
+ * \return          Array of exactly `varint_len(V)` bytes
+ */
+template <auto V>
+constexpr std::array<uint8_t, varint_len(V)>
+varint_array() noexcept {
+    std::array<uint8_t, varint_len(V)> out{};
+
+    store_varint(V, out.data(), out.size());
+    return out;
+}
+
+/**
+ * \brief           Encode byte array to hexadecimal ASCII characters
+ *
+ * At run time, call is forwarded to \ref lwutil_hex_encode.
+ *
+ * \param[in]       buf: Input data to encode
+ * \param[in]       len: Number of bytes in `buf`
+ * \param[out]      out: Minimum `2 * len` bytes long output array. It is not NULL-terminated
+ * \param[in]       upper: Set to `true` to use uppercase letters
+ * \return          Number of characters written to `out`
+ */
+constexpr size_t
+hex_encode(const uint8_t* buf, size_t len, char* out, bool upper = false) noexcept {
+    const char* digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+
+    if (!LWUTIL_CPP_CONSTEVAL()) {
+        return lwutil_hex_encode(buf, len, out, upper);
+    }
+    for (size_t i = 0; i < len; ++i) {
+        out[2U * i] = digits[buf[i] >> 4U];
+        out[2U * i + 1U] = digits[buf[i] & 0x0FU];
+    }
+    return 2U * len;
+}
+
+/**
+ * \brief           Decode hexadecimal ASCII characters to byte array
+ *
+ * At run time, call is forwarded to \ref lwutil_hex_decode.
+ *
+ * \param[in]       hex: Input characters, uppercase or lowercase
+ * \param[in]       hex_len: Number of characters in `hex`. Must be even number
+ * \param[out]      out: Minimum `hex_len / 2` bytes long output array
+ * \return          Number of bytes written to `out`. `0` on odd length or invalid character
+ */
+constexpr size_t
+hex_decode(const char* hex, size_t hex_len, uint8_t* out) noexcept {
+    if ((hex_len & 0x01U) != 0) {
+        return 0;
+    }
+    if (!LWUTIL_CPP_CONSTEVAL()) {
+        return lwutil_hex_decode(hex, hex_len, out);
+    }
+    for (size_t i = 0; i < hex_len / 2U; ++i) {
+        int hi = detail::hex_nibble(hex[2U * i]), lo = detail::hex_nibble(hex[2U * i + 1U]);
+
+        if (hi < 0 || lo < 0) {
+            return 0;
+        }
+        out[i] = static_cast<uint8_t>((hi << 4U) | lo);
+    }
+    return hex_len / 2U;
+}
+
+/**
+ * \brief           Decode hexadecimal string literal to byte array
+ *
+ * Intended for compile-time tables, where invalid character fails the compilation.
+ *
+ * \param[in]       hex: String literal with even number of hexadecimal characters
+ * \return          Decoded bytes
+ */
+template <size_t N>
+constexpr std::array<uint8_t, (N - 1U) / 2U>
+hex_array(const char (&hex)[N]) noexcept {
+    static_assert(N % 2U == 1U, "Hexadecimal string must have even number of characters");
+    std::array<uint8_t, (N - 1U) / 2U> out{};
+
+    if (hex_decode(hex, N - 1U, out.data()) != out.size()) {
+        detail::hex_invalid();
+    }
+    return out;
+}
+
+/**
+ * \}
+ */
+
+} /* namespace lwutil */
+
+#endif /* LWUTIL_HDR_HPP */
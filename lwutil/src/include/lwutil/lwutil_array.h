@@ -0,0 +1,95 @@
+/**
+ * \file            lwutil_array.h
+ * \brief           Array reductions and element-wise kernels
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwUTIL - Lightweight utility library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v1.3.0
+ */
+#ifndef LWUTIL_ARRAY_HDR_H
+#define LWUTIL_ARRAY_HDR_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "lwutil/lwutil.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \defgroup        LWUTIL_ARRAY Array kernels
+ * \brief           Minimum, maximum, clamp and absolute value over arrays
+ * \{
+ *
+ * Array variants of \ref LWUTIL_MIN, \ref LWUTIL_MAX, \ref LWUTIL_CONSTRAIN and \ref LWUTIL_ABS macros,
+ * processed with SSE4.1 or AVX2 instructions when supported by the CPU.
+ * Results are exact and identical to scalar code.
+ *
+ * Floating-point reductions ignore not-a-number elements.
+ * Output array of element-wise functions may be equal to the input array, for in-place processing.
+ */
+
+LWUTIL_API uint8_t lwutil_min_u8_array(const uint8_t* arr, size_t count, uint8_t* min_out);
+LWUTIL_API uint8_t lwutil_max_u8_array(const uint8_t* arr, size_t count, uint8_t* max_out);
+LWUTIL_API uint8_t lwutil_minmax_u8_array(const uint8_t* arr, size_t count, uint8_t* min_out, uint8_t* max_out);
+LWUTIL_API uint8_t lwutil_min_s16_array(const int16_t* arr, size_t count, int16_t* min_out);
+LWUTIL_API uint8_t lwutil_max_s16_array(const int16_t* arr, size_t count, int16_t* max_out);
+LWUTIL_API uint8_t lwutil_minmax_s16_array(const int16_t* arr, size_t count, int16_t* min_out, int16_t* max_out);
+LWUTIL_API uint8_t lwutil_min_s32_array(const int32_t* arr, size_t count, int32_t* min_out);
+LWUTIL_API uint8_t lwutil_max_s32_array(const int32_t* arr, size_t count, int32_t* max_out);
+LWUTIL_API uint8_t lwutil_minmax_s32_array(const int32_t* arr, size_t count, int32_t* min_out, int32_t* max_out);
+LWUTIL_API uint8_t lwutil_min_f32_array(const float* arr, size_t count, float* min_out);
+LWUTIL_API uint8_t lwutil_max_f32_array(const float* arr, size_t count, float* max_out);
+LWUTIL_API uint8_t lwutil_minmax_f32_array(const float* arr, size_t count, float* min_out, float* max_out);
+LWUTIL_API void lwutil_clamp_u8_array(const uint8_t* in, uint8_t* out, size_t count, uint8_t lo, uint8_t hi);
+LWUTIL_API void lwutil_clamp_s16_array(const int16_t* in, int16_t* out, size_t count, int16_t lo, int16_t hi);
+LWUTIL_API void lwutil_clamp_s32_array(const int32_t* in, int32_t* out, size_t count, int32_t lo, int32_t hi);
+LWUTIL_API void lwutil_clamp_f32_array(const float* in, float* out, size_t count, float lo, float hi);
+LWUTIL_API void lwutil_abs_s16_array(const int16_t* in, uint16_t* out, size_t count);
+LWUTIL_API void lwutil_abs_s32_array(const int32_t* in, uint32_t* out, size_t count);
+LWUTIL_API void lwutil_abs_f32_array(const float* in, float* out, size_t count);
+LWUTIL_API void lwutil_abs_sat_s16_array(const int16_t* in, int16_t* out, size_t count);
+LWUTIL_API void lwutil_abs_sat_s32_array(const int32_t* in, int32_t* out, size_t count);
+
+/**
+ * \}
+ */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+/* Include implementation in header-only mode */
+#if LWUTIL_CFG_HEADER_ONLY && !defined(LWUTIL_HEADER_ONLY_IMPL)
+#define LWUTIL_HEADER_ONLY_IMPL
+#include "../../lwutil/lwutil_array.c"
+#undef LWUTIL_HEADER_ONLY_IMPL
+#endif /* LWUTIL_CFG_HEADER_ONLY && !defined(LWUTIL_HEADER_ONLY_IMPL) */
+
+#endif /* LWUTIL_ARRAY_HDR_H */
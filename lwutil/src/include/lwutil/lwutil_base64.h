@@ -0,0 +1,92 @@
+/**
+ * \file            lwutil_base64.h
+ * \brief           Base64 encoder and decoder
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwUTIL - Lightweight utility library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v1.3.0
+ */
+#ifndef LWUTIL_BASE64_HDR_H
+#define LWUTIL_BASE64_HDR_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "lwutil/lwutil.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \defgroup        LWUTIL_BASE64 Base64 encoder and decoder
+ * \brief           Base64 encoding with standard and URL-safe alphabets, as defined by RFC 4648
+ * \{
+ *
+ * Every `3` input bytes are encoded as `4` characters.
+ * With padding, last group is completed with `=` characters to `4` characters,
+ * without padding it is shortened to `2` or `3` characters.
+ *
+ * Decoder is strict. Any character outside of the alphabet (including whitespace and line breaks)
+ * is an error, padded input must have correct number of `=` characters and unpadded input must not have any.
+ * Unused bits of the last character must be `0`, so that every byte array has exactly one valid encoding.
+ *
+ * Data is processed with look-up tables, or with AVX2 kernels in blocks of `24` bytes or `32` characters,
+ * when instruction set is supported by the CPU.
+ */
+
+/**
+ * \brief           Base64 alphabet
+ */
+typedef enum {
+    LWUTIL_BASE64_STD = 0, /*!< Standard alphabet with `+` and `/` characters */
+    LWUTIL_BASE64_URL = 1, /*!< URL and filename safe alphabet with `-` and `_` characters */
+} lwutil_base64_alphabet_t;
+
+LWUTIL_API size_t lwutil_base64_encoded_len(size_t len, uint8_t pad);
+LWUTIL_API size_t lwutil_base64_decoded_len(const char* b64, size_t b64_len, uint8_t pad);
+LWUTIL_API size_t lwutil_base64_encode(const void* buf, size_t len, char* out, lwutil_base64_alphabet_t alphabet,
+                                       uint8_t pad);
+LWUTIL_API size_t lwutil_base64_decode(const char* b64, size_t b64_len, void* out, lwutil_base64_alphabet_t alphabet,
+                                       uint8_t pad);
+
+/**
+ * \}
+ */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+/* Include implementation in header-only mode */
+#if LWUTIL_CFG_HEADER_ONLY && !defined(LWUTIL_HEADER_ONLY_IMPL)
+#define LWUTIL_HEADER_ONLY_IMPL
+#include "../../lwutil/lwutil_base64.c"
+#undef LWUTIL_HEADER_ONLY_IMPL
+#endif /* LWUTIL_CFG_HEADER_ONLY && !defined(LWUTIL_HEADER_ONLY_IMPL) */
+
+#endif /* LWUTIL_BASE64_HDR_H */
@@ -0,0 +1,170 @@
+/**
+ * \file            lwutil_bitmap.h
+ * \brief           Multi-word bitmap
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwUTIL - Lightweight utility library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v1.3.0
+ */
+#ifndef LWUTIL_BITMAP_HDR_H
+#define LWUTIL_BITMAP_HDR_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "lwutil/lwutil.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \defgroup        LWUTIL_BITMAP Bitmap
+ * \brief           Multi-word bitmap with range operations and fast scan
+ * \{
+ *
+ * Bitmap extends \ref lwutil_bits_set, \ref lwutil_bits_clear and similar macros
+ * to any number of bits, stored in the array of `64-bit` words, provided by the application.
+ * Bit `n` is stored at position `n % 64` of the word `n / 64`.
+ *
+ * Search, population count and operations between bitmaps process complete words,
+ * with SSSE3, SSE4.1 or AVX2 instructions when supported by the CPU.
+ *
+ * Unused bits of the last word must remain cleared. This is guaranteed
+ * when the bitmap is only modified with the functions of this module.
+ */
+
+/**
+ * \brief           Get number of `64-bit` words required for bitmap
+ * \param[in]       bits: Number of bits in the bitmap
+ * \return          Number of words
+ */
+#define LWUTIL_BITMAP_WORDS(bits) (((bits) + 63U) / 64U)
+
+/**
+ * \brief           Index returned by search functions when no bit is found
+ */
+#define LWUTIL_BITMAP_NONE        ((size_t)-1)
+
+/**
+ * \brief           Bitmap structure
+ */
+typedef struct {
+    uint64_t* words; /*!< Array of \ref LWUTIL_BITMAP_WORDS words */
+    size_t size;     /*!< Number of bits in the bitmap */
+} lwutil_bitmap_t;
+
+/**
+ * \brief           Iterator over set bits of the bitmap
+ */
+typedef struct {
+    const uint64_t* words; /*!< Array of words */
+    size_t count;          /*!< Number of words */
+    size_t pos;            /*!< Index of next word to load */
+    uint64_t cur;          /*!< Set bits of current word, not returned yet */
+} lwutil_bitmap_iter_t;
+
+/**
+ * \brief           Set bit in the bitmap
+ * \param[in]       bm: Bitmap
+ * \param[in]       idx: Bit index. Ignored when out of range
+ */
+static inline void
+lwutil_bitmap_set(lwutil_bitmap_t* bm, size_t idx) {
+    if (idx < bm->size) {
+        bm->words[idx / 64U] |= UINT64_C(1) << (idx % 64U);
+    }
+}
+
+/**
+ * \brief           Clear bit in the bitmap
+ * \param[in]       bm: Bitmap
+ * \param[in]       idx: Bit index. Ignored when out of range
+ */
+static inline void
+lwutil_bitmap_clear(lwutil_bitmap_t* bm, size_t idx) {
+    if (idx < bm->size) {
+        bm->words[idx / 64U] &= ~(UINT64_C(1) << (idx % 64U));
+    }
+}
+
+/**
+ * \brief           Toggle bit in the bitmap
+ * \param[in]       bm: Bitmap
+ * \param[in]       idx: Bit index. Ignored when out of range
+ */
+static inline void
+lwutil_bitmap_toggle(lwutil_bitmap_t* bm, size_t idx) {
+    if (idx < bm->size) {
+        bm->words[idx / 64U] ^= UINT64_C(1) << (idx % 64U);
+    }
+}
+
+/**
+ * \brief           Check if bit in the bitmap is set
+ * \param[in]       bm: Bitmap
+ * \param[in]       idx: Bit index
+ * \return          `1` if bit is set, `0` if it is cleared or out of range
+ */
+static inline uint8_t
+lwutil_bitmap_is_set(const lwutil_bitmap_t* bm, size_t idx) {
+    return idx < bm->size ? (uint8_t)((bm->words[idx / 64U] >> (idx % 64U)) & 0x01U) : 0U;
+}
+
+LWUTIL_API uint8_t lwutil_bitmap_init(lwutil_bitmap_t* bm, uint64_t* words, size_t size);
+LWUTIL_API uint8_t lwutil_bitmap_set_range(lwutil_bitmap_t* bm, size_t start, size_t count);
+LWUTIL_API uint8_t lwutil_bitmap_clear_range(lwutil_bitmap_t* bm, size_t start, size_t count);
+LWUTIL_API uint8_t lwutil_bitmap_is_set_all_range(const lwutil_bitmap_t* bm, size_t start, size_t count);
+LWUTIL_API uint8_t lwutil_bitmap_is_set_any_range(const lwutil_bitmap_t* bm, size_t start, size_t count);
+LWUTIL_API size_t lwutil_bitmap_find_first_set(const lwutil_bitmap_t* bm, size_t start);
+LWUTIL_API size_t lwutil_bitmap_find_first_zero(const lwutil_bitmap_t* bm, size_t start);
+LWUTIL_API size_t lwutil_bitmap_popcount(const lwutil_bitmap_t* bm);
+LWUTIL_API uint8_t lwutil_bitmap_and(lwutil_bitmap_t* dst, const lwutil_bitmap_t* a, const lwutil_bitmap_t* b);
+LWUTIL_API uint8_t lwutil_bitmap_or(lwutil_bitmap_t* dst, const lwutil_bitmap_t* a, const lwutil_bitmap_t* b);
+LWUTIL_API uint8_t lwutil_bitmap_andnot(lwutil_bitmap_t* dst, const lwutil_bitmap_t* a, const lwutil_bitmap_t* b);
+LWUTIL_API uint8_t lwutil_bitmap_xor(lwutil_bitmap_t* dst, const lwutil_bitmap_t* a, const lwutil_bitmap_t* b);
+
+LWUTIL_API void lwutil_bitmap_iter_init(lwutil_bitmap_iter_t* it, const lwutil_bitmap_t* bm, size_t start);
+LWUTIL_API uint8_t lwutil_bitmap_iter_next(lwutil_bitmap_iter_t* it, size_t* idx);
+LWUTIL_API size_t lwutil_bitmap_iter_next_batch(lwutil_bitmap_iter_t* it, size_t* idx, size_t max_count);
+
+/**
+ * \}
+ */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+/* Include implementation in header-only mode */
+#if LWUTIL_CFG_HEADER_ONLY && !defined(LWUTIL_HEADER_ONLY_IMPL)
+#define LWUTIL_HEADER_ONLY_IMPL
+#include "../../lwutil/lwutil_bitmap.c"
+#undef LWUTIL_HEADER_ONLY_IMPL
+#endif /* LWUTIL_CFG_HEADER_ONLY && !defined(LWUTIL_HEADER_ONLY_IMPL) */
+
+#endif /* LWUTIL_BITMAP_HDR_H */
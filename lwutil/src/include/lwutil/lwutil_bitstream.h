@@ -0,0 +1,294 @@
+/**
+ * \file            lwutil_bitstream.h
+ * \brief           Bit-stream reader and writer
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwUTIL - Lightweight utility library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v1.3.0
+ */
+#ifndef LWUTIL_BITSTREAM_HDR_H
+#define LWUTIL_BITSTREAM_HDR_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "lwutil/lwutil.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \defgroup        LWUTIL_BITSTREAM Bit-stream reader and writer
+ * \brief           Read and write fields of arbitrary bit width
+ * \{
+ *
+ * Reader and writer keep up to `64` bits in the accumulator,
+ * refilled or flushed with single `64-bit` load or store, when at least `8` bytes of the array remain.
+ * Closer to the end of array, bytes are processed one by one.
+ *
+ * In \ref LWUTIL_BITORDER_MSB_FIRST order, fields are packed starting with the most significant bit of the byte,
+ * and bits of each field are written starting with its most significant bit.
+ * In \ref LWUTIL_BITORDER_LSB_FIRST order, fields are packed starting with the least significant bit of the byte,
+ * and bits of each field are written starting with its least significant bit.
+ *
+ * Like \ref LWUTIL_BUF cursor, reader and writer have sticky error flag,
+ * set when operation does not fit the array. All following reads return `0`.
+ */
+
+/**
+ * \brief           Order of bits in the stream
+ */
+typedef enum {
+    LWUTIL_BITORDER_MSB_FIRST = 0, /*!< Most significant bit first, as used by most network protocols */
+    LWUTIL_BITORDER_LSB_FIRST = 1, /*!< Least significant bit first */
+} lwutil_bitorder_t;
+
+/**
+ * \brief           Bit-stream reader structure
+ */
+typedef struct {
+    const uint8_t* data;     /*!< Pointer to data array */
+    size_t size;             /*!< Size of data array in units of bytes */
+    size_t pos;              /*!< Index of next byte to load to the accumulator */
+    uint64_t acc;            /*!< Bit accumulator. Next bit is at the top in MSB-first order, at bottom otherwise */
+    uint8_t cnt;             /*!< Number of valid bits in the accumulator */
+    uint8_t err;             /*!< Sticky error flag. Set to `1` when read exceeded the array */
+    lwutil_bitorder_t order; /*!< Order of bits */
+} lwutil_bitreader_t;
+
+/**
+ * \brief           Bit-stream writer structure
+ */
+typedef struct {
+    uint8_t* data;           /*!< Pointer to data array */
+    size_t size;             /*!< Size of data array in units of bytes */
+    size_t pos;              /*!< Index of next byte to store from the accumulator */
+    uint64_t acc;            /*!< Bit accumulator. First bit is at the top in MSB-first order, at bottom otherwise */
+    uint8_t cnt;             /*!< Number of valid bits in the accumulator */
+    uint8_t err;             /*!< Sticky error flag. Set to `1` when write exceeded the array */
+    lwutil_bitorder_t order; /*!< Order of bits */
+} lwutil_bitwriter_t;
+
+/**
+ * \brief           Refill reader accumulator to at least `56` bits, or with all remaining bytes
+ * \param[in]       rd: Bit-stream reader
+ */
+static LWUTIL_FORCE_INLINE void
+lwutil_bitreader_refill(lwutil_bitreader_t* rd) {
+    if ((rd->size - rd->pos) >= 8U) {
+        /* Bytes beyond the full ones are loaded again by next refill, to the same position */
+        if (rd->order == LWUTIL_BITORDER_MSB_FIRST) {
+            rd->acc |= lwutil_ld_u64_be(&rd->data[rd->pos]) >> rd->cnt;
+        } else {
+            rd->acc |= lwutil_ld_u64_le(&rd->data[rd->pos]) << rd->cnt;
+        }
+        rd->pos += (63U - rd->cnt) >> 3U;
+        rd->cnt |= 56U;
+    } else {
+        for (; rd->cnt <= 56U && rd->pos < rd->size; ++rd->pos, rd->cnt += 8U) {
+            if (rd->order == LWUTIL_BITORDER_MSB_FIRST) {
+                rd->acc |= (uint64_t)rd->data[rd->pos] << (56U - rd->cnt);
+            } else {
+                rd->acc |= (uint64_t)rd->data[rd->pos] << rd->cnt;
+            }
+        }
+    }
+}
+
+/**
+ * \brief           Get next bits, without consuming them
+ *
+ * When less than `n` bits remain, missing bits are read as `0` and error flag is not set.
+ *
+ * \param[in]       rd: Bit-stream reader
+ * \param[in]       n: Number of bits to get, from `0` to `32`
+ * \return          Value of the bits
+ */
+static inline uint32_t
+lwutil_bitreader_peek_bits(lwutil_bitreader_t* rd, uint8_t n) {
+    if (rd->cnt < n) {
+        lwutil_bitreader_refill(rd);
+    }
+    if (rd->order == LWUTIL_BITORDER_MSB_FIRST) {
+        return (uint32_t)((rd->acc >> 1U) >> (63U - n));
+    }
+    return (uint32_t)(rd->acc & ((UINT64_C(1) << n) - 1U));
+}
+
+/**
+ * \brief           Consume bits, returned by \ref lwutil_bitreader_peek_bits
+ * \param[in]       rd: Bit-stream reader
+ * \param[in]       n: Number of bits to consume. Must not exceed number of bits returned by previous peek
+ * \return          `1` on success, `0` when less than `n` bits remain
+ */
+static inline uint8_t
+lwutil_bitreader_consume_bits(lwutil_bitreader_t* rd, uint8_t n) {
+    if (rd->cnt < n) {
+        rd->err = 1;
+        rd->pos = rd->size;
+        rd->acc = 0;
+        rd->cnt = 0;
+        return 0;
+    }
+    if (rd->order == LWUTIL_BITORDER_MSB_FIRST) {
+        rd->acc <<= n;
+    } else {
+        rd->acc >>= n;
+    }
+    rd->cnt -= n;
+    return 1;
+}
+
+/**
+ * \brief           Read field of `n` bits
+ * \param[in]       rd: Bit-stream reader
+ * \param[in]       n: Number of bits to read, from `0` to `32`
+ * \return          Value of the field. `0` on error
+ */
+static inline uint32_t
+lwutil_bitreader_get_bits(lwutil_bitreader_t* rd, uint8_t n) {
+    uint32_t val = lwutil_bitreader_peek_bits(rd, n);
+    return lwutil_bitreader_consume_bits(rd, n) ? val : 0;
+}
+
+/**
+ * \brief           Write field of `n` bits
+ * \param[in]       wr: Bit-stream writer
+ * \param[in]       val: Value to write. Bits above `n` bits are ignored
+ * \param[in]       n: Number of bits to write, from `0` to `32`
+ */
+static inline void
+lwutil_bitwriter_put_bits(lwutil_bitwriter_t* wr, uint32_t val, uint8_t n) {
+    uint64_t v = (uint64_t)val & ((UINT64_C(1) << n) - 1U);
+
+    /* Accumulator keeps less than 32 bits between calls, so that it never overflows */
+    if (wr->order == LWUTIL_BITORDER_MSB_FIRST) {
+        wr->acc |= (v << 1U) << (63U - wr->cnt - n);
+    } else {
+        wr->acc |= v << wr->cnt;
+    }
+    wr->cnt += n;
+    if (wr->cnt < 32U) {
+        return;
+    }
+    if ((wr->size - wr->pos) >= 8U) {
+        uint8_t bytes = (uint8_t)(wr->cnt >> 3U);
+
+        if (wr->order == LWUTIL_BITORDER_MSB_FIRST) {
+            lwutil_st_u64_be(wr->acc, &wr->data[wr->pos]);
+            wr->acc <<= 8U * bytes;
+        } else {
+            lwutil_st_u64_le(wr->acc, &wr->data[wr->pos]);
+            wr->acc >>= 8U * bytes;
+        }
+        wr->pos += bytes;
+        wr->cnt &= 0x07U;
+    } else {
+        for (; wr->cnt >= 8U; wr->cnt -= 8U) {
+            if (wr->pos < wr->size) {
+                wr->data[wr->pos++] = (uint8_t)(wr->order == LWUTIL_BITORDER_MSB_FIRST ? (wr->acc >> 56U) : wr->acc);
+            } else {
+                wr->err = 1;
+            }
+            if (wr->order == LWUTIL_BITORDER_MSB_FIRST) {
+                wr->acc <<= 8U;
+            } else {
+                wr->acc >>= 8U;
+            }
+        }
+    }
+}
+
+/**
+ * \brief           Check if all operations succeeded so far
+ * \param[in]       rd: Bit-stream reader
+ * \return          `1` if error flag is not set, `0` otherwise
+ */
+static inline uint8_t
+lwutil_bitreader_ok(const lwutil_bitreader_t* rd) {
+    return rd->err == 0;
+}
+
+/**
+ * \brief           Check if all operations succeeded so far
+ * \param[in]       wr: Bit-stream writer
+ * \return          `1` if error flag is not set, `0` otherwise
+ */
+static inline uint8_t
+lwutil_bitwriter_ok(const lwutil_bitwriter_t* wr) {
+    return wr->err == 0;
+}
+
+/**
+ * \brief           Get number of bits remaining to be read
+ * \param[in]       rd: Bit-stream reader
+ * \return          Number of remaining bits
+ */
+static inline size_t
+lwutil_bitreader_bits_left(const lwutil_bitreader_t* rd) {
+    return (rd->size - rd->pos) * 8U + rd->cnt;
+}
+
+/**
+ * \brief           Get number of bits written so far
+ * \param[in]       wr: Bit-stream writer
+ * \return          Number of written bits
+ */
+static inline size_t
+lwutil_bitwriter_bits(const lwutil_bitwriter_t* wr) {
+    return wr->pos * 8U + wr->cnt;
+}
+
+LWUTIL_API uint8_t lwutil_bitreader_init(lwutil_bitreader_t* rd, const void* data, size_t size,
+                                         lwutil_bitorder_t order);
+LWUTIL_API uint64_t lwutil_bitreader_get_bits64(lwutil_bitreader_t* rd, uint8_t n);
+LWUTIL_API uint8_t lwutil_bitreader_skip_bits(lwutil_bitreader_t* rd, size_t n);
+LWUTIL_API uint8_t lwutil_bitreader_align(lwutil_bitreader_t* rd);
+LWUTIL_API size_t lwutil_bitreader_unpack(lwutil_bitreader_t* rd, uint32_t* vals_out, size_t count, uint8_t n);
+
+LWUTIL_API uint8_t lwutil_bitwriter_init(lwutil_bitwriter_t* wr, void* data, size_t size, lwutil_bitorder_t order);
+LWUTIL_API void lwutil_bitwriter_put_bits64(lwutil_bitwriter_t* wr, uint64_t val, uint8_t n);
+LWUTIL_API uint8_t lwutil_bitwriter_pack(lwutil_bitwriter_t* wr, const uint32_t* vals, size_t count, uint8_t n);
+LWUTIL_API size_t lwutil_bitwriter_flush(lwutil_bitwriter_t* wr);
+
+/**
+ * \}
+ */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+/* Include implementation in header-only mode */
+#if LWUTIL_CFG_HEADER_ONLY && !defined(LWUTIL_HEADER_ONLY_IMPL)
+#define LWUTIL_HEADER_ONLY_IMPL
+#include "../../lwutil/lwutil_bitstream.c"
+#undef LWUTIL_HEADER_ONLY_IMPL
+#endif /* LWUTIL_CFG_HEADER_ONLY && !defined(LWUTIL_HEADER_ONLY_IMPL) */
+
+#endif /* LWUTIL_BITSTREAM_HDR_H */
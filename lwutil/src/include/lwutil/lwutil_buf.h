@@ -0,0 +1,753 @@
+/**
+ * \file            lwutil_buf.h
+ * \brief           Bounds-checked buffer reader and writer
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwUTIL - Lightweight utility library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v1.3.0
+ */
+#ifndef LWUTIL_BUF_HDR_H
+#define LWUTIL_BUF_HDR_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lwutil/lwutil.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \defgroup        LWUTIL_BUF Buffer reader and writer
+ * \brief           Bounds-checked cursor over byte array
+ * \{
+ *
+ * Cursor keeps current position and remaining length of the array,
+ * so that every typed put or get operation checks the bounds.
+ * When operation does not fit the array, sticky error flag is set
+ * and all following operations are ignored. Application can therefore
+ * encode or decode complete record and check for errors only once, at the end.
+ *
+ * For fixed-size records, \ref lwutil_buf_reserve checks the length of the whole record once,
+ * followed by `_unchecked` put or get functions, that perform no further checks.
+ */
+
+/**
+ * \brief           Buffer cursor structure
+ */
+typedef struct {
+    uint8_t* data; /*!< Pointer to data array */
+    size_t size;   /*!< Size of data array in units of bytes */
+    size_t pos;    /*!< Current read or write position */
+    uint8_t err;   /*!< Sticky error flag. Set to `1` when operation did not fit the array */
+} lwutil_buf_t;
+
+/**
+ * \brief           Initialize buffer cursor for writing
+ * \param[in]       buf: Buffer cursor
+ * \param[in]       data: Array to write to
+ * \param[in]       size: Size of array in units of bytes
+ */
+static inline void
+lwutil_buf_init(lwutil_buf_t* buf, void* data, size_t size) {
+    buf->data = (uint8_t*)data;
+    buf->size = data != NULL ? size : 0;
+    buf->pos = 0;
+    buf->err = 0;
+}
+
+/**
+ * \brief           Initialize buffer cursor for reading from constant data
+ * \note            Only `get` functions shall be used with such cursor
+ * \param[in]       buf: Buffer cursor
+ * \param[in]       data: Array to read from
+ * \param[in]       size: Size of array in units of bytes
+ */
+static inline void
+lwutil_buf_init_const(lwutil_buf_t* buf, const void* data, size_t size) {
+    lwutil_buf_init(buf, (void*)data, size);
+}
+
+/**
+ * \brief           Check if all operations succeeded so far
+ * \param[in]       buf: Buffer cursor
+ * \return          `1` if error flag is not set, `0` otherwise
+ */
+static inline uint8_t
+lwutil_buf_ok(const lwutil_buf_t* buf) {
+    return buf->err == 0;
+}
+
+/**
+ * \brief           Get number of bytes written or read so far
+ * \param[in]       buf: Buffer cursor
+ * \return          Current position in units of bytes
+ */
+static inline size_t
+lwutil_buf_len(const lwutil_buf_t* buf) {
+    return buf->pos;
+}
+
+/**
+ * \brief           Get number of bytes remaining in the array
+ * \param[in]       buf: Buffer cursor
+ * \return          Remaining length in units of bytes
+ */
+static inline size_t
+lwutil_buf_remaining(const lwutil_buf_t* buf) {
+    return buf->size - buf->pos;
+}
+
+/**
+ * \brief           Check that `len` bytes are available for following unchecked operations
+ *
+ * Position is not modified. On failure, error flag is set.
+ *
+ * \param[in]       buf: Buffer cursor
+ * \param[in]       len: Number of bytes to reserve
+ * \return          `1` if `len` bytes can be written or read, `0` otherwise
+ */
+static inline uint8_t
+lwutil_buf_reserve(lwutil_buf_t* buf, size_t len) {
+    if (buf->err || len > (buf->size - buf->pos)) {
+        buf->err = 1;
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * \brief           Skip `len` bytes, without reading or writing them
+ * \param[in]       buf: Buffer cursor
+ * \param[in]       len: Number of bytes to skip
+ * \return          `1` on success, `0` otherwise
+ */
+static inline uint8_t
+lwutil_buf_skip(lwutil_buf_t* buf, size_t len) {
+    if (!lwutil_buf_reserve(buf, len)) {
+        return 0;
+    }
+    buf->pos += len;
+    return 1;
+}
+
+/**
+ * \brief           Write raw bytes
+ * \param[in]       buf: Buffer cursor
+ * \param[in]       data: Data to write
+ * \param[in]       len: Number of bytes to write
+ * \return          `1` on success, `0` otherwise
+ */
+static inline uint8_t
+lwutil_buf_put_bytes(lwutil_buf_t* buf, const void* data, size_t len) {
+    if (!lwutil_buf_reserve(buf, len)) {
+        return 0;
+    }
+    if (len > 0) {
+        memcpy(&buf->data[buf->pos], data, len);
+    }
+    buf->pos += len;
+    return 1;
+}
+
+/**
+ * \brief           Read raw bytes
+ * \param[in]       buf: Buffer cursor
+ * \param[out]      data: Array to write read bytes to
+ * \param[in]       len: Number of bytes to read
+ * \return          `1` on success, `0` otherwise
+ */
+static inline uint8_t
+lwutil_buf_get_bytes(lwutil_buf_t* buf, void* data, size_t len) {
+    if (!lwutil_buf_reserve(buf, len)) {
+        return 0;
+    }
+    if (len > 0) {
+        memcpy(data, &buf->data[buf->pos], len);
+    }
+    buf->pos += len;
+    return 1;
+}
+
+/**
+ * \brief           Write `8-bit` value, without bounds check
+ * \note            Space must be reserved with \ref lwutil_buf_reserve beforehand
+ * \param[in]       buf: Buffer cursor
+ * \param[in]       val: Value to write
+ */
+static inline void
+lwutil_buf_put_u8_unchecked(lwutil_buf_t* buf, uint8_t val) {
+    buf->data[buf->pos] = val;
+    buf->pos += 1U;
+}
+
+/**
+ * \brief           Write `8-bit` value
+ * \param[in]       buf: Buffer cursor
+ * \param[in]       val: Value to write
+ * \return          `1` on success, `0` otherwise
+ */
+static inline uint8_t
+lwutil_buf_put_u8(lwutil_buf_t* buf, uint8_t val) {
+    if (!lwutil_buf_reserve(buf, 1U)) {
+        return 0;
+    }
+    lwutil_buf_put_u8_unchecked(buf, val);
+    return 1;
+}
+
+/**
+ * \brief           Read `8-bit` value, without bounds check
+ * \note            Data must be reserved with \ref lwutil_buf_reserve beforehand
+ * \param[in]       buf: Buffer cursor
+ * \return          Read value
+ */
+static inline uint8_t
+lwutil_buf_get_u8_unchecked(lwutil_buf_t* buf) {
+    uint8_t val = buf->data[buf->pos];
+    buf->pos += 1U;
+    return val;
+}
+
+/**
+ * \brief           Read `8-bit` value
+ * \param[in]       buf: Buffer cursor
+ * \return          Read value. `0` on error
+ */
+static inline uint8_t
+lwutil_buf_get_u8(lwutil_buf_t* buf) {
+    if (!lwutil_buf_reserve(buf, 1U)) {
+        return 0;
+    }
+    return lwutil_buf_get_u8_unchecked(buf);
+}
+
+/**
+ * \brief           Write `16-bit` value in little-endian format, without bounds check
+ * \note            Space must be reserved with \ref lwutil_buf_reserve beforehand
+ * \param[in]       buf: Buffer cursor
+ * \param[in]       val: Value to write
+ */
+static inline void
+lwutil_buf_put_u16_le_unchecked(lwutil_buf_t* buf, uint16_t val) {
+    lwutil_st_u16_le(val, &buf->data[buf->pos]);
+    buf->pos += 2U;
+}
+
+/**
+ * \brief           Write `16-bit` value in little-endian format
+ * \param[in]       buf: Buffer cursor
+ * \param[in]       val: Value to write
+ * \return          `1` on success, `0` otherwise
+ */
+static inline uint8_t
+lwutil_buf_put_u16_le(lwutil_buf_t* buf, uint16_t val) {
+    if (!lwutil_buf_reserve(buf, 2U)) {
+        return 0;
+    }
+    lwutil_buf_put_u16_le_unchecked(buf, val);
+    return 1;
+}
+
+/**
+ * \brief           Read `16-bit` value in little-endian format, without bounds check
+ * \note            Data must be reserved with \ref lwutil_buf_reserve beforehand
+ * \param[in]       buf: Buffer cursor
+ * \return          Read value
+ */
+static inline uint16_t
+lwutil_buf_get_u16_le_unchecked(lwutil_buf_t* buf) {
+    uint16_t val = lwutil_ld_u16_le(&buf->data[buf->pos]);
+    buf->pos += 2U;
+    return val;
+}
+
+/**
+ * \brief           Read `16-bit` value in little-endian format
+ * \param[in]       buf: Buffer cursor
+ * \return          Read value. `0` on error
+ */
+static inline uint16_t
+lwutil_buf_get_u16_le(lwutil_buf_t* buf) {
+    if (!lwutil_buf_reserve(buf, 2U)) {
+        return 0;
+    }
+    return lwutil_buf_get_u16_le_unchecked(buf);
+}
+
+/**
+ * \brief           Write `16-bit` value in big-endian format, without bounds check
+ * \note            Space must be reserved with \ref lwutil_buf_reserve beforehand
+ * \param[in]       buf: Buffer cursor
+ * \param[in]       val: Value to write
+ */
+static inline void
+lwutil_buf_put_u16_be_unchecked(lwutil_buf_t* buf, uint16_t val) {
+    lwutil_st_u16_be(val, &buf->data[buf->pos]);
+    buf->pos += 2U;
+}
+
+/**
+ * \brief           Write `16-bit` value in big-endian format
+ * \param[in]       buf: Buffer cursor
+ * \param[in]       val: Value to write
+ * \return          `1` on success, `0` otherwise
+ */
+static inline uint8_t
+lwutil_buf_put_u16_be(lwutil_buf_t* buf, uint16_t val) {
+    if (!lwutil_buf_reserve(buf, 2U)) {
+        return 0;
+    }
+    lwutil_buf_put_u16_be_unchecked(buf, val);
+    return 1;
+}
+
+/**
+ * \brief           Read `16-bit` value in big-endian format, without bounds check
+ * \note            Data must be reserved with \ref lwutil_buf_reserve beforehand
+ * \param[in]       buf: Buffer cursor
+ * \return          Read value
+ */
+static inline uint16_t
+lwutil_buf_get_u16_be_unchecked(lwutil_buf_t* buf) {
+    uint16_t val = lwutil_ld_u16_be(&buf->data[buf->pos]);
+    buf->pos += 2U;
+    return val;
+}
+
+/**
+ * \brief           Read `16-bit` value in big-endian format
+ * \param[in]       buf: Buffer cursor
+ * \return          Read value. `0` on error
+ */
+static inline uint16_t
+lwutil_buf_get_u16_be(lwutil_buf_t* buf) {
+    if (!lwutil_buf_reserve(buf, 2U)) {
+        return 0;
+    }
+    return lwutil_buf_get_u16_be_unchecked(buf);
+}
+
+/**
+ * \brief           Write `32-bit` value in little-endian format, without bounds check
+ * \note            Space must be reserved with \ref lwutil_buf_reserve beforehand
+ * \param[in]       buf: Buffer cursor
+ * \param[in]       val: Value to write
+ */
+static inline void
+lwutil_buf_put_u32_le_unchecked(lwutil_buf_t* buf, uint32_t val) {
+    lwutil_st_u32_le(val, &buf->data[buf->pos]);
+    buf->pos += 4U;
+}
+
+/**
+ * \brief           Write `32-bit` value in little-endian format
+ * \param[in]       buf: Buffer cursor
+ * \param[in]       val: Value to write
+ * \return          `1` on success, `0` otherwise
+ */
+static inline uint8_t
+lwutil_buf_put_u32_le(lwutil_buf_t* buf, uint32_t val) {
+    if (!lwutil_buf_reserve(buf, 4U)) {
+        return 0;
+    }
+    lwutil_buf_put_u32_le_unchecked(buf, val);
+    return 1;
+}
+
+/**
+ * \brief           Read `32-bit` value in little-endian format, without bounds check
+ * \note            Data must be reserved with \ref lwutil_buf_reserve beforehand
+ * \param[in]       buf: Buffer cursor
+ * \return          Read value
+ */
+static inline uint32_t
+lwutil_buf_get_u32_le_unchecked(lwutil_buf_t* buf) {
+    uint32_t val = lwutil_ld_u32_le(&buf->data[buf->pos]);
+    buf->pos += 4U;
+    return val;
+}
+
+/**
+ * \brief           Read `32-bit` value in little-endian format
+ * \param[in]       buf: Buffer cursor
+ * \return          Read value. `0` on error
+ */
+static inline uint32_t
+lwutil_buf_get_u32_le(lwutil_buf_t* buf) {
+    if (!lwutil_buf_reserve(buf, 4U)) {
+        return 0;
+    }
+    return lwutil_buf_get_u32_le_unchecked(buf);
+}
+
+/**
+ * \brief           Write `32-bit` value in big-endian format, without bounds check
+ * \note            Space must be reserved with \ref lwutil_buf_reserve beforehand
+ * \param[in]       buf: Buffer cursor
+ * \param[in]       val: Value to write
+ */
+static inline void
+lwutil_buf_put_u32_be_unchecked(lwutil_buf_t* buf, uint32_t val) {
+    lwutil_st_u32_be(val, &buf->data[buf->pos]);
+    buf->pos += 4U;
+}
+
+/**
+ * \brief           Write `32-bit` value in big-endian format
+ * \param[in]       buf: Buffer cursor
+ * \param[in]       val: Value to write
+ * \return          `1` on success, `0` otherwise
+ */
+static inline uint8_t
+lwutil_buf_put_u32_be(lwutil_buf_t* buf, uint32_t val) {
+    if (!lwutil_buf_reserve(buf, 4U)) {
+        return 0;
+    }
+    lwutil_buf_put_u32_be_unchecked(buf, val);
+    return 1;
+}
+
+/**
+ * \brief           Read `32-bit` value in big-endian format, without bounds check
+ * \note            Data must be reserved with \ref lwutil_buf_reserve beforehand
+ * \param[in]       buf: Buffer cursor
+ * \return          Read value
+ */
+static inline uint32_t
+lwutil_buf_get_u32_be_unchecked(lwutil_buf_t* buf) {
+    uint32_t val = lwutil_ld_u32_be(&buf->data[buf->pos]);
+    buf->pos += 4U;
+    return val;
+}
+
+/**
+ * \brief           Read `32-bit` value in big-endian format
+ * \param[in]       buf: Buffer cursor
+ * \return          Read value. `0` on error
+ */
+static inline uint32_t
+lwutil_buf_get_u32_be(lwutil_buf_t* buf) {
+    if (!lwutil_buf_reserve(buf, 4U)) {
+        return 0;
+    }
+    return lwutil_buf_get_u32_be_unchecked(buf);
+}
+
+/**
+ * \brief           Write `64-bit` value in little-endian format, without bounds check
+ * \note            Space must be reserved with \ref lwutil_buf_reserve beforehand
+ * \param[in]       buf: Buffer cursor
+ * \param[in]       val: Value to write
+ */
+static inline void
+lwutil_buf_put_u64_le_unchecked(lwutil_buf_t* buf, uint64_t val) {
+    lwutil_st_u64_le(val, &buf->data[buf->pos]);
+    buf->pos += 8U;
+}
+
+/**
+ * \brief           Write `64-bit` value in little-endian format
+ * \param[in]       buf: Buffer cursor
+ * \param[in]       val: Value to write
+ * \return          `1` on success, `0` otherwise
+ */
+static inline uint8_t
+lwutil_buf_put_u64_le(lwutil_buf_t* buf, uint64_t val) {
+    if (!lwutil_buf_reserve(buf, 8U)) {
+        return 0;
+    }
+    lwutil_buf_put_u64_le_unchecked(buf, val);
+    return 1;
+}
+
+/**
+ * \brief           Read `64-bit` value in little-endian format, without bounds check
+ * \note            Data must be reserved with \ref lwutil_buf_reserve beforehand
+ * \param[in]       buf: Buffer cursor
+ * \return          Read value
+ */
+static inline uint64_t
+lwutil_buf_get_u64_le_unchecked(lwutil_buf_t* buf) {
+    uint64_t val = lwutil_ld_u64_le(&buf->data[buf->pos]);
+    buf->pos += 8U;
+    return val;
+}
+
+/**
+ * \brief           Read `64-bit` value in little-endian format
+ * \param[in]       buf: Buffer cursor
+ * \return          Read value. `0` on error
+ */
+static inline uint64_t
+lwutil_buf_get_u64_le(lwutil_buf_t* buf) {
+    if (!lwutil_buf_reserve(buf, 8U)) {
+        return 0;
+    }
+    return lwutil_buf_get_u64_le_unchecked(buf);
+}
+
+/**
+ * \brief           Write `64-bit` value in big-endian format, without bounds check
+ * \note            Space must be reserved with \ref lwutil_buf_reserve beforehand
+ * \param[in]       buf: Buffer cursor
+ * \param[in]       val: Value to write
+ */
+static inline void
+lwutil_buf_put_u64_be_unchecked(lwutil_buf_t* buf, uint64_t val) {
+    lwutil_st_u64_be(val, &buf->data[buf->pos]);
+    buf->pos += 8U;
+}
+
+/**
+ * \brief           Write `64-bit` value in big-endian format
+ * \param[in]       buf: Buffer cursor
+ * \param[in]       val: Value to write
+ * \return          `1` on success, `0` otherwise
+ */
+static inline uint8_t
+lwutil_buf_put_u64_be(lwutil_buf_t* buf, uint64_t val) {
+    if (!lwutil_buf_reserve(buf, 8U)) {
+        return 0;
+    }
+    lwutil_buf_put_u64_be_unchecked(buf, val);
+    return 1;
+}
+
+/**
+ * \brief           Read `64-bit` value in big-endian format, without bounds check
+ * \note            Data must be reserved with \ref lwutil_buf_reserve beforehand
+ * \param[in]       buf: Buffer cursor
+ * \return          Read value
+ */
+static inline uint64_t
+lwutil_buf_get_u64_be_unchecked(lwutil_buf_t* buf) {
+    uint64_t val = lwutil_ld_u64_be(&buf->data[buf->pos]);
+    buf->pos += 8U;
+    return val;
+}
+
+/**
+ * \brief           Read `64-bit` value in big-endian format
+ * \param[in]       buf: Buffer cursor
+ * \return          Read value. `0` on error
+ */
+static inline uint64_t
+lwutil_buf_get_u64_be(lwutil_buf_t* buf) {
+    if (!lwutil_buf_reserve(buf, 8U)) {
+        return 0;
+    }
+    return lwutil_buf_get_u64_be_unchecked(buf);
+}
+
+/**
+ * \brief           Write `32-bit` variable length integer
+ * \param[in]       buf: Buffer cursor
+ * \param[in]       val: Value to write
+ * \return          `1` on success, `0` otherwise
+ */
+static inline uint8_t
+lwutil_buf_put_u32_varint(lwutil_buf_t* buf, uint32_t val) {
+    uint8_t len;
+
+    if (buf->err) {
+        return 0;
+    }
+    len = lwutil_st_u32_varint(val, &buf->data[buf->pos], buf->size - buf->pos);
+    if (len == 0) {
+        buf->err = 1;
+        return 0;
+    }
+    buf->pos += len;
+    return 1;
+}
+
+/**
+ * \brief           Read `32-bit` variable length integer
+ * \param[in]       buf: Buffer cursor
+ * \return          Read value. `0` on error
+ */
+static inline uint32_t
+lwutil_buf_get_u32_varint(lwutil_buf_t* buf) {
+    uint32_t val = 0;
+    uint8_t len;
+
+    if (buf->err) {
+        return 0;
+    }
+    len = lwutil_ld_u32_varint(&buf->data[buf->pos], buf->size - buf->pos, &val);
+    if (len == 0) {
+        buf->err = 1;
+        return 0;
+    }
+    buf->pos += len;
+    return val;
+}
+
+/**
+ * \brief           Write `64-bit` variable length integer
+ * \param[in]       buf: Buffer cursor
+ * \param[in]       val: Value to write
+ * \return          `1` on success, `0` otherwise
+ */
+static inline uint8_t
+lwutil_buf_put_u64_varint(lwutil_buf_t* buf, uint64_t val) {
+    uint8_t len;
+
+    if (buf->err) {
+        return 0;
+    }
+    len = lwutil_st_u64_varint(val, &buf->data[buf->pos], buf->size - buf->pos);
+    if (len == 0) {
+        buf->err = 1;
+        return 0;
+    }
+    buf->pos += len;
+    return 1;
+}
+
+/**
+ * \brief           Read `64-bit` variable length integer
+ * \param[in]       buf: Buffer cursor
+ * \return          Read value. `0` on error
+ */
+static inline uint64_t
+lwutil_buf_get_u64_varint(lwutil_buf_t* buf) {
+    uint64_t val = 0;
+    uint8_t len;
+
+    if (buf->err) {
+        return 0;
+    }
+    len = lwutil_ld_u64_varint(&buf->data[buf->pos], buf->size - buf->pos, &val);
+    if (len == 0) {
+        buf->err = 1;
+        return 0;
+    }
+    buf->pos += len;
+    return val;
+}
+
+/**
+ * \brief           Write signed `32-bit` zigzag-encoded variable length integer
+ * \param[in]       buf: Buffer cursor
+ * \param[in]       val: Value to write
+ * \return          `1` on success, `0` otherwise
+ */
+static inline uint8_t
+lwutil_buf_put_s32_varint(lwutil_buf_t* buf, int32_t val) {
+    uint8_t len;
+
+    if (buf->err) {
+        return 0;
+    }
+    len = lwutil_st_s32_varint(val, &buf->data[buf->pos], buf->size - buf->pos);
+    if (len == 0) {
+        buf->err = 1;
+        return 0;
+    }
+    buf->pos += len;
+    return 1;
+}
+
+/**
+ * \brief           Read signed `32-bit` zigzag-encoded variable length integer
+ * \param[in]       buf: Buffer cursor
+ * \return          Read value. `0` on error
+ */
+static inline int32_t
+lwutil_buf_get_s32_varint(lwutil_buf_t* buf) {
+    int32_t val = 0;
+    uint8_t len;
+
+    if (buf->err) {
+        return 0;
+    }
+    len = lwutil_ld_s32_varint(&buf->data[buf->pos], buf->size - buf->pos, &val);
+    if (len == 0) {
+        buf->err = 1;
+        return 0;
+    }
+    buf->pos += len;
+    return val;
+}
+
+/**
+ * \brief           Write signed `64-bit` zigzag-encoded variable length integer
+ * \param[in]       buf: Buffer cursor
+ * \param[in]       val: Value to write
+ * \return          `1` on success, `0` otherwise
+ */
+static inline uint8_t
+lwutil_buf_put_s64_varint(lwutil_buf_t* buf, int64_t val) {
+    uint8_t len;
+
+    if (buf->err) {
+        return 0;
+    }
+    len = lwutil_st_s64_varint(val, &buf->data[buf->pos], buf->size - buf->pos);
+    if (len == 0) {
+        buf->err = 1;
+        return 0;
+    }
+    buf->pos += len;
+    return 1;
+}
+
+/**
+ * \brief           Read signed `64-bit` zigzag-encoded variable length integer
+ * \param[in]       buf: Buffer cursor
+ * \return          Read value. `0` on error
+ */
+static inline int64_t
+lwutil_buf_get_s64_varint(lwutil_buf_t* buf) {
+    int64_t val = 0;
+    uint8_t len;
+
+    if (buf->err) {
+        return 0;
+    }
+    len = lwutil_ld_s64_varint(&buf->data[buf->pos], buf->size - buf->pos, &val);
+    if (len == 0) {
+        buf->err = 1;
+        return 0;
+    }
+    buf->pos += len;
+    return val;
+}
+
+/**
+ * \}
+ */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* LWUTIL_BUF_HDR_H */
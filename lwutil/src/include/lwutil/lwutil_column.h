@@ -0,0 +1,110 @@
+/**
+ * \file            lwutil_column.h
+ * \brief           Integer column codec
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwUTIL - Lightweight utility library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v1.3.0
+ */
+#ifndef LWUTIL_COLUMN_HDR_H
+#define LWUTIL_COLUMN_HDR_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "lwutil/lwutil.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \defgroup        LWUTIL_COLUMN Integer column codec
+ * \brief           Block codec for arrays of integers with delta, zigzag and bit-packing
+ * \{
+ *
+ * Array is split to blocks of \ref LWUTIL_COLUMN_BLOCK values.
+ * Values of every block are optionally replaced by differences to the previous value (\ref LWUTIL_COLUMN_DELTA),
+ * optionally zigzag-encoded, so that small negative numbers become small positive ones (\ref LWUTIL_COLUMN_ZIGZAG),
+ * and then reduced by the minimal value of the block (frame of reference).
+ * Results are stored with the minimal number of bits, needed for the largest of them.
+ * Sorted timestamps with constant interval, for example, need `0` bits per value.
+ *
+ * Every block starts with a header, written in little-endian format:
+ *
+ *  - `16-bit` number of values in the block, from `1` to \ref LWUTIL_COLUMN_BLOCK
+ *  - `16-bit` descriptor, with bit width in bits `0-6`, \ref lwutil_column_flag_t flags in bits `8-9`
+ *      and bit `15` set for `64-bit` values
+ *  - Reference value, `32-bit` or `64-bit`
+ *  - Value before the first one, `32-bit` or `64-bit`, only with \ref LWUTIL_COLUMN_DELTA.
+ *      It is extrapolated from the first two values of the block, so that constant interval
+ *      gives `0` bits per value. Every block is therefore decoded on its own
+ *
+ * Header is followed by packed values. Value `i` is stored in `32-bit` lane `i % 4`,
+ * as field `i / 4` of the lane, and lanes are interleaved by `32-bit` words.
+ * Full block of width `w` takes `16 * w` bytes, and every row of `4` values is unpacked
+ * with a few `128-bit` shift and mask operations.
+ * Last block may hold fewer values, and is padded with zeros to complete row.
+ *
+ * When SSSE3 or higher instruction set is supported by the CPU, full blocks of `32-bit` values
+ * are packed and unpacked with vector instructions, together with the inverse transforms.
+ */
+
+#define LWUTIL_COLUMN_BLOCK 128U /*!< Maximal number of values per block */
+
+/**
+ * \brief           Transform flags, applied before bit-packing
+ */
+typedef enum {
+    LWUTIL_COLUMN_DELTA = 0x01,  /*!< Store differences of consecutive values, for sorted data */
+    LWUTIL_COLUMN_ZIGZAG = 0x02, /*!< Zigzag-encode values, for signed data or differences of unsorted data */
+} lwutil_column_flag_t;
+
+LWUTIL_API size_t lwutil_column_bound_u32(size_t count);
+LWUTIL_API size_t lwutil_column_bound_u64(size_t count);
+LWUTIL_API size_t lwutil_column_enc_u32(const uint32_t* vals, size_t count, uint8_t flags, void* out, size_t out_size);
+LWUTIL_API size_t lwutil_column_enc_u64(const uint64_t* vals, size_t count, uint8_t flags, void* out, size_t out_size);
+LWUTIL_API size_t lwutil_column_count(const void* data, size_t len);
+LWUTIL_API size_t lwutil_column_dec_u32(const void* data, size_t len, uint32_t* vals_out, size_t vals_max);
+LWUTIL_API size_t lwutil_column_dec_u64(const void* data, size_t len, uint64_t* vals_out, size_t vals_max);
+
+/**
+ * \}
+ */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+/* Include implementation in header-only mode */
+#if LWUTIL_CFG_HEADER_ONLY && !defined(LWUTIL_HEADER_ONLY_IMPL)
+#define LWUTIL_HEADER_ONLY_IMPL
+#include "../../lwutil/lwutil_column.c"
+#undef LWUTIL_HEADER_ONLY_IMPL
+#endif /* LWUTIL_CFG_HEADER_ONLY && !defined(LWUTIL_HEADER_ONLY_IMPL) */
+
+#endif /* LWUTIL_COLUMN_HDR_H */
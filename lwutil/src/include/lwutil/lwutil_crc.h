@@ -0,0 +1,103 @@
+/**
+ * \file            lwutil_crc.h
+ * \brief           Cyclic redundancy check
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwUTIL - Lightweight utility library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v1.3.0
+ */
+#ifndef LWUTIL_CRC_HDR_H
+#define LWUTIL_CRC_HDR_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "lwutil/lwutil.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \defgroup        LWUTIL_CRC Cyclic redundancy check
+ * \brief           CRC-16, CRC-32 and CRC-32C checksums
+ * \{
+ *
+ * Checksum is calculated in one call with \ref lwutil_crc_calc,
+ * or in multiple chunks with \ref lwutil_crc_init, \ref lwutil_crc_update and \ref lwutil_crc_final.
+ * Checksums of consecutive chunks, calculated independently, for example in parallel,
+ * are joined to checksum of the whole data with \ref lwutil_crc_combine.
+ *
+ * Data is processed with slicing-by-8 tables, `8` bytes per step.
+ * With AVX2 SIMD level, CRC-32 is calculated with PCLMULQDQ folding of `64-byte` blocks
+ * and CRC-32C with SSE4.2 `crc32` instruction, on `3` interleaved streams.
+ * Kernels are used only when the CPU reports support for their instructions, PCLMULQDQ for CRC-32,
+ * and SSE4.2 with PCLMULQDQ for CRC-32C. Otherwise table lookups are used.
+ *
+ * Set \ref LWUTIL_CFG_CRC_SLICING_BY_8 to `0` to use single `256`-entry table per algorithm,
+ * processing `1` byte per step, for smaller memory footprint.
+ */
+
+/**
+ * \brief           CRC algorithm
+ */
+typedef enum {
+    LWUTIL_CRC_16_CCITT = 0, /*!< CRC-16/CCITT-FALSE, polynomial `0x1021`, init `0xFFFF`, not reflected */
+    LWUTIL_CRC_32 = 1,       /*!< CRC-32 (Ethernet, zlib), polynomial `0x04C11DB7`, reflected */
+    LWUTIL_CRC_32C = 2,      /*!< CRC-32C (Castagnoli, iSCSI), polynomial `0x1EDC6F41`, reflected */
+} lwutil_crc_type_t;
+
+/**
+ * \brief           Streaming CRC calculation structure
+ */
+typedef struct {
+    uint32_t reg;           /*!< CRC register, before final XOR */
+    lwutil_crc_type_t type; /*!< CRC algorithm */
+} lwutil_crc_t;
+
+LWUTIL_API uint8_t lwutil_crc_init(lwutil_crc_t* crc, lwutil_crc_type_t type);
+LWUTIL_API uint8_t lwutil_crc_update(lwutil_crc_t* crc, const void* data, size_t len);
+LWUTIL_API uint32_t lwutil_crc_final(const lwutil_crc_t* crc);
+LWUTIL_API uint32_t lwutil_crc_calc(lwutil_crc_type_t type, const void* data, size_t len);
+LWUTIL_API uint32_t lwutil_crc_combine(lwutil_crc_type_t type, uint32_t crc1, uint32_t crc2, size_t len2);
+
+/**
+ * \}
+ */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+/* Include implementation in header-only mode */
+#if LWUTIL_CFG_HEADER_ONLY && !defined(LWUTIL_HEADER_ONLY_IMPL)
+#define LWUTIL_HEADER_ONLY_IMPL
+#include "../../lwutil/lwutil_crc.c"
+#undef LWUTIL_HEADER_ONLY_IMPL
+#endif /* LWUTIL_CFG_HEADER_ONLY && !defined(LWUTIL_HEADER_ONLY_IMPL) */
+
+#endif /* LWUTIL_CRC_HDR_H */
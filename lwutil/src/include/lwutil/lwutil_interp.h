@@ -0,0 +1,122 @@
+/**
+ * \file            lwutil_interp.h
+ * \brief           Piecewise-linear interpolation table
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwUTIL - Lightweight utility library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v1.3.0
+ */
+#ifndef LWUTIL_INTERP_HDR_H
+#define LWUTIL_INTERP_HDR_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "lwutil/lwutil.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \defgroup        LWUTIL_INTERP Interpolation table
+ * \brief           Piecewise-linear interpolation between breakpoints, for sensor linearization
+ * \{
+ *
+ * Table is built once from breakpoints by \ref lwutil_interp_init.
+ * Every segment between two breakpoints stores its start point and fixed-point slope,
+ * so single sample costs segment look-up and one multiplication, with no division.
+ *
+ * When breakpoints are equally spaced, segment index is calculated directly,
+ * with multiplication by the reciprocal of the spacing.
+ * Otherwise segment is found with branchless binary search.
+ *
+ * Slope of every segment has its own number of fractional bits, and at least `29` significant bits.
+ * Within the breakpoint range, results are rounded to nearest and differ from exact interpolation by less than `1`,
+ * when outputs of neighbouring breakpoints differ by less than `2^29`. Values at breakpoints are exact.
+ * Outside the range, first and last segments are extrapolated, unless input is constrained.
+ *
+ * \code{.c}
+static const int32_t adc[] = {0, 1000, 2000, 3000, 4095};
+static const int32_t temp[] = {-400, -50, 250, 700, 1500};
+static lwutil_interp_seg_t segs[LWUTIL_ASZ(adc) - 1U];
+lwutil_interp_t tbl;
+
+lwutil_interp_init(&tbl, segs, adc, temp, LWUTIL_ASZ(adc));
+lwutil_interp_s16_array(&tbl, samples, temps, count, 1);
+ * \endcode
+ */
+
+/**
+ * \brief           Segment of the table, between two breakpoints
+ *
+ * Segment holds everything needed to interpolate within it, in `16` bytes,
+ * so evaluation touches the same memory as the last step of the search.
+ */
+typedef struct {
+    int32_t x;     /*!< Input value at segment start */
+    int32_t y;     /*!< Output value at segment start */
+    int32_t slope; /*!< Fixed-point slope, `(y_next - y) / (x_next - x) * 2^shift` */
+    uint8_t shift; /*!< Number of fractional bits of the slope */
+} lwutil_interp_seg_t;
+
+/**
+ * \brief           Interpolation table structure
+ */
+typedef struct {
+    const lwutil_interp_seg_t* segs; /*!< Segments, one less than number of breakpoints */
+    size_t seg_cnt;                  /*!< Number of segments */
+    int32_t x_min;                   /*!< Input value of the first breakpoint */
+    int32_t x_max;                   /*!< Input value of the last breakpoint */
+    uint32_t step;                   /*!< Spacing of equally spaced breakpoints, `0` if spacing varies */
+    uint64_t step_inv;               /*!< `2^32 / step`, rounded down, for segment index calculation */
+} lwutil_interp_t;
+
+LWUTIL_API uint8_t lwutil_interp_init(lwutil_interp_t* it, lwutil_interp_seg_t* segs, const int32_t* xs,
+                                      const int32_t* ys, size_t count);
+LWUTIL_API int32_t lwutil_interp_s32(const lwutil_interp_t* it, int32_t x);
+LWUTIL_API void lwutil_interp_s16_array(const lwutil_interp_t* it, const int16_t* in, int16_t* out, size_t count,
+                                        uint8_t constrain);
+LWUTIL_API void lwutil_interp_s32_array(const lwutil_interp_t* it, const int32_t* in, int32_t* out, size_t count,
+                                        uint8_t constrain);
+
+/**
+ * \}
+ */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+/* Include implementation in header-only mode */
+#if LWUTIL_CFG_HEADER_ONLY && !defined(LWUTIL_HEADER_ONLY_IMPL)
+#define LWUTIL_HEADER_ONLY_IMPL
+#include "../../lwutil/lwutil_interp.c"
+#undef LWUTIL_HEADER_ONLY_IMPL
+#endif /* LWUTIL_CFG_HEADER_ONLY && !defined(LWUTIL_HEADER_ONLY_IMPL) */
+
+#endif /* LWUTIL_INTERP_HDR_H */
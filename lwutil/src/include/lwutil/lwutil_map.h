@@ -0,0 +1,104 @@
+/**
+ * \file            lwutil_map.h
+ * \brief           Precomputed fixed-point range mapper
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwUTIL - Lightweight utility library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v1.3.0
+ */
+#ifndef LWUTIL_MAP_HDR_H
+#define LWUTIL_MAP_HDR_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "lwutil/lwutil.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \defgroup        LWUTIL_MAPPER Range mapper
+ * \brief           Precomputed range mapper for arrays of samples
+ * \{
+ *
+ * Mapper performs the same calculation as \ref LWUTIL_MAP macro,
+ * but the division is replaced with multiplication by fixed-point scale,
+ * precomputed once by \ref lwutil_map_init.
+ *
+ * Scale has at least `30` significant bits. Integer results are truncated toward zero, like integer division,
+ * and differ from exact \ref LWUTIL_MAP result (calculated without overflow) by at most `1`,
+ * when `|x - in_min| * |out_max - out_min| / |in_max - in_min|` is lower than `2^30`.
+ * When ratio of the ranges is exactly representable (power of `2` for example), results are exact.
+ *
+ * Floating-point arrays use `(x - in_min) * scale + out_min`, with single precision scale.
+ */
+
+/**
+ * \brief           Range mapper structure
+ */
+typedef struct {
+    int32_t in_min;    /*!< Minimum value of input range */
+    int32_t out_min;   /*!< Minimum value of output range */
+    int32_t scale;     /*!< Fixed-point scale, `(out_max - out_min) / (in_max - in_min) * 2^shift` */
+    uint8_t shift;     /*!< Number of fractional bits of the scale */
+    uint8_t s16_fast;  /*!< Set to `1` when `16-bit` samples can be mapped in `32-bit` lanes */
+    int32_t lo;        /*!< Lower output value, used to constrain output */
+    int32_t hi;        /*!< Higher output value, used to constrain output */
+    float in_min_f;    /*!< Minimum value of input range for floating-point arrays */
+    float out_min_f;   /*!< Minimum value of output range for floating-point arrays */
+    float scale_f;     /*!< Scale for floating-point arrays */
+    float lo_f;        /*!< Lower output value for floating-point arrays */
+    float hi_f;        /*!< Higher output value for floating-point arrays */
+} lwutil_map_t;
+
+LWUTIL_API uint8_t lwutil_map_init(lwutil_map_t* map, int32_t in_min, int32_t in_max, int32_t out_min, int32_t out_max);
+LWUTIL_API int32_t lwutil_map_s32(const lwutil_map_t* map, int32_t x);
+LWUTIL_API void lwutil_map_s16_array(const lwutil_map_t* map, const int16_t* in, int16_t* out, size_t count,
+                                     uint8_t constrain);
+LWUTIL_API void lwutil_map_s32_array(const lwutil_map_t* map, const int32_t* in, int32_t* out, size_t count,
+                                     uint8_t constrain);
+LWUTIL_API void lwutil_map_f32_array(const lwutil_map_t* map, const float* in, float* out, size_t count,
+                                     uint8_t constrain);
+
+/**
+ * \}
+ */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+/* Include implementation in header-only mode */
+#if LWUTIL_CFG_HEADER_ONLY && !defined(LWUTIL_HEADER_ONLY_IMPL)
+#define LWUTIL_HEADER_ONLY_IMPL
+#include "../../lwutil/lwutil_map.c"
+#undef LWUTIL_HEADER_ONLY_IMPL
+#endif /* LWUTIL_CFG_HEADER_ONLY && !defined(LWUTIL_HEADER_ONLY_IMPL) */
+
+#endif /* LWUTIL_MAP_HDR_H */
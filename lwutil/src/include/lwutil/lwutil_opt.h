@@ -0,0 +1,174 @@
+/**
+ * \file            lwutil_opt.h
+ * \brief           LwUTIL options
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwUTIL - Lightweight utility library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v1.3.0
+ */
+#ifndef LWUTIL_OPT_HDR_H
+#define LWUTIL_OPT_HDR_H
+
+/* Uncomment to ignore user options (or set macro in compiler flags) */
+/* #define LWUTIL_IGNORE_USER_OPTS */
+
+/* Include application options, when available */
+#ifndef LWUTIL_IGNORE_USER_OPTS
+#if defined(__has_include)
+#if __has_include("lwutil_opts.h")
+#include "lwutil_opts.h"
+#endif /* __has_include("lwutil_opts.h") */
+#else
+#include "lwutil_opts.h"
+#endif /* defined(__has_include) */
+#endif /* LWUTIL_IGNORE_USER_OPTS */
+
+/**
+ * \defgroup        LWUTIL_OPT Configuration
+ * \brief           LwUTIL options
+ * \{
+ */
+
+/**
+ * \brief           Enables `1` or disables `0` header-only mode
+ *
+ * When enabled, implementation of all the functions is included by the \ref lwutil.h header,
+ * and every function becomes `static inline`, with force-inline attribute.
+ * This allows the compiler to inline encoders and decoders into application loops,
+ * without link-time optimization. Source file can still be compiled, it does not produce any code.
+ *
+ * \note            Library directory structure must be kept, as `lwutil.c` is included relative to the header
+ */
+#ifndef LWUTIL_CFG_HEADER_ONLY
+#define LWUTIL_CFG_HEADER_ONLY 0
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` `NULL` pointer checks of input parameters
+ *
+ * When disabled, functions do not check their pointer parameters,
+ * which removes the branches from the hot path in release builds.
+ * Array length checks are always kept.
+ */
+#ifndef LWUTIL_CFG_PARAM_CHECK
+#define LWUTIL_CFG_PARAM_CHECK 1
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` runtime selection of SIMD kernels
+ *
+ * When enabled on x86 targets (GCC, Clang or MSVC), all SSSE3, SSE4.1 and AVX2 kernels
+ * are compiled regardless of the compiler flags and the best one is selected
+ * after CPU features are detected on first use.
+ * Generic build can therefore use the fast paths on every host it runs on.
+ *
+ * When disabled, only kernels enabled by the compiler flags (`-mssse3`, `-msse4.1`, `-mavx2`) are used.
+ */
+#ifndef LWUTIL_CFG_SIMD_DISPATCH
+#define LWUTIL_CFG_SIMD_DISPATCH 1
+#endif
+
+/**
+ * \brief           Highest SIMD level to use, with value of \ref lwutil_simd_t enumeration
+ *
+ * Set to `-1` to use the best level supported by the CPU.
+ * Set to lower value to force slower kernels, for testing and benchmarking.
+ * Level is never raised above the one supported by the CPU.
+ *
+ * Can be set with `LWUTIL_COMPILE_DEFINITIONS` CMake variable, for example `LWUTIL_CFG_SIMD_LEVEL=0`
+ * for scalar code only. See also \ref lwutil_simd_set_level for runtime selection.
+ */
+#ifndef LWUTIL_CFG_SIMD_LEVEL
+#define LWUTIL_CFG_SIMD_LEVEL -1
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` slicing-by-8 tables for CRC calculation
+ *
+ * When enabled, every CRC algorithm uses `8` tables with `256` entries, processing `8` bytes per step.
+ * When disabled, single table is used per algorithm, processing `1` byte per step,
+ * which saves `17.5 kB` of constant data.
+ */
+#ifndef LWUTIL_CFG_CRC_SLICING_BY_8
+#define LWUTIL_CFG_CRC_SLICING_BY_8 1
+#endif
+
+/**
+ * \brief           Cache line size in units of bytes
+ *
+ * Padding of this size is placed between fields, written by different threads,
+ * so that they never share a cache line.
+ */
+#ifndef LWUTIL_CFG_CACHE_LINE
+#define LWUTIL_CFG_CACHE_LINE 64
+#endif
+
+/**
+ * \brief           Cache line size in units of bytes, used to separate producer and consumer fields of the ring buffer
+ */
+#ifndef LWUTIL_CFG_RING_CACHE_LINE
+#define LWUTIL_CFG_RING_CACHE_LINE LWUTIL_CFG_CACHE_LINE
+#endif
+
+#ifdef __DOXYGEN__
+/**
+ * \brief           Yield the processor, while \ref LWUTIL_RING_MPSC producer waits for earlier producers to commit
+ *
+ * When not defined, `SwitchToThread` is used on Windows, `sched_yield` on POSIX systems,
+ * and CPU spin-wait hint elsewhere. Define it to the RTOS yield or delay function on embedded targets.
+ */
+#define LWUTIL_CFG_RING_YIELD()
+#endif /* __DOXYGEN__ */
+
+/**
+ * \brief           Enables `1` or disables `0` instrumentation counters
+ *
+ * When enabled, instrumented functions count calls, processed bytes and errors,
+ * and varint decoders count decoded values by their length, see \ref lwutil_stats_snapshot.
+ * When disabled, instrumentation is compiled out and has no cost.
+ */
+#ifndef LWUTIL_CFG_STATS
+#define LWUTIL_CFG_STATS 0
+#endif
+
+/**
+ * \brief           Number of counter slots, used by instrumentation counters
+ *
+ * First `LWUTIL_CFG_STATS_SLOTS - 1` threads use their own slot, separated from the others
+ * by \ref LWUTIL_CFG_CACHE_LINE bytes. Remaining threads share the last slot and update it
+ * with atomic additions, which is slower.
+ */
+#ifndef LWUTIL_CFG_STATS_SLOTS
+#define LWUTIL_CFG_STATS_SLOTS 16
+#endif
+
+/**
+ * \}
+ */
+
+#endif /* LWUTIL_OPT_HDR_H */
@@ -0,0 +1,168 @@
+/**
+ * \file            lwutil_private.h
+ * \brief           Private definitions, shared between library modules
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwUTIL - Lightweight utility library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v1.3.0
+ */
+#ifndef LWUTIL_PRIVATE_HDR_H
+#define LWUTIL_PRIVATE_HDR_H
+
+#include <stdint.h>
+#include "lwutil/lwutil_opt.h"
+
+/*
+ * Highest x86 SIMD level compiled into the library, with values of \ref lwutil_simd_t.
+ *
+ * With runtime dispatch, all kernels are compiled with function target attributes
+ * and selected once, after CPU features are detected.
+ * Otherwise only kernels enabled by the compiler flags are compiled.
+ */
+#if LWUTIL_CFG_SIMD_DISPATCH && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define LWUTIL_SIMD_DISPATCH 1
+#define LWUTIL_SIMD_MAX      3
+#define LWUTIL_TARGET(isa)   __attribute__((target(isa)))
+#elif LWUTIL_CFG_SIMD_DISPATCH && defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define LWUTIL_SIMD_DISPATCH 1
+#define LWUTIL_SIMD_MAX      3
+#define LWUTIL_TARGET(isa)
+#else
+#if defined(__AVX2__)
+#define LWUTIL_SIMD_MAX 3
+#elif defined(__SSE4_1__)
+#define LWUTIL_SIMD_MAX 2
+#elif defined(__SSSE3__)
+#define LWUTIL_SIMD_MAX 1
+#else
+#define LWUTIL_SIMD_MAX 0
+#endif
+#define LWUTIL_TARGET(isa)
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif /* defined(_MSC_VER) */
+#if LWUTIL_SIMD_MAX > 0
+#include <immintrin.h>
+#endif /* LWUTIL_SIMD_MAX > 0 */
+
+/* Parameter check, compiled out when disabled in configuration */
+#if LWUTIL_CFG_PARAM_CHECK
+#define LWUTIL_IS_NULL(ptr) ((ptr) == NULL)
+#else
+#define LWUTIL_IS_NULL(ptr) 0
+#endif /* LWUTIL_CFG_PARAM_CHECK */
+
+/* Instrumentation counters, compiled out when disabled in configuration */
+#if LWUTIL_CFG_STATS
+#define LWUTIL_STATS_ADD(fn, bytes, err) lwutil_stats_record((fn), (size_t)(bytes), (uint8_t)((err) != 0))
+#else
+#define LWUTIL_STATS_ADD(fn, bytes, err)
+#endif /* LWUTIL_CFG_STATS */
+
+/* Host byte order, when known at compile time */
+#if (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || defined(_M_IX86) || defined(_M_X64)     \
+    || defined(_M_ARM64)
+#define LWUTIL_HOST_LE 1
+#elif defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define LWUTIL_HOST_BE 1
+#endif
+
+/**
+ * \brief           Count trailing zero bits in the non-zero `32-bit` value
+ * \param[in]       val: Value to count zeros in. Must not be `0`
+ * \return          Number of trailing zero bits
+ */
+static inline uint32_t
+prv_ctz32(uint32_t val) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t)__builtin_ctz(val);
+#elif defined(_MSC_VER)
+    unsigned long idx;
+    _BitScanForward(&idx, val);
+    return (uint32_t)idx;
+#else
+    uint32_t cnt = 0;
+    for (; (val & 0x01U) == 0; val >>= 1U, ++cnt) {}
+    return cnt;
+#endif
+}
+
+/**
+ * \brief           Count trailing zero bits in the non-zero `64-bit` value
+ * \param[in]       val: Value to count zeros in. Must not be `0`
+ * \return          Number of trailing zero bits
+ */
+static inline uint32_t
+prv_ctz64(uint64_t val) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t)__builtin_ctzll(val);
+#else
+    return (uint32_t)val != 0 ? prv_ctz32((uint32_t)val) : (32U + prv_ctz32((uint32_t)(val >> 32U)));
+#endif
+}
+
+/**
+ * \brief           Get index of the most significant set bit in the non-zero `64-bit` value
+ * \param[in]       val: Value to check. Must not be `0`
+ * \return          Bit index, `0` for the least significant bit
+ */
+static inline uint32_t
+prv_msb64(uint64_t val) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63U - (uint32_t)__builtin_clzll(val);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long idx;
+    _BitScanReverse64(&idx, val);
+    return (uint32_t)idx;
+#else
+    uint32_t idx = 0;
+    for (; val > 1U; val >>= 1U, ++idx) {}
+    return idx;
+#endif
+}
+
+/**
+ * \brief           Count set bits in the `64-bit` value
+ * \param[in]       val: Value to count bits in
+ * \return          Number of set bits
+ */
+static inline uint32_t
+prv_popcount64(uint64_t val) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t)__builtin_popcountll(val);
+#else
+    val = val - ((val >> 1U) & UINT64_C(0x5555555555555555));
+    val = (val & UINT64_C(0x3333333333333333)) + ((val >> 2U) & UINT64_C(0x3333333333333333));
+    val = (val + (val >> 4U)) & UINT64_C(0x0F0F0F0F0F0F0F0F);
+    return (uint32_t)((val * UINT64_C(0x0101010101010101)) >> 56U);
+#endif
+}
+
+#endif /* LWUTIL_PRIVATE_HDR_H */
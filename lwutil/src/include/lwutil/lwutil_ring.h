@@ -0,0 +1,155 @@
+/**
+ * \file            lwutil_ring.h
+ * \brief           Lock-free record ring buffer
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwUTIL - Lightweight utility library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v1.3.0
+ */
+#ifndef LWUTIL_RING_HDR_H
+#define LWUTIL_RING_HDR_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "lwutil/lwutil.h"
+
+#ifdef __cplusplus
+#include <atomic>
+#else
+#include <stdatomic.h>
+#endif /* __cplusplus */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \defgroup        LWUTIL_RING Record ring buffer
+ * \brief           Lock-free ring buffer of variable-length records
+ * \{
+ *
+ * Ring buffer transfers variable-length records between threads, without locks.
+ * Every record is prefixed with varint length header, and is stored in one contiguous block,
+ * so that producer encodes the frame directly into the ring and consumer decodes it in place.
+ *
+ * Producer calls \ref lwutil_ring_reserve to get space for up to `len` bytes,
+ * writes the data and publishes the record with \ref lwutil_ring_commit,
+ * with final length that may be shorter than reserved one.
+ * Consumer gets the oldest record with \ref lwutil_ring_peek and frees it with \ref lwutil_ring_release.
+ * \ref lwutil_ring_write and \ref lwutil_ring_read are copying shortcuts of both pairs.
+ *
+ * In \ref LWUTIL_RING_SPSC mode, one producer and one consumer thread may access the ring at the same time.
+ * In \ref LWUTIL_RING_MPSC mode, any number of producers claim the space with atomic compare-and-swap operation.
+ * Records are published in the order of reservation, so producer waits in \ref lwutil_ring_commit
+ * for every earlier reservation to be committed. Every reservation must therefore be committed
+ * or cancelled with \ref lwutil_ring_cancel, without delay.
+ *
+ * Indexes written by producers and by consumer are kept in separate cache lines,
+ * with size set by \ref LWUTIL_CFG_RING_CACHE_LINE, and each side keeps a cached copy of the other side's index.
+ *
+ * Record of `n` bytes is stored with varint header of value `n + 2`.
+ * Header value `0` marks unused space at the end of the array, when the record did not fit before wrap-around,
+ * and value `1` marks single byte of padding, left in \ref LWUTIL_RING_MPSC mode by records committed
+ * shorter than reserved. Record with its header of up to half of the array size always fits into empty ring.
+ *
+ * Atomic indexes use C11 `stdatomic.h` in C, and `std::atomic` in C++,
+ * which both have the same layout on supported compilers.
+ */
+
+/**
+ * \brief           Atomic index type
+ */
+#ifdef __cplusplus
+typedef std::atomic<size_t> lwutil_ring_atomic_t;
+#else
+typedef atomic_size_t lwutil_ring_atomic_t;
+#endif /* __cplusplus */
+
+/**
+ * \brief           Producer mode
+ */
+typedef enum {
+    LWUTIL_RING_SPSC = 0, /*!< Single producer, single consumer */
+    LWUTIL_RING_MPSC = 1, /*!< Multiple producers, single consumer */
+} lwutil_ring_mode_t;
+
+/**
+ * \brief           Ring buffer structure
+ */
+typedef struct {
+    uint8_t* data;                            /*!< Pointer to data array */
+    size_t size;                              /*!< Size of data array, power of `2` */
+    lwutil_ring_mode_t mode;                  /*!< Producer mode */
+    uint8_t pad0[LWUTIL_CFG_RING_CACHE_LINE]; /*!< Padding between read-only and producer fields */
+    lwutil_ring_atomic_t head;                /*!< Write index, claimed by producers */
+    lwutil_ring_atomic_t commit;              /*!< Write index, published to the consumer */
+    size_t tail_cache;                        /*!< Last read index seen by single producer */
+    uint8_t pad1[LWUTIL_CFG_RING_CACHE_LINE]; /*!< Padding between producer and consumer fields */
+    lwutil_ring_atomic_t tail;                /*!< Read index, released by the consumer */
+    size_t rd_pos;                            /*!< Read index of the record, returned by peek */
+    size_t rd_end;                            /*!< Read index after the record, returned by peek */
+    size_t commit_cache;                      /*!< Last published write index seen by consumer */
+    uint8_t pad2[LWUTIL_CFG_RING_CACHE_LINE]; /*!< Padding after consumer fields */
+} lwutil_ring_t;
+
+/**
+ * \brief           Record reservation, filled by \ref lwutil_ring_reserve
+ */
+typedef struct {
+    uint8_t* data;   /*!< Pointer to record data, to be written by the producer */
+    size_t len;      /*!< Reserved record length in units of bytes */
+    size_t start;    /*!< Write index at the start of reservation */
+    size_t end;      /*!< Write index at the end of reservation */
+    uint8_t hdr_len; /*!< Length of record header in units of bytes */
+} lwutil_ring_rsv_t;
+
+LWUTIL_API uint8_t lwutil_ring_init(lwutil_ring_t* ring, void* data, size_t size, lwutil_ring_mode_t mode);
+LWUTIL_API uint8_t lwutil_ring_reserve(lwutil_ring_t* ring, size_t len, lwutil_ring_rsv_t* rsv);
+LWUTIL_API uint8_t lwutil_ring_commit(lwutil_ring_t* ring, const lwutil_ring_rsv_t* rsv, size_t len);
+LWUTIL_API uint8_t lwutil_ring_cancel(lwutil_ring_t* ring, const lwutil_ring_rsv_t* rsv);
+LWUTIL_API uint8_t lwutil_ring_write(lwutil_ring_t* ring, const void* data, size_t len);
+LWUTIL_API const uint8_t* lwutil_ring_peek(lwutil_ring_t* ring, size_t* len_out);
+LWUTIL_API uint8_t lwutil_ring_release(lwutil_ring_t* ring);
+LWUTIL_API uint8_t lwutil_ring_read(lwutil_ring_t* ring, void* out, size_t out_size, size_t* len_out);
+
+/**
+ * \}
+ */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+/* Include implementation in header-only mode */
+#if LWUTIL_CFG_HEADER_ONLY && !defined(LWUTIL_HEADER_ONLY_IMPL)
+#define LWUTIL_HEADER_ONLY_IMPL
+#include "../../lwutil/lwutil_ring.c"
+#undef LWUTIL_HEADER_ONLY_IMPL
+#endif /* LWUTIL_CFG_HEADER_ONLY && !defined(LWUTIL_HEADER_ONLY_IMPL) */
+
+#endif /* LWUTIL_RING_HDR_H */
@@ -0,0 +1,465 @@
+/**
+ * \file            lwutil_schema.h
+ * \brief           Schema-driven struct serializer
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwUTIL - Lightweight utility library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v1.3.0
+ */
+#ifndef LWUTIL_SCHEMA_HDR_H
+#define LWUTIL_SCHEMA_HDR_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lwutil/lwutil.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \defgroup        LWUTIL_SCHEMA Schema serializer
+ * \brief           Encode, decode and length functions generated from single field list
+ * \{
+ *
+ * Record layout is described once, as an X-macro list of `X(type, name)` entries,
+ * and functions are generated from it at compile time:
+ *
+ * \code{.c}
+#define PKT_FIELDS(X)                                                                                                  \
+    X(U8, type)                                                                                                        \
+    X(U16_BE, seq)                                                                                                     \
+    X(U32_LE, timestamp)                                                                                               \
+    X(S32_VARINT, offset)
+
+LWUTIL_SCHEMA_STRUCT(pkt_t, PKT_FIELDS)       // typedef struct { uint8_t type; uint16_t seq; ... } pkt_t;
+LWUTIL_SCHEMA_FUNCS(pkt, pkt_t, PKT_FIELDS)   // pkt_len, pkt_enc and pkt_dec functions
+
+uint8_t frame[LWUTIL_SCHEMA_MAX_LEN(PKT_FIELDS)];
+size_t len = pkt_enc(&pkt, frame, sizeof(frame));
+ * \endcode
+ *
+ * Supported types are `U8`, `U16_LE`, `U16_BE`, `U32_LE`, `U32_BE`, `U64_LE`, `U64_BE`,
+ * `U32_VARINT`, `U64_VARINT`, `S32_VARINT` and `S64_VARINT`, with the same format
+ * as the load and store functions of the same name. Structure members must be of matching C type.
+ *
+ * Encode function performs single bounds check for the whole record, against \ref LWUTIL_SCHEMA_MAX_LEN.
+ * All fields are then stored without further checks, fixed-width ones at constant offsets
+ * up to the first varint field. Shorter output array is served by a separate function,
+ * that encodes to a temporary array and copies the record, if it fits.
+ *
+ * Decode function takes the same unchecked path when input is at least \ref LWUTIL_SCHEMA_MAX_LEN bytes long,
+ * and checks every field otherwise. Only varint fields are verified in the unchecked path.
+ *
+ * With C++17 or later, \ref lwutil::schema template provides the same functions
+ * from a list of \ref lwutil::field types, with identical output.
+ */
+
+/**
+ * \brief           C type, maximal and exact encoded length, store and load operation of each field type
+ * \note            Used internally by the generated functions
+ * \hideinitializer
+ */
+#define LWUTIL_SCHEMA_CTYPE_U8           uint8_t
+#define LWUTIL_SCHEMA_MAX_U8             1U
+#define LWUTIL_SCHEMA_LEN_U8(v)          1U
+#define LWUTIL_SCHEMA_ST_U8(v, p)        ((p)[0] = (uint8_t)(v), 1U)
+#define LWUTIL_SCHEMA_LD_U8(p, rem, v)   ((rem) >= 1U ? (*(v) = (p)[0], 1U) : 0U)
+
+#define LWUTIL_SCHEMA_CTYPE_U16_LE       uint16_t
+#define LWUTIL_SCHEMA_MAX_U16_LE         2U
+#define LWUTIL_SCHEMA_LEN_U16_LE(v)      2U
+#define LWUTIL_SCHEMA_ST_U16_LE(v, p)    (lwutil_st_u16_le((v), (p)), 2U)
+#define LWUTIL_SCHEMA_LD_U16_LE(p, rem, v) ((rem) >= 2U ? (*(v) = lwutil_ld_u16_le(p), 2U) : 0U)
+
+#define LWUTIL_SCHEMA_CTYPE_U16_BE       uint16_t
+#define LWUTIL_SCHEMA_MAX_U16_BE         2U
+#define LWUTIL_SCHEMA_LEN_U16_BE(v)      2U
+#define LWUTIL_SCHEMA_ST_U16_BE(v, p)    (lwutil_st_u16_be((v), (p)), 2U)
+#define LWUTIL_SCHEMA_LD_U16_BE(p, rem, v) ((rem) >= 2U ? (*(v) = lwutil_ld_u16_be(p), 2U) : 0U)
+
+#define LWUTIL_SCHEMA_CTYPE_U32_LE       uint32_t
+#define LWUTIL_SCHEMA_MAX_U32_LE         4U
+#define LWUTIL_SCHEMA_LEN_U32_LE(v)      4U
+#define LWUTIL_SCHEMA_ST_U32_LE(v, p)    (lwutil_st_u32_le((v), (p)), 4U)
+#define LWUTIL_SCHEMA_LD_U32_LE(p, rem, v) ((rem) >= 4U ? (*(v) = lwutil_ld_u32_le(p), 4U) : 0U)
+
+#define LWUTIL_SCHEMA_CTYPE_U32_BE       uint32_t
+#define LWUTIL_SCHEMA_MAX_U32_BE         4U
+#define LWUTIL_SCHEMA_LEN_U32_BE(v)      4U
+#define LWUTIL_SCHEMA_ST_U32_BE(v, p)    (lwutil_st_u32_be((v), (p)), 4U)
+#define LWUTIL_SCHEMA_LD_U32_BE(p, rem, v) ((rem) >= 4U ? (*(v) = lwutil_ld_u32_be(p), 4U) : 0U)
+
+#define LWUTIL_SCHEMA_CTYPE_U64_LE       uint64_t
+#define LWUTIL_SCHEMA_MAX_U64_LE         8U
+#define LWUTIL_SCHEMA_LEN_U64_LE(v)      8U
+#define LWUTIL_SCHEMA_ST_U64_LE(v, p)    (lwutil_st_u64_le((v), (p)), 8U)
+#define LWUTIL_SCHEMA_LD_U64_LE(p, rem, v) ((rem) >= 8U ? (*(v) = lwutil_ld_u64_le(p), 8U) : 0U)
+
+#define LWUTIL_SCHEMA_CTYPE_U64_BE       uint64_t
+#define LWUTIL_SCHEMA_MAX_U64_BE         8U
+#define LWUTIL_SCHEMA_LEN_U64_BE(v)      8U
+#define LWUTIL_SCHEMA_ST_U64_BE(v, p)    (lwutil_st_u64_be((v), (p)), 8U)
+#define LWUTIL_SCHEMA_LD_U64_BE(p, rem, v) ((rem) >= 8U ? (*(v) = lwutil_ld_u64_be(p), 8U) : 0U)
+
+#define LWUTIL_SCHEMA_CTYPE_U32_VARINT   uint32_t
+#define LWUTIL_SCHEMA_MAX_U32_VARINT     5U
+#define LWUTIL_SCHEMA_LEN_U32_VARINT(v)  lwutil_u32_varint_len(v)
+#define LWUTIL_SCHEMA_ST_U32_VARINT(v, p) lwutil_st_u32_varint((v), (p), 5U)
+#define LWUTIL_SCHEMA_LD_U32_VARINT(p, rem, v) lwutil_ld_u32_varint((p), (rem), (v))
+
+#define LWUTIL_SCHEMA_CTYPE_U64_VARINT   uint64_t
+#define LWUTIL_SCHEMA_MAX_U64_VARINT     10U
+#define LWUTIL_SCHEMA_LEN_U64_VARINT(v)  lwutil_u64_varint_len(v)
+#define LWUTIL_SCHEMA_ST_U64_VARINT(v, p) lwutil_st_u64_varint((v), (p), 10U)
+#define LWUTIL_SCHEMA_LD_U64_VARINT(p, rem, v) lwutil_ld_u64_varint((p), (rem), (v))
+
+#define LWUTIL_SCHEMA_CTYPE_S32_VARINT   int32_t
+#define LWUTIL_SCHEMA_MAX_S32_VARINT     5U
+#define LWUTIL_SCHEMA_LEN_S32_VARINT(v)  lwutil_u32_varint_len(lwutil_zigzag_enc_s32(v))
+#define LWUTIL_SCHEMA_ST_S32_VARINT(v, p) lwutil_st_s32_varint((v), (p), 5U)
+#define LWUTIL_SCHEMA_LD_S32_VARINT(p, rem, v) lwutil_ld_s32_varint((p), (rem), (v))
+
+#define LWUTIL_SCHEMA_CTYPE_S64_VARINT   int64_t
+#define LWUTIL_SCHEMA_MAX_S64_VARINT     10U
+#define LWUTIL_SCHEMA_LEN_S64_VARINT(v)  lwutil_u64_varint_len(lwutil_zigzag_enc_s64(v))
+#define LWUTIL_SCHEMA_ST_S64_VARINT(v, p) lwutil_st_s64_varint((v), (p), 10U)
+#define LWUTIL_SCHEMA_LD_S64_VARINT(p, rem, v) lwutil_ld_s64_varint((p), (rem), (v))
+
+/**
+ * \brief           Per-field expansions of the field list
+ * \note            Used internally by the generated functions
+ * \hideinitializer
+ */
+#define LWUTIL_SCHEMA_X_MEMBER(t, n)     LWUTIL_SCHEMA_CTYPE_##t n;
+#define LWUTIL_SCHEMA_X_MAX(t, n)        +LWUTIL_SCHEMA_MAX_##t
+#define LWUTIL_SCHEMA_X_LEN(t, n)        +(size_t)LWUTIL_SCHEMA_LEN_##t(s->n)
+#define LWUTIL_SCHEMA_X_ST(t, n)         p += LWUTIL_SCHEMA_ST_##t(s->n, p);
+#define LWUTIL_SCHEMA_X_LD(t, n)                                                                                       \
+    if ((cnt = LWUTIL_SCHEMA_LD_##t(p, len, &s->n)) == 0) {                                                            \
+        return 0;                                                                                                      \
+    }                                                                                                                  \
+    p += cnt;                                                                                                          \
+    len -= cnt;
+#define LWUTIL_SCHEMA_X_LD_UNCHECKED(t, n)                                                                             \
+    if ((cnt = LWUTIL_SCHEMA_LD_##t(p, LWUTIL_SCHEMA_MAX_##t, &s->n)) == 0) {                                          \
+        return 0;                                                                                                      \
+    }                                                                                                                  \
+    p += cnt;
+
+/**
+ * \brief           Get maximal encoded length of the record, as constant expression
+ * \param[in]       fields: Field list macro
+ * \return          Maximal length in units of bytes
+ * \hideinitializer
+ */
+#define LWUTIL_SCHEMA_MAX_LEN(fields)    ((size_t)(0 fields(LWUTIL_SCHEMA_X_MAX)))
+
+/**
+ * \brief           Define structure type with one member per field
+ * \param[in]       type: Name of structure type
+ * \param[in]       fields: Field list macro
+ * \hideinitializer
+ */
+#define LWUTIL_SCHEMA_STRUCT(type, fields)                                                                             \
+    typedef struct {                                                                                                   \
+        fields(LWUTIL_SCHEMA_X_MEMBER)                                                                                 \
+    } type
+
+/**
+ * \brief           Define `static inline` length, encode and decode functions of the record
+ *
+ * Following functions are generated, where `prefix` is replaced by the first parameter:
+ *
+ *  - `size_t prefix_len(const type* s)`: Get exact encoded length of the record
+ *  - `size_t prefix_enc(const type* s, void* out, size_t out_size)`: Encode the record.
+ *      Returns number of bytes written, or `0` if output array is too short
+ *  - `size_t prefix_enc_unchecked(const type* s, void* out)`: Encode the record without bounds check.
+ *      Output array must be at least \ref LWUTIL_SCHEMA_MAX_LEN bytes long
+ *  - `size_t prefix_dec(const void* data, size_t len, type* s)`: Decode the record.
+ *      Returns number of bytes consumed, or `0` if input is too short or malformed.
+ *      Content of the structure is undefined on failure
+ *
+ * \param[in]       prefix: Prefix of function names
+ * \param[in]       type: Structure type, with member for every field
+ * \param[in]       fields: Field list macro
+ * \hideinitializer
+ */
+#define LWUTIL_SCHEMA_FUNCS(prefix, type, fields)                                                                      \
+    static inline size_t prefix##_len(const type* s) {                                                                 \
+        LWUTIL_UNUSED(s);                                                                                              \
+        return 0 fields(LWUTIL_SCHEMA_X_LEN);                                                                          \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline size_t prefix##_enc_unchecked(const type* s, void* out) {                                            \
+        uint8_t* p = (uint8_t*)out;                                                                                    \
+                                                                                                                       \
+        fields(LWUTIL_SCHEMA_X_ST)                                                                                     \
+        return (size_t)(p - (uint8_t*)out);                                                                            \
+    }                                                                                                                  \
+                                                                                                                       \
+    static size_t prefix##_enc_short(const type* s, void* out, size_t out_size) {                                      \
+        uint8_t tmp[LWUTIL_SCHEMA_MAX_LEN(fields)];                                                                    \
+        size_t len = prefix##_enc_unchecked(s, tmp);                                                                   \
+                                                                                                                       \
+        if (len > out_size) {                                                                                          \
+            return 0;                                                                                                  \
+        }                                                                                                              \
+        memcpy(out, tmp, len);                                                                                         \
+        return len;                                                                                                    \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline size_t prefix##_enc(const type* s, void* out, size_t out_size) {                                     \
+        if (out_size >= LWUTIL_SCHEMA_MAX_LEN(fields)) {                                                               \
+            return prefix##_enc_unchecked(s, out);                                                                     \
+        }                                                                                                              \
+        return prefix##_enc_short(s, out, out_size);                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline size_t prefix##_dec(const void* data, size_t len, type* s) {                                         \
+        const uint8_t* p = (const uint8_t*)data;                                                                       \
+        size_t cnt;                                                                                                    \
+                                                                                                                       \
+        if (len >= LWUTIL_SCHEMA_MAX_LEN(fields)) {                                                                    \
+            fields(LWUTIL_SCHEMA_X_LD_UNCHECKED)                                                                       \
+        } else {                                                                                                       \
+            fields(LWUTIL_SCHEMA_X_LD)                                                                                 \
+        }                                                                                                              \
+        return (size_t)(p - (const uint8_t*)data);                                                                     \
+    }                                                                                                                  \
+    typedef int prefix##_schema_funcs_t
+
+/**
+ * \}
+ */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#if defined(__cplusplus) && (__cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L))
+
+#include <type_traits>
+
+namespace lwutil {
+
+/**
+ * \addtogroup      LWUTIL_SCHEMA
+ * \{
+ */
+
+/**
+ * \brief           Field codecs, one per supported field type
+ *
+ * Every codec provides value type, maximal encoded length and
+ * length, store and load functions with the same semantics as in the C macros.
+ */
+namespace codec {
+
+#define LWUTIL_SCHEMA_CODEC(name, t)                                                                                   \
+    struct name {                                                                                                      \
+        using type = LWUTIL_SCHEMA_CTYPE_##t;                                                                          \
+        static constexpr size_t max_len = LWUTIL_SCHEMA_MAX_##t;                                                       \
+                                                                                                                       \
+        static size_t                                                                                                  \
+        len(type v) {                                                                                                  \
+            LWUTIL_UNUSED(v);                                                                                          \
+            return LWUTIL_SCHEMA_LEN_##t(v);                                                                           \
+        }                                                                                                              \
+                                                                                                                       \
+        static size_t                                                                                                  \
+        st(type v, uint8_t* p) {                                                                                       \
+            return LWUTIL_SCHEMA_ST_##t(v, p);                                                                         \
+        }                                                                                                              \
+                                                                                                                       \
+        static size_t                                                                                                  \
+        ld(const uint8_t* p, size_t rem, type* v) {                                                                    \
+            return LWUTIL_SCHEMA_LD_##t(p, rem, v);                                                                    \
+        }                                                                                                              \
+    }
+
+LWUTIL_SCHEMA_CODEC(u8, U8);
+LWUTIL_SCHEMA_CODEC(u16_le, U16_LE);
+LWUTIL_SCHEMA_CODEC(u16_be, U16_BE);
+LWUTIL_SCHEMA_CODEC(u32_le, U32_LE);
+LWUTIL_SCHEMA_CODEC(u32_be, U32_BE);
+LWUTIL_SCHEMA_CODEC(u64_le, U64_LE);
+LWUTIL_SCHEMA_CODEC(u64_be, U64_BE);
+LWUTIL_SCHEMA_CODEC(u32_varint, U32_VARINT);
+LWUTIL_SCHEMA_CODEC(u64_varint, U64_VARINT);
+LWUTIL_SCHEMA_CODEC(s32_varint, S32_VARINT);
+LWUTIL_SCHEMA_CODEC(s64_varint, S64_VARINT);
+
+#undef LWUTIL_SCHEMA_CODEC
+
+} /* namespace codec */
+
+/**
+ * \brief           Field of the record, stored with codec `C` from structure member `M`
+ * \tparam          C: Codec from \ref lwutil::codec namespace
+ * \tparam          M: Pointer to structure member, of codec value type
+ */
+template <typename C, auto M>
+struct field {
+    using codec = C;
+    static constexpr auto member = M;
+};
+
+/**
+ * \brief           Record schema of structure `T`, with encode, decode and length functions
+ *
+ * \code{.cpp}
+using pkt_schema = lwutil::schema<pkt_t, lwutil::field<lwutil::codec::u8, &pkt_t::type>,
+                                  lwutil::field<lwutil::codec::u16_be, &pkt_t::seq>>;
+
+uint8_t frame[pkt_schema::max_len];
+size_t len = pkt_schema::enc(pkt, frame, sizeof(frame));
+ * \endcode
+ *
+ * \tparam          T: Structure type
+ * \tparam          F: List of \ref lwutil::field types, in encoding order
+ */
+template <typename T, typename... F>
+struct schema {
+    static_assert(sizeof...(F) > 0, "Schema must have at least one field");
+    static_assert((std::is_same_v<std::remove_reference_t<decltype(std::declval<T&>().*F::member)>,
+                                  typename F::codec::type>
+                   && ...),
+                  "Structure member type must match codec type");
+
+    static constexpr size_t max_len = (F::codec::max_len + ...); /*!< Maximal encoded length in units of bytes */
+
+    /**
+     * \brief           Get exact encoded length of the record
+     * \param[in]       s: Record
+     * \return          Length in units of bytes
+     */
+    static size_t
+    len(const T& s) {
+        return (F::codec::len(s.*F::member) + ...);
+    }
+
+    /**
+     * \brief           Encode the record without bounds check
+     * \param[in]       s: Record
+     * \param[out]      out: Output array, at least \ref max_len bytes long
+     * \return          Number of bytes written
+     */
+    static size_t
+    enc_unchecked(const T& s, void* out) {
+        uint8_t* p = static_cast<uint8_t*>(out);
+
+        ((p += F::codec::st(s.*F::member, p)), ...);
+        return static_cast<size_t>(p - static_cast<uint8_t*>(out));
+    }
+
+    /**
+     * \brief           Encode the record
+     * \param[in]       s: Record
+     * \param[out]      out: Output array
+     * \param[in]       out_size: Size of output array in units of bytes
+     * \return          Number of bytes written, `0` if output array is too short
+     */
+    static size_t
+    enc(const T& s, void* out, size_t out_size) {
+        if (out_size >= max_len) {
+            return enc_unchecked(s, out);
+        }
+        return enc_short(s, out, out_size);
+    }
+
+    /**
+     * \brief           Decode the record
+     * \param[in]       data: Input data
+     * \param[in]       len: Length of input data in units of bytes
+     * \param[out]      s: Record to decode to. Content is undefined on failure
+     * \return          Number of bytes consumed, `0` if input is too short or malformed
+     */
+    static size_t
+    dec(const void* data, size_t len, T& s) {
+        const uint8_t* p = static_cast<const uint8_t*>(data);
+        bool ok;
+
+        if (len >= max_len) {
+            ok = (ld<F, false>(p, len, s) && ...);
+        } else {
+            ok = (ld<F, true>(p, len, s) && ...);
+        }
+        return ok ? static_cast<size_t>(p - static_cast<const uint8_t*>(data)) : 0;
+    }
+
+  private:
+    /**
+     * \brief           Encode the record to output array shorter than \ref max_len, through temporary array
+     * \param[in]       s: Record
+     * \param[out]      out: Output array
+     * \param[in]       out_size: Size of output array in units of bytes
+     * \return          Number of bytes written, `0` if output array is too short
+     */
+    static size_t
+    enc_short(const T& s, void* out, size_t out_size) {
+        uint8_t tmp[max_len];
+        size_t len = enc_unchecked(s, tmp);
+
+        if (len > out_size) {
+            return 0;
+        }
+        memcpy(out, tmp, len);
+        return len;
+    }
+
+    /**
+     * \brief           Decode single field and advance input pointer
+     * \tparam          G: Field to decode
+     * \tparam          C: Set to `true` to check remaining length, `false` when input holds maximal length
+     * \param[in,out]   p: Input pointer
+     * \param[in,out]   rem: Remaining length of input
+     * \param[out]      s: Record to decode to
+     * \return          `true` on success, `false` otherwise
+     */
+    template <typename G, bool C>
+    static bool
+    ld(const uint8_t*& p, size_t& rem, T& s) {
+        size_t cnt = G::codec::ld(p, C ? rem : G::codec::max_len, &(s.*G::member));
+
+        p += cnt;
+        rem -= cnt;
+        return cnt > 0;
+    }
+};
+
+/**
+ * \}
+ */
+
+} /* namespace lwutil */
+
+#endif /* defined(__cplusplus) && C++17 */
+
+#endif /* LWUTIL_SCHEMA_HDR_H */
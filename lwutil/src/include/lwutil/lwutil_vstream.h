@@ -0,0 +1,113 @@
+/**
+ * \file            lwutil_vstream.h
+ * \brief           Seekable varint stream
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwUTIL - Lightweight utility library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v1.3.0
+ */
+#ifndef LWUTIL_VSTREAM_HDR_H
+#define LWUTIL_VSTREAM_HDR_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "lwutil/lwutil.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \defgroup        LWUTIL_VSTREAM Seekable varint stream
+ * \brief           Varint stream with sparse index for random access and parallel decoding
+ * \{
+ *
+ * Stream holds `32-bit` values, encoded in the same format as with \ref lwutil_st_u32_varint,
+ * and a sparse index with byte offset of every `stride`-th value, stored in separate array.
+ * Encoded data alone is therefore a valid varint sequence, compatible with \ref lwutil_ld_u32_varint_array.
+ *
+ * Value at any position is found with \ref lwutil_vstream_seek, which starts at the nearest index entry
+ * and skips at most `stride - 1` values, `8` bytes per step.
+ * Index entries also split the stream into blocks of `stride` values, each decoded independently.
+ * Read functions do not modify the stream, so that blocks can be decoded on several threads at the same time,
+ * for example with OpenMP:
+ *
+ * \code{.c}
+ * size_t blocks = lwutil_vstream_index_len(vs.count, vs.stride);
+ * #pragma omp parallel for
+ * for (long b = 0; b < (long)blocks; ++b) {
+ *     lwutil_vstream_get_u32_array(&vs, (size_t)b * vs.stride, &vals[(size_t)b * vs.stride], vs.stride);
+ * }
+ * \endcode
+ *
+ * Stride sets the index overhead, `4` bytes per `stride` values, against the cost of a seek.
+ * Stride of `64` adds `1` bit per value, at most `63` values are skipped per seek.
+ * Encoded data must not exceed `4 GB`, as offsets are stored as `32-bit` integers.
+ */
+
+/**
+ * \brief           Seekable varint stream structure
+ */
+typedef struct {
+    uint8_t* data;     /*!< Pointer to encoded data array */
+    size_t size;       /*!< Size of data array in units of bytes */
+    size_t len;        /*!< Length of encoded data in units of bytes */
+    uint32_t* index;   /*!< Pointer to index array, byte offset of every `stride`-th value */
+    size_t index_size; /*!< Size of index array in units of entries */
+    size_t stride;     /*!< Number of values per index entry */
+    size_t count;      /*!< Number of values in the stream */
+} lwutil_vstream_t;
+
+LWUTIL_API size_t lwutil_vstream_index_len(size_t count, size_t stride);
+LWUTIL_API uint8_t lwutil_vstream_init(lwutil_vstream_t* vs, void* data, size_t size, uint32_t* index,
+                                       size_t index_size, size_t stride);
+LWUTIL_API uint8_t lwutil_vstream_init_const(lwutil_vstream_t* vs, const void* data, size_t len,
+                                             const uint32_t* index, size_t stride, size_t count);
+LWUTIL_API uint8_t lwutil_vstream_put_u32(lwutil_vstream_t* vs, uint32_t val);
+LWUTIL_API size_t lwutil_vstream_put_u32_array(lwutil_vstream_t* vs, const uint32_t* vals, size_t count);
+LWUTIL_API uint8_t lwutil_vstream_seek(const lwutil_vstream_t* vs, size_t pos, size_t* offset_out);
+LWUTIL_API uint8_t lwutil_vstream_get_u32(const lwutil_vstream_t* vs, size_t pos, uint32_t* val_out);
+LWUTIL_API size_t lwutil_vstream_get_u32_array(const lwutil_vstream_t* vs, size_t pos, uint32_t* vals_out,
+                                               size_t count);
+
+/**
+ * \}
+ */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+/* Include implementation in header-only mode */
+#if LWUTIL_CFG_HEADER_ONLY && !defined(LWUTIL_HEADER_ONLY_IMPL)
+#define LWUTIL_HEADER_ONLY_IMPL
+#include "../../lwutil/lwutil_vstream.c"
+#undef LWUTIL_HEADER_ONLY_IMPL
+#endif /* LWUTIL_CFG_HEADER_ONLY && !defined(LWUTIL_HEADER_ONLY_IMPL) */
+
+#endif /* LWUTIL_VSTREAM_HDR_H */
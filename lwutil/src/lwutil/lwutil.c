@@ -36,98 +36,3165 @@
 #include <stdlib.h>
 #include <string.h>
 #include "lwutil/lwutil.h"
+#include "lwutil/lwutil_private.h"
+#if LWUTIL_CFG_STATS || LWUTIL_SIMD_MAX > 0
+#ifdef __cplusplus
+#include <atomic>
+#else
+#include <stdatomic.h>
+#endif /* __cplusplus */
+#endif /* LWUTIL_CFG_STATS || LWUTIL_SIMD_MAX > 0 */
+
+/*
+ * In header-only mode, implementation is included by the lwutil.h header,
+ * and is compiled into every translation unit as static inline functions.
+ */
+#if !LWUTIL_CFG_HEADER_ONLY || defined(LWUTIL_HEADER_ONLY_IMPL)
+
+/**
+ * \brief           Reverse byte order of `16-bit` value
+ * \param[in]       val: Input value
+ * \return          Value with reversed byte order
+ */
+static inline uint16_t
+prv_bswap16(uint16_t val) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap16(val);
+#elif defined(_MSC_VER)
+    return _byteswap_ushort(val);
+#else
+    return (uint16_t)((val << 8U) | (val >> 8U));
+#endif
+}
+
+/**
+ * \brief           Reverse byte order of `32-bit` value
+ * \param[in]       val: Input value
+ * \return          Value with reversed byte order
+ */
+static inline uint32_t
+prv_bswap32(uint32_t val) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap32(val);
+#elif defined(_MSC_VER)
+    return _byteswap_ulong(val);
+#else
+    return (val << 24U) | ((val << 8U) & 0x00FF0000U) | ((val >> 8U) & 0x0000FF00U) | (val >> 24U);
+#endif
+}
+
+/**
+ * \brief           Reverse byte order of `64-bit` value
+ * \param[in]       val: Input value
+ * \return          Value with reversed byte order
+ */
+static inline uint64_t
+prv_bswap64(uint64_t val) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap64(val);
+#elif defined(_MSC_VER)
+    return _byteswap_uint64(val);
+#else
+    return (uint64_t)prv_bswap32((uint32_t)val) << 32U | prv_bswap32((uint32_t)(val >> 32U));
+#endif
+}
+
+/**
+ * \brief           Load `64-bit` little-endian value from unaligned memory
+ * \param[in]       p: Minimum `8-bytes` long input array
+ * \return          Loaded value
+ */
+static inline uint64_t
+prv_ld_u64_le_unaligned(const uint8_t* p) {
+    uint64_t val;
+#if defined(LWUTIL_HOST_LE)
+    memcpy(&val, p, sizeof(val));
+#else
+    val = lwutil_ld_u64_le(p);
+#endif
+    return val;
+}
+
+#if LWUTIL_SIMD_MAX >= 1
+
+/**
+ * \brief           Reverse byte order of every `width`-bytes long element with SSSE3 byte shuffle
+ * \param[in]       in: Input bytes
+ * \param[out]      out: Output bytes. May be equal to `in`
+ * \param[in]       len: Number of input bytes. Only multiple of `16` bytes is processed
+ * \param[in]       width: Element width in units of bytes. `2`, `4` or `8`
+ * \return          Number of processed bytes
+ */
+LWUTIL_TARGET("ssse3")
+static size_t
+prv_bswap_array_ssse3(const uint8_t* in, uint8_t* out, size_t len, size_t width) {
+    uint8_t shuf[16];
+    __m128i mask;
+    size_t idx = 0;
+
+    /* Reverse bytes within each element */
+    for (size_t i = 0; i < sizeof(shuf); ++i) {
+        shuf[i] = (uint8_t)((i / width) * width + (width - 1U - (i % width)));
+    }
+    mask = _mm_loadu_si128((const __m128i*)shuf);
+    for (; (len - idx) >= 16U; idx += 16U) {
+        _mm_storeu_si128((__m128i*)&out[idx], _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)&in[idx]), mask));
+    }
+    return idx;
+}
+
+/**
+ * \brief           Encode block of bytes to hex characters with SSSE3 nibble shuffle
+ * 
+ * Every nibble is used as an index to the `16`-character alphabet with single byte shuffle,
+ * high and low nibble characters are then interleaved.
+ * 
+ * \param[in]       p: Input bytes
+ * \param[in]       len: Number of input bytes. Only multiple of `16` bytes is processed
+ * \param[out]      out: Output characters, `2 * len` long
+ * \param[in]       upper: Set to `1` for uppercase letters, `0` for lowercase
+ * \return          Number of processed input bytes
+ */
+LWUTIL_TARGET("ssse3")
+static size_t
+prv_hex_encode_ssse3(const uint8_t* p, size_t len, char* out, uint8_t upper) {
+    const __m128i lut = upper
+                            ? _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F')
+                            : _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    size_t idx = 0;
+
+    for (; (len - idx) >= 16U; idx += 16U) {
+        __m128i in = _mm_loadu_si128((const __m128i*)&p[idx]);
+        __m128i hi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(in, 4), mask));
+        __m128i lo = _mm_shuffle_epi8(lut, _mm_and_si128(in, mask));
+
+        _mm_storeu_si128((__m128i*)&out[2U * idx], _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128((__m128i*)&out[2U * idx + 16U], _mm_unpackhi_epi8(hi, lo));
+    }
+    return idx;
+}
+
+/**
+ * \brief           Convert `16` hex characters to nibble values and validate them
+ * \param[in]       in: Input characters
+ * \param[out]      valid: Set to all-ones for valid characters, `0` otherwise
+ * \return          Nibble values, one per byte
+ */
+LWUTIL_TARGET("ssse3")
+static inline __m128i
+prv_hex_nibbles_ssse3(__m128i in, __m128i* valid) {
+    /* Out-of-range characters wrap around to negative or to large positive values */
+    __m128i dig = _mm_sub_epi8(in, _mm_set1_epi8('0'));
+    __m128i let = _mm_sub_epi8(_mm_or_si128(in, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    __m128i dig_ok = _mm_and_si128(_mm_cmpgt_epi8(dig, _mm_set1_epi8(-1)), _mm_cmplt_epi8(dig, _mm_set1_epi8(10)));
+    __m128i let_ok = _mm_and_si128(_mm_cmpgt_epi8(let, _mm_set1_epi8(-1)), _mm_cmplt_epi8(let, _mm_set1_epi8(6)));
+
+    *valid = _mm_or_si128(dig_ok, let_ok);
+    return _mm_or_si128(_mm_and_si128(dig, dig_ok), _mm_and_si128(_mm_add_epi8(let, _mm_set1_epi8(10)), let_ok));
+}
+
+/**
+ * \brief           Decode block of hex characters to bytes with SSSE3 instructions
+ * 
+ * Characters are converted to nibbles with range compares,
+ * nibble pairs are then joined with single multiply-add instruction.
+ * 
+ * \param[in]       hex: Input characters
+ * \param[in]       len: Number of output bytes to decode. Only multiple of `16` bytes is processed
+ * \param[out]      out: Output bytes
+ * \return          Number of decoded output bytes, or `SIZE_MAX` if invalid character has been found
+ */
+LWUTIL_TARGET("ssse3")
+static size_t
+prv_hex_decode_ssse3(const char* hex, size_t len, uint8_t* out) {
+    const __m128i weights = _mm_set1_epi16(0x0110);
+    size_t idx = 0;
+
+    for (; (len - idx) >= 16U; idx += 16U) {
+        __m128i v0, v1, ok0, ok1;
+
+        v0 = prv_hex_nibbles_ssse3(_mm_loadu_si128((const __m128i*)&hex[2U * idx]), &ok0);
+        v1 = prv_hex_nibbles_ssse3(_mm_loadu_si128((const __m128i*)&hex[2U * idx + 16U]), &ok1);
+        if (_mm_movemask_epi8(_mm_and_si128(ok0, ok1)) != 0xFFFF) {
+            return SIZE_MAX;
+        }
+        /* High nibble is multiplied by 16, low nibble by 1 */
+        v0 = _mm_maddubs_epi16(v0, weights);
+        v1 = _mm_maddubs_epi16(v1, weights);
+        _mm_storeu_si128((__m128i*)&out[idx], _mm_packus_epi16(v0, v1));
+    }
+    return idx;
+}
+
+#endif /* LWUTIL_SIMD_MAX >= 1 */
+
+#if LWUTIL_SIMD_MAX >= 2
+
+/* Shuffle table ranges, decoding `6` values of up to `2`, `4` of up to `3` or `2` of up to `5` bytes */
+#define PRV_VARINT_SHUF_U16_END 64U
+#define PRV_VARINT_SHUF_U32_END 145U
+#define PRV_VARINT_SHUF_INVALID 0xFFU
+
+/*
+ * Masked-VByte look-up table, indexed by continuation bits of the first `12` input bytes.
+ * Low byte is an index into the shuffle table, high byte is the number of consumed bytes.
+ * \ref PRV_VARINT_SHUF_INVALID is used when the first values do not fit any pattern.
+ */
+static const uint16_t prv_varint_mask_tbl[4096] = {
+    0x0600U, 0x0720U, 0x0710U, 0x0676U, 0x0708U, 0x0830U, 0x0652U, 0x05A0U, 0x0704U, 0x0828U, 0x0818U, 0x077FU,
+    0x0646U, 0x076DU, 0x0594U, 0x06A5U, 0x0702U, 0x0824U, 0x0814U, 0x0779U, 0x080CU, 0x0938U, 0x0755U, 0x06A1U,
+    0x0642U, 0x0761U, 0x074FU, 0x0888U, 0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0701U, 0x0822U, 0x0812U, 0x0777U,
+    0x080AU, 0x0934U, 0x0753U, 0x05A0U, 0x0806U, 0x092CU, 0x091CU, 0x0882U, 0x0747U, 0x0870U, 0x0594U, 0x07A6U,
+    0x0440U, 0x075DU, 0x074BU, 0x087CU, 0x0745U, 0x086AU, 0x0858U, 0x07A2U, 0x0291U, 0x0396U, 0x0392U, 0x079EU,
+    0x0291U, 0x079AU, 0x00FFU, 0x00FFU, 0x0600U, 0x0821U, 0x0811U, 0x0676U, 0x0809U, 0x0932U, 0x0652U, 0x05A0U,
+    0x0805U, 0x092AU, 0x091AU, 0x0880U, 0x0646U, 0x086EU, 0x0594U, 0x06A5U, 0x0803U, 0x0926U, 0x0916U, 0x087AU,
+    0x090EU, 0x0A3CU, 0x0856U, 0x06A1U, 0x0642U, 0x0862U, 0x0850U, 0x098BU, 0x0291U, 0x0699U, 0x0695U, 0x00FFU,
+    0x0440U, 0x055BU, 0x0549U, 0x0878U, 0x0543U, 0x0866U, 0x0854U, 0x05A0U, 0x0541U, 0x0860U, 0x084EU, 0x0985U,
+    0x0848U, 0x0973U, 0x0594U, 0x08A7U, 0x0440U, 0x0396U, 0x0392U, 0x049BU, 0x0291U, 0x0497U, 0x0493U, 0x08A3U,
+    0x0291U, 0x0396U, 0x0392U, 0x089FU, 0x0291U, 0x00FFU, 0x00FFU, 0x00FFU, 0x0600U, 0x0720U, 0x0710U, 0x0676U,
+    0x0708U, 0x0931U, 0x0652U, 0x05A0U, 0x0704U, 0x0929U, 0x0919U, 0x077FU, 0x0646U, 0x076DU, 0x0594U, 0x06A5U,
+    0x0702U, 0x0925U, 0x0915U, 0x0779U, 0x090DU, 0x0A3AU, 0x0755U, 0x06A1U, 0x0642U, 0x0761U, 0x074FU, 0x0989U,
+    0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0701U, 0x0923U, 0x0913U, 0x0777U, 0x090BU, 0x0A36U, 0x0753U, 0x05A0U,
+    0x0907U, 0x0A2EU, 0x0A1EU, 0x0983U, 0x0747U, 0x0971U, 0x0594U, 0x07A6U, 0x0440U, 0x075DU, 0x074BU, 0x097DU,
+    0x0745U, 0x096BU, 0x0959U, 0x07A2U, 0x0291U, 0x0396U, 0x0392U, 0x079EU, 0x0291U, 0x079AU, 0x00FFU, 0x00FFU,
+    0x0600U, 0x055BU, 0x0549U, 0x0676U, 0x0543U, 0x0664U, 0x0652U, 0x05A0U, 0x0541U, 0x065EU, 0x064CU, 0x0981U,
+    0x0646U, 0x096FU, 0x0594U, 0x06A5U, 0x0440U, 0x065CU, 0x064AU, 0x097BU, 0x0644U, 0x0969U, 0x0957U, 0x06A1U,
+    0x0642U, 0x0963U, 0x0951U, 0x0A8EU, 0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0440U, 0x055BU, 0x0549U, 0x049BU,
+    0x0543U, 0x0497U, 0x0493U, 0x05A0U, 0x0541U, 0x0396U, 0x0392U, 0x059CU, 0x0291U, 0x0598U, 0x0594U, 0x09A8U,
+    0x0440U, 0x0396U, 0x0392U, 0x049BU, 0x0291U, 0x0497U, 0x0493U, 0x09A4U, 0x0291U, 0x0396U, 0x0392U, 0x00FFU,
+    0x0291U, 0x00FFU, 0x00FFU, 0x00FFU, 0x0600U, 0x0720U, 0x0710U, 0x0676U, 0x0708U, 0x0830U, 0x0652U, 0x05A0U,
+    0x0704U, 0x0828U, 0x0818U, 0x077FU, 0x0646U, 0x076DU, 0x0594U, 0x06A5U, 0x0702U, 0x0824U, 0x0814U, 0x0779U,
+    0x080CU, 0x0A39U, 0x0755U, 0x06A1U, 0x0642U, 0x0761U, 0x074FU, 0x0888U, 0x0291U, 0x0699U, 0x0695U, 0x00FFU,
+    0x0701U, 0x0822U, 0x0812U, 0x0777U, 0x080AU, 0x0A35U, 0x0753U, 0x05A0U, 0x0806U, 0x0A2DU, 0x0A1DU, 0x0882U,
+    0x0747U, 0x0870U, 0x0594U, 0x07A6U, 0x0440U, 0x075DU, 0x074BU, 0x087CU, 0x0745U, 0x086AU, 0x0858U, 0x07A2U,
+    0x0291U, 0x0396U, 0x0392U, 0x079EU, 0x0291U, 0x079AU, 0x00FFU, 0x00FFU, 0x0600U, 0x0821U, 0x0811U, 0x0676U,
+    0x0809U, 0x0A33U, 0x0652U, 0x05A0U, 0x0805U, 0x0A2BU, 0x0A1BU, 0x0880U, 0x0646U, 0x086EU, 0x0594U, 0x06A5U,
+    0x0803U, 0x0A27U, 0x0A17U, 0x087AU, 0x0A0FU, 0x0B3EU, 0x0856U, 0x06A1U, 0x0642U, 0x0862U, 0x0850U, 0x0A8CU,
+    0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0440U, 0x055BU, 0x0549U, 0x0878U, 0x0543U, 0x0866U, 0x0854U, 0x05A0U,
+    0x0541U, 0x0860U, 0x084EU, 0x0A86U, 0x0848U, 0x0A74U, 0x0594U, 0x08A7U, 0x0440U, 0x0396U, 0x0392U, 0x049BU,
+    0x0291U, 0x0497U, 0x0493U, 0x08A3U, 0x0291U, 0x0396U, 0x0392U, 0x089FU, 0x0291U, 0x00FFU, 0x00FFU, 0x00FFU,
+    0x0600U, 0x0720U, 0x0710U, 0x0676U, 0x0708U, 0x0664U, 0x0652U, 0x05A0U, 0x0704U, 0x065EU, 0x064CU, 0x077FU,
+    0x0646U, 0x076DU, 0x0594U, 0x06A5U, 0x0702U, 0x065CU, 0x064AU, 0x0779U, 0x0644U, 0x0767U, 0x0755U, 0x06A1U,
+    0x0642U, 0x0761U, 0x074FU, 0x0A8AU, 0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0701U, 0x055BU, 0x0549U, 0x0777U,
+    0x0543U, 0x0765U, 0x0753U, 0x05A0U, 0x0541U, 0x075FU, 0x074DU, 0x0A84U, 0x0747U, 0x0A72U, 0x0594U, 0x07A6U,
+    0x0440U, 0x075DU, 0x074BU, 0x0A7EU, 0x0745U, 0x0A6CU, 0x0A5AU, 0x07A2U, 0x0291U, 0x0396U, 0x0392U, 0x079EU,
+    0x0291U, 0x079AU, 0x00FFU, 0x00FFU, 0x0600U, 0x055BU, 0x0549U, 0x0676U, 0x0543U, 0x0664U, 0x0652U, 0x05A0U,
+    0x0541U, 0x065EU, 0x064CU, 0x059CU, 0x0646U, 0x0598U, 0x0594U, 0x06A5U, 0x0440U, 0x065CU, 0x064AU, 0x049BU,
+    0x0644U, 0x0497U, 0x0493U, 0x06A1U, 0x0642U, 0x0396U, 0x0392U, 0x069DU, 0x0291U, 0x0699U, 0x0695U, 0x00FFU,
+    0x0440U, 0x055BU, 0x0549U, 0x049BU, 0x0543U, 0x0497U, 0x0493U, 0x05A0U, 0x0541U, 0x0396U, 0x0392U, 0x059CU,
+    0x0291U, 0x0598U, 0x0594U, 0x0AA9U, 0x0440U, 0x0396U, 0x0392U, 0x049BU, 0x0291U, 0x0497U, 0x0493U, 0x00FFU,
+    0x0291U, 0x0396U, 0x0392U, 0x00FFU, 0x0291U, 0x00FFU, 0x00FFU, 0x00FFU, 0x0600U, 0x0720U, 0x0710U, 0x0676U,
+    0x0708U, 0x0830U, 0x0652U, 0x05A0U, 0x0704U, 0x0828U, 0x0818U, 0x077FU, 0x0646U, 0x076DU, 0x0594U, 0x06A5U,
+    0x0702U, 0x0824U, 0x0814U, 0x0779U, 0x080CU, 0x0938U, 0x0755U, 0x06A1U, 0x0642U, 0x0761U, 0x074FU, 0x0888U,
+    0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0701U, 0x0822U, 0x0812U, 0x0777U, 0x080AU, 0x0934U, 0x0753U, 0x05A0U,
+    0x0806U, 0x092CU, 0x091CU, 0x0882U, 0x0747U, 0x0870U, 0x0594U, 0x07A6U, 0x0440U, 0x075DU, 0x074BU, 0x087CU,
+    0x0745U, 0x086AU, 0x0858U, 0x07A2U, 0x0291U, 0x0396U, 0x0392U, 0x079EU, 0x0291U, 0x079AU, 0x00FFU, 0x00FFU,
+    0x0600U, 0x0821U, 0x0811U, 0x0676U, 0x0809U, 0x0932U, 0x0652U, 0x05A0U, 0x0805U, 0x092AU, 0x091AU, 0x0880U,
+    0x0646U, 0x086EU, 0x0594U, 0x06A5U, 0x0803U, 0x0926U, 0x0916U, 0x087AU, 0x090EU, 0x0B3DU, 0x0856U, 0x06A1U,
+    0x0642U, 0x0862U, 0x0850U, 0x098BU, 0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0440U, 0x055BU, 0x0549U, 0x0878U,
+    0x0543U, 0x0866U, 0x0854U, 0x05A0U, 0x0541U, 0x0860U, 0x084EU, 0x0985U, 0x0848U, 0x0973U, 0x0594U, 0x08A7U,
+    0x0440U, 0x0396U, 0x0392U, 0x049BU, 0x0291U, 0x0497U, 0x0493U, 0x08A3U, 0x0291U, 0x0396U, 0x0392U, 0x089FU,
+    0x0291U, 0x00FFU, 0x00FFU, 0x00FFU, 0x0600U, 0x0720U, 0x0710U, 0x0676U, 0x0708U, 0x0931U, 0x0652U, 0x05A0U,
+    0x0704U, 0x0929U, 0x0919U, 0x077FU, 0x0646U, 0x076DU, 0x0594U, 0x06A5U, 0x0702U, 0x0925U, 0x0915U, 0x0779U,
+    0x090DU, 0x0B3BU, 0x0755U, 0x06A1U, 0x0642U, 0x0761U, 0x074FU, 0x0989U, 0x0291U, 0x0699U, 0x0695U, 0x00FFU,
+    0x0701U, 0x0923U, 0x0913U, 0x0777U, 0x090BU, 0x0B37U, 0x0753U, 0x05A0U, 0x0907U, 0x0B2FU, 0x0B1FU, 0x0983U,
+    0x0747U, 0x0971U, 0x0594U, 0x07A6U, 0x0440U, 0x075DU, 0x074BU, 0x097DU, 0x0745U, 0x096BU, 0x0959U, 0x07A2U,
+    0x0291U, 0x0396U, 0x0392U, 0x079EU, 0x0291U, 0x079AU, 0x00FFU, 0x00FFU, 0x0600U, 0x055BU, 0x0549U, 0x0676U,
+    0x0543U, 0x0664U, 0x0652U, 0x05A0U, 0x0541U, 0x065EU, 0x064CU, 0x0981U, 0x0646U, 0x096FU, 0x0594U, 0x06A5U,
+    0x0440U, 0x065CU, 0x064AU, 0x097BU, 0x0644U, 0x0969U, 0x0957U, 0x06A1U, 0x0642U, 0x0963U, 0x0951U, 0x0B8FU,
+    0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0440U, 0x055BU, 0x0549U, 0x049BU, 0x0543U, 0x0497U, 0x0493U, 0x05A0U,
+    0x0541U, 0x0396U, 0x0392U, 0x059CU, 0x0291U, 0x0598U, 0x0594U, 0x09A8U, 0x0440U, 0x0396U, 0x0392U, 0x049BU,
+    0x0291U, 0x0497U, 0x0493U, 0x09A4U, 0x0291U, 0x0396U, 0x0392U, 0x00FFU, 0x0291U, 0x00FFU, 0x00FFU, 0x00FFU,
+    0x0600U, 0x0720U, 0x0710U, 0x0676U, 0x0708U, 0x0830U, 0x0652U, 0x05A0U, 0x0704U, 0x0828U, 0x0818U, 0x077FU,
+    0x0646U, 0x076DU, 0x0594U, 0x06A5U, 0x0702U, 0x0824U, 0x0814U, 0x0779U, 0x080CU, 0x0767U, 0x0755U, 0x06A1U,
+    0x0642U, 0x0761U, 0x074FU, 0x0888U, 0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0701U, 0x0822U, 0x0812U, 0x0777U,
+    0x080AU, 0x0765U, 0x0753U, 0x05A0U, 0x0806U, 0x075FU, 0x074DU, 0x0882U, 0x0747U, 0x0870U, 0x0594U, 0x07A6U,
+    0x0440U, 0x075DU, 0x074BU, 0x087CU, 0x0745U, 0x086AU, 0x0858U, 0x07A2U, 0x0291U, 0x0396U, 0x0392U, 0x079EU,
+    0x0291U, 0x079AU, 0x00FFU, 0x00FFU, 0x0600U, 0x0821U, 0x0811U, 0x0676U, 0x0809U, 0x0664U, 0x0652U, 0x05A0U,
+    0x0805U, 0x065EU, 0x064CU, 0x0880U, 0x0646U, 0x086EU, 0x0594U, 0x06A5U, 0x0803U, 0x065CU, 0x064AU, 0x087AU,
+    0x0644U, 0x0868U, 0x0856U, 0x06A1U, 0x0642U, 0x0862U, 0x0850U, 0x0B8DU, 0x0291U, 0x0699U, 0x0695U, 0x00FFU,
+    0x0440U, 0x055BU, 0x0549U, 0x0878U, 0x0543U, 0x0866U, 0x0854U, 0x05A0U, 0x0541U, 0x0860U, 0x084EU, 0x0B87U,
+    0x0848U, 0x0B75U, 0x0594U, 0x08A7U, 0x0440U, 0x0396U, 0x0392U, 0x049BU, 0x0291U, 0x0497U, 0x0493U, 0x08A3U,
+    0x0291U, 0x0396U, 0x0392U, 0x089FU, 0x0291U, 0x00FFU, 0x00FFU, 0x00FFU, 0x0600U, 0x0720U, 0x0710U, 0x0676U,
+    0x0708U, 0x0664U, 0x0652U, 0x05A0U, 0x0704U, 0x065EU, 0x064CU, 0x077FU, 0x0646U, 0x076DU, 0x0594U, 0x06A5U,
+    0x0702U, 0x065CU, 0x064AU, 0x0779U, 0x0644U, 0x0767U, 0x0755U, 0x06A1U, 0x0642U, 0x0761U, 0x074FU, 0x069DU,
+    0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0701U, 0x055BU, 0x0549U, 0x0777U, 0x0543U, 0x0765U, 0x0753U, 0x05A0U,
+    0x0541U, 0x075FU, 0x074DU, 0x059CU, 0x0747U, 0x0598U, 0x0594U, 0x07A6U, 0x0440U, 0x075DU, 0x074BU, 0x049BU,
+    0x0745U, 0x0497U, 0x0493U, 0x07A2U, 0x0291U, 0x0396U, 0x0392U, 0x079EU, 0x0291U, 0x079AU, 0x00FFU, 0x00FFU,
+    0x0600U, 0x055BU, 0x0549U, 0x0676U, 0x0543U, 0x0664U, 0x0652U, 0x05A0U, 0x0541U, 0x065EU, 0x064CU, 0x059CU,
+    0x0646U, 0x0598U, 0x0594U, 0x06A5U, 0x0440U, 0x065CU, 0x064AU, 0x049BU, 0x0644U, 0x0497U, 0x0493U, 0x06A1U,
+    0x0642U, 0x0396U, 0x0392U, 0x069DU, 0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0440U, 0x055BU, 0x0549U, 0x049BU,
+    0x0543U, 0x0497U, 0x0493U, 0x05A0U, 0x0541U, 0x0396U, 0x0392U, 0x059CU, 0x0291U, 0x0598U, 0x0594U, 0x00FFU,
+    0x0440U, 0x0396U, 0x0392U, 0x049BU, 0x0291U, 0x0497U, 0x0493U, 0x00FFU, 0x0291U, 0x0396U, 0x0392U, 0x00FFU,
+    0x0291U, 0x00FFU, 0x00FFU, 0x00FFU, 0x0600U, 0x0720U, 0x0710U, 0x0676U, 0x0708U, 0x0830U, 0x0652U, 0x05A0U,
+    0x0704U, 0x0828U, 0x0818U, 0x077FU, 0x0646U, 0x076DU, 0x0594U, 0x06A5U, 0x0702U, 0x0824U, 0x0814U, 0x0779U,
+    0x080CU, 0x0938U, 0x0755U, 0x06A1U, 0x0642U, 0x0761U, 0x074FU, 0x0888U, 0x0291U, 0x0699U, 0x0695U, 0x00FFU,
+    0x0701U, 0x0822U, 0x0812U, 0x0777U, 0x080AU, 0x0934U, 0x0753U, 0x05A0U, 0x0806U, 0x092CU, 0x091CU, 0x0882U,
+    0x0747U, 0x0870U, 0x0594U, 0x07A6U, 0x0440U, 0x075DU, 0x074BU, 0x087CU, 0x0745U, 0x086AU, 0x0858U, 0x07A2U,
+    0x0291U, 0x0396U, 0x0392U, 0x079EU, 0x0291U, 0x079AU, 0x00FFU, 0x00FFU, 0x0600U, 0x0821U, 0x0811U, 0x0676U,
+    0x0809U, 0x0932U, 0x0652U, 0x05A0U, 0x0805U, 0x092AU, 0x091AU, 0x0880U, 0x0646U, 0x086EU, 0x0594U, 0x06A5U,
+    0x0803U, 0x0926U, 0x0916U, 0x087AU, 0x090EU, 0x0A3CU, 0x0856U, 0x06A1U, 0x0642U, 0x0862U, 0x0850U, 0x098BU,
+    0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0440U, 0x055BU, 0x0549U, 0x0878U, 0x0543U, 0x0866U, 0x0854U, 0x05A0U,
+    0x0541U, 0x0860U, 0x084EU, 0x0985U, 0x0848U, 0x0973U, 0x0594U, 0x08A7U, 0x0440U, 0x0396U, 0x0392U, 0x049BU,
+    0x0291U, 0x0497U, 0x0493U, 0x08A3U, 0x0291U, 0x0396U, 0x0392U, 0x089FU, 0x0291U, 0x00FFU, 0x00FFU, 0x00FFU,
+    0x0600U, 0x0720U, 0x0710U, 0x0676U, 0x0708U, 0x0931U, 0x0652U, 0x05A0U, 0x0704U, 0x0929U, 0x0919U, 0x077FU,
+    0x0646U, 0x076DU, 0x0594U, 0x06A5U, 0x0702U, 0x0925U, 0x0915U, 0x0779U, 0x090DU, 0x0A3AU, 0x0755U, 0x06A1U,
+    0x0642U, 0x0761U, 0x074FU, 0x0989U, 0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0701U, 0x0923U, 0x0913U, 0x0777U,
+    0x090BU, 0x0A36U, 0x0753U, 0x05A0U, 0x0907U, 0x0A2EU, 0x0A1EU, 0x0983U, 0x0747U, 0x0971U, 0x0594U, 0x07A6U,
+    0x0440U, 0x075DU, 0x074BU, 0x097DU, 0x0745U, 0x096BU, 0x0959U, 0x07A2U, 0x0291U, 0x0396U, 0x0392U, 0x079EU,
+    0x0291U, 0x079AU, 0x00FFU, 0x00FFU, 0x0600U, 0x055BU, 0x0549U, 0x0676U, 0x0543U, 0x0664U, 0x0652U, 0x05A0U,
+    0x0541U, 0x065EU, 0x064CU, 0x0981U, 0x0646U, 0x096FU, 0x0594U, 0x06A5U, 0x0440U, 0x065CU, 0x064AU, 0x097BU,
+    0x0644U, 0x0969U, 0x0957U, 0x06A1U, 0x0642U, 0x0963U, 0x0951U, 0x0A8EU, 0x0291U, 0x0699U, 0x0695U, 0x00FFU,
+    0x0440U, 0x055BU, 0x0549U, 0x049BU, 0x0543U, 0x0497U, 0x0493U, 0x05A0U, 0x0541U, 0x0396U, 0x0392U, 0x059CU,
+    0x0291U, 0x0598U, 0x0594U, 0x09A8U, 0x0440U, 0x0396U, 0x0392U, 0x049BU, 0x0291U, 0x0497U, 0x0493U, 0x09A4U,
+    0x0291U, 0x0396U, 0x0392U, 0x00FFU, 0x0291U, 0x00FFU, 0x00FFU, 0x00FFU, 0x0600U, 0x0720U, 0x0710U, 0x0676U,
+    0x0708U, 0x0830U, 0x0652U, 0x05A0U, 0x0704U, 0x0828U, 0x0818U, 0x077FU, 0x0646U, 0x076DU, 0x0594U, 0x06A5U,
+    0x0702U, 0x0824U, 0x0814U, 0x0779U, 0x080CU, 0x0A39U, 0x0755U, 0x06A1U, 0x0642U, 0x0761U, 0x074FU, 0x0888U,
+    0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0701U, 0x0822U, 0x0812U, 0x0777U, 0x080AU, 0x0A35U, 0x0753U, 0x05A0U,
+    0x0806U, 0x0A2DU, 0x0A1DU, 0x0882U, 0x0747U, 0x0870U, 0x0594U, 0x07A6U, 0x0440U, 0x075DU, 0x074BU, 0x087CU,
+    0x0745U, 0x086AU, 0x0858U, 0x07A2U, 0x0291U, 0x0396U, 0x0392U, 0x079EU, 0x0291U, 0x079AU, 0x00FFU, 0x00FFU,
+    0x0600U, 0x0821U, 0x0811U, 0x0676U, 0x0809U, 0x0A33U, 0x0652U, 0x05A0U, 0x0805U, 0x0A2BU, 0x0A1BU, 0x0880U,
+    0x0646U, 0x086EU, 0x0594U, 0x06A5U, 0x0803U, 0x0A27U, 0x0A17U, 0x087AU, 0x0A0FU, 0x0C3FU, 0x0856U, 0x06A1U,
+    0x0642U, 0x0862U, 0x0850U, 0x0A8CU, 0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0440U, 0x055BU, 0x0549U, 0x0878U,
+    0x0543U, 0x0866U, 0x0854U, 0x05A0U, 0x0541U, 0x0860U, 0x084EU, 0x0A86U, 0x0848U, 0x0A74U, 0x0594U, 0x08A7U,
+    0x0440U, 0x0396U, 0x0392U, 0x049BU, 0x0291U, 0x0497U, 0x0493U, 0x08A3U, 0x0291U, 0x0396U, 0x0392U, 0x089FU,
+    0x0291U, 0x00FFU, 0x00FFU, 0x00FFU, 0x0600U, 0x0720U, 0x0710U, 0x0676U, 0x0708U, 0x0664U, 0x0652U, 0x05A0U,
+    0x0704U, 0x065EU, 0x064CU, 0x077FU, 0x0646U, 0x076DU, 0x0594U, 0x06A5U, 0x0702U, 0x065CU, 0x064AU, 0x0779U,
+    0x0644U, 0x0767U, 0x0755U, 0x06A1U, 0x0642U, 0x0761U, 0x074FU, 0x0A8AU, 0x0291U, 0x0699U, 0x0695U, 0x00FFU,
+    0x0701U, 0x055BU, 0x0549U, 0x0777U, 0x0543U, 0x0765U, 0x0753U, 0x05A0U, 0x0541U, 0x075FU, 0x074DU, 0x0A84U,
+    0x0747U, 0x0A72U, 0x0594U, 0x07A6U, 0x0440U, 0x075DU, 0x074BU, 0x0A7EU, 0x0745U, 0x0A6CU, 0x0A5AU, 0x07A2U,
+    0x0291U, 0x0396U, 0x0392U, 0x079EU, 0x0291U, 0x079AU, 0x00FFU, 0x00FFU, 0x0600U, 0x055BU, 0x0549U, 0x0676U,
+    0x0543U, 0x0664U, 0x0652U, 0x05A0U, 0x0541U, 0x065EU, 0x064CU, 0x059CU, 0x0646U, 0x0598U, 0x0594U, 0x06A5U,
+    0x0440U, 0x065CU, 0x064AU, 0x049BU, 0x0644U, 0x0497U, 0x0493U, 0x06A1U, 0x0642U, 0x0396U, 0x0392U, 0x069DU,
+    0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0440U, 0x055BU, 0x0549U, 0x049BU, 0x0543U, 0x0497U, 0x0493U, 0x05A0U,
+    0x0541U, 0x0396U, 0x0392U, 0x059CU, 0x0291U, 0x0598U, 0x0594U, 0x0AA9U, 0x0440U, 0x0396U, 0x0392U, 0x049BU,
+    0x0291U, 0x0497U, 0x0493U, 0x00FFU, 0x0291U, 0x0396U, 0x0392U, 0x00FFU, 0x0291U, 0x00FFU, 0x00FFU, 0x00FFU,
+    0x0600U, 0x0720U, 0x0710U, 0x0676U, 0x0708U, 0x0830U, 0x0652U, 0x05A0U, 0x0704U, 0x0828U, 0x0818U, 0x077FU,
+    0x0646U, 0x076DU, 0x0594U, 0x06A5U, 0x0702U, 0x0824U, 0x0814U, 0x0779U, 0x080CU, 0x0938U, 0x0755U, 0x06A1U,
+    0x0642U, 0x0761U, 0x074FU, 0x0888U, 0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0701U, 0x0822U, 0x0812U, 0x0777U,
+    0x080AU, 0x0934U, 0x0753U, 0x05A0U, 0x0806U, 0x092CU, 0x091CU, 0x0882U, 0x0747U, 0x0870U, 0x0594U, 0x07A6U,
+    0x0440U, 0x075DU, 0x074BU, 0x087CU, 0x0745U, 0x086AU, 0x0858U, 0x07A2U, 0x0291U, 0x0396U, 0x0392U, 0x079EU,
+    0x0291U, 0x079AU, 0x00FFU, 0x00FFU, 0x0600U, 0x0821U, 0x0811U, 0x0676U, 0x0809U, 0x0932U, 0x0652U, 0x05A0U,
+    0x0805U, 0x092AU, 0x091AU, 0x0880U, 0x0646U, 0x086EU, 0x0594U, 0x06A5U, 0x0803U, 0x0926U, 0x0916U, 0x087AU,
+    0x090EU, 0x0868U, 0x0856U, 0x06A1U, 0x0642U, 0x0862U, 0x0850U, 0x098BU, 0x0291U, 0x0699U, 0x0695U, 0x00FFU,
+    0x0440U, 0x055BU, 0x0549U, 0x0878U, 0x0543U, 0x0866U, 0x0854U, 0x05A0U, 0x0541U, 0x0860U, 0x084EU, 0x0985U,
+    0x0848U, 0x0973U, 0x0594U, 0x08A7U, 0x0440U, 0x0396U, 0x0392U, 0x049BU, 0x0291U, 0x0497U, 0x0493U, 0x08A3U,
+    0x0291U, 0x0396U, 0x0392U, 0x089FU, 0x0291U, 0x00FFU, 0x00FFU, 0x00FFU, 0x0600U, 0x0720U, 0x0710U, 0x0676U,
+    0x0708U, 0x0931U, 0x0652U, 0x05A0U, 0x0704U, 0x0929U, 0x0919U, 0x077FU, 0x0646U, 0x076DU, 0x0594U, 0x06A5U,
+    0x0702U, 0x0925U, 0x0915U, 0x0779U, 0x090DU, 0x0767U, 0x0755U, 0x06A1U, 0x0642U, 0x0761U, 0x074FU, 0x0989U,
+    0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0701U, 0x0923U, 0x0913U, 0x0777U, 0x090BU, 0x0765U, 0x0753U, 0x05A0U,
+    0x0907U, 0x075FU, 0x074DU, 0x0983U, 0x0747U, 0x0971U, 0x0594U, 0x07A6U, 0x0440U, 0x075DU, 0x074BU, 0x097DU,
+    0x0745U, 0x096BU, 0x0959U, 0x07A2U, 0x0291U, 0x0396U, 0x0392U, 0x079EU, 0x0291U, 0x079AU, 0x00FFU, 0x00FFU,
+    0x0600U, 0x055BU, 0x0549U, 0x0676U, 0x0543U, 0x0664U, 0x0652U, 0x05A0U, 0x0541U, 0x065EU, 0x064CU, 0x0981U,
+    0x0646U, 0x096FU, 0x0594U, 0x06A5U, 0x0440U, 0x065CU, 0x064AU, 0x097BU, 0x0644U, 0x0969U, 0x0957U, 0x06A1U,
+    0x0642U, 0x0963U, 0x0951U, 0x0C90U, 0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0440U, 0x055BU, 0x0549U, 0x049BU,
+    0x0543U, 0x0497U, 0x0493U, 0x05A0U, 0x0541U, 0x0396U, 0x0392U, 0x059CU, 0x0291U, 0x0598U, 0x0594U, 0x09A8U,
+    0x0440U, 0x0396U, 0x0392U, 0x049BU, 0x0291U, 0x0497U, 0x0493U, 0x09A4U, 0x0291U, 0x0396U, 0x0392U, 0x00FFU,
+    0x0291U, 0x00FFU, 0x00FFU, 0x00FFU, 0x0600U, 0x0720U, 0x0710U, 0x0676U, 0x0708U, 0x0830U, 0x0652U, 0x05A0U,
+    0x0704U, 0x0828U, 0x0818U, 0x077FU, 0x0646U, 0x076DU, 0x0594U, 0x06A5U, 0x0702U, 0x0824U, 0x0814U, 0x0779U,
+    0x080CU, 0x0767U, 0x0755U, 0x06A1U, 0x0642U, 0x0761U, 0x074FU, 0x0888U, 0x0291U, 0x0699U, 0x0695U, 0x00FFU,
+    0x0701U, 0x0822U, 0x0812U, 0x0777U, 0x080AU, 0x0765U, 0x0753U, 0x05A0U, 0x0806U, 0x075FU, 0x074DU, 0x0882U,
+    0x0747U, 0x0870U, 0x0594U, 0x07A6U, 0x0440U, 0x075DU, 0x074BU, 0x087CU, 0x0745U, 0x086AU, 0x0858U, 0x07A2U,
+    0x0291U, 0x0396U, 0x0392U, 0x079EU, 0x0291U, 0x079AU, 0x00FFU, 0x00FFU, 0x0600U, 0x0821U, 0x0811U, 0x0676U,
+    0x0809U, 0x0664U, 0x0652U, 0x05A0U, 0x0805U, 0x065EU, 0x064CU, 0x0880U, 0x0646U, 0x086EU, 0x0594U, 0x06A5U,
+    0x0803U, 0x065CU, 0x064AU, 0x087AU, 0x0644U, 0x0868U, 0x0856U, 0x06A1U, 0x0642U, 0x0862U, 0x0850U, 0x069DU,
+    0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0440U, 0x055BU, 0x0549U, 0x0878U, 0x0543U, 0x0866U, 0x0854U, 0x05A0U,
+    0x0541U, 0x0860U, 0x084EU, 0x059CU, 0x0848U, 0x0598U, 0x0594U, 0x08A7U, 0x0440U, 0x0396U, 0x0392U, 0x049BU,
+    0x0291U, 0x0497U, 0x0493U, 0x08A3U, 0x0291U, 0x0396U, 0x0392U, 0x089FU, 0x0291U, 0x00FFU, 0x00FFU, 0x00FFU,
+    0x0600U, 0x0720U, 0x0710U, 0x0676U, 0x0708U, 0x0664U, 0x0652U, 0x05A0U, 0x0704U, 0x065EU, 0x064CU, 0x077FU,
+    0x0646U, 0x076DU, 0x0594U, 0x06A5U, 0x0702U, 0x065CU, 0x064AU, 0x0779U, 0x0644U, 0x0767U, 0x0755U, 0x06A1U,
+    0x0642U, 0x0761U, 0x074FU, 0x069DU, 0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0701U, 0x055BU, 0x0549U, 0x0777U,
+    0x0543U, 0x0765U, 0x0753U, 0x05A0U, 0x0541U, 0x075FU, 0x074DU, 0x059CU, 0x0747U, 0x0598U, 0x0594U, 0x07A6U,
+    0x0440U, 0x075DU, 0x074BU, 0x049BU, 0x0745U, 0x0497U, 0x0493U, 0x07A2U, 0x0291U, 0x0396U, 0x0392U, 0x079EU,
+    0x0291U, 0x079AU, 0x00FFU, 0x00FFU, 0x0600U, 0x055BU, 0x0549U, 0x0676U, 0x0543U, 0x0664U, 0x0652U, 0x05A0U,
+    0x0541U, 0x065EU, 0x064CU, 0x059CU, 0x0646U, 0x0598U, 0x0594U, 0x06A5U, 0x0440U, 0x065CU, 0x064AU, 0x049BU,
+    0x0644U, 0x0497U, 0x0493U, 0x06A1U, 0x0642U, 0x0396U, 0x0392U, 0x069DU, 0x0291U, 0x0699U, 0x0695U, 0x00FFU,
+    0x0440U, 0x055BU, 0x0549U, 0x049BU, 0x0543U, 0x0497U, 0x0493U, 0x05A0U, 0x0541U, 0x0396U, 0x0392U, 0x059CU,
+    0x0291U, 0x0598U, 0x0594U, 0x00FFU, 0x0440U, 0x0396U, 0x0392U, 0x049BU, 0x0291U, 0x0497U, 0x0493U, 0x00FFU,
+    0x0291U, 0x0396U, 0x0392U, 0x00FFU, 0x0291U, 0x00FFU, 0x00FFU, 0x00FFU, 0x0600U, 0x0720U, 0x0710U, 0x0676U,
+    0x0708U, 0x0830U, 0x0652U, 0x05A0U, 0x0704U, 0x0828U, 0x0818U, 0x077FU, 0x0646U, 0x076DU, 0x0594U, 0x06A5U,
+    0x0702U, 0x0824U, 0x0814U, 0x0779U, 0x080CU, 0x0938U, 0x0755U, 0x06A1U, 0x0642U, 0x0761U, 0x074FU, 0x0888U,
+    0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0701U, 0x0822U, 0x0812U, 0x0777U, 0x080AU, 0x0934U, 0x0753U, 0x05A0U,
+    0x0806U, 0x092CU, 0x091CU, 0x0882U, 0x0747U, 0x0870U, 0x0594U, 0x07A6U, 0x0440U, 0x075DU, 0x074BU, 0x087CU,
+    0x0745U, 0x086AU, 0x0858U, 0x07A2U, 0x0291U, 0x0396U, 0x0392U, 0x079EU, 0x0291U, 0x079AU, 0x00FFU, 0x00FFU,
+    0x0600U, 0x0821U, 0x0811U, 0x0676U, 0x0809U, 0x0932U, 0x0652U, 0x05A0U, 0x0805U, 0x092AU, 0x091AU, 0x0880U,
+    0x0646U, 0x086EU, 0x0594U, 0x06A5U, 0x0803U, 0x0926U, 0x0916U, 0x087AU, 0x090EU, 0x0A3CU, 0x0856U, 0x06A1U,
+    0x0642U, 0x0862U, 0x0850U, 0x098BU, 0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0440U, 0x055BU, 0x0549U, 0x0878U,
+    0x0543U, 0x0866U, 0x0854U, 0x05A0U, 0x0541U, 0x0860U, 0x084EU, 0x0985U, 0x0848U, 0x0973U, 0x0594U, 0x08A7U,
+    0x0440U, 0x0396U, 0x0392U, 0x049BU, 0x0291U, 0x0497U, 0x0493U, 0x08A3U, 0x0291U, 0x0396U, 0x0392U, 0x089FU,
+    0x0291U, 0x00FFU, 0x00FFU, 0x00FFU, 0x0600U, 0x0720U, 0x0710U, 0x0676U, 0x0708U, 0x0931U, 0x0652U, 0x05A0U,
+    0x0704U, 0x0929U, 0x0919U, 0x077FU, 0x0646U, 0x076DU, 0x0594U, 0x06A5U, 0x0702U, 0x0925U, 0x0915U, 0x0779U,
+    0x090DU, 0x0A3AU, 0x0755U, 0x06A1U, 0x0642U, 0x0761U, 0x074FU, 0x0989U, 0x0291U, 0x0699U, 0x0695U, 0x00FFU,
+    0x0701U, 0x0923U, 0x0913U, 0x0777U, 0x090BU, 0x0A36U, 0x0753U, 0x05A0U, 0x0907U, 0x0A2EU, 0x0A1EU, 0x0983U,
+    0x0747U, 0x0971U, 0x0594U, 0x07A6U, 0x0440U, 0x075DU, 0x074BU, 0x097DU, 0x0745U, 0x096BU, 0x0959U, 0x07A2U,
+    0x0291U, 0x0396U, 0x0392U, 0x079EU, 0x0291U, 0x079AU, 0x00FFU, 0x00FFU, 0x0600U, 0x055BU, 0x0549U, 0x0676U,
+    0x0543U, 0x0664U, 0x0652U, 0x05A0U, 0x0541U, 0x065EU, 0x064CU, 0x0981U, 0x0646U, 0x096FU, 0x0594U, 0x06A5U,
+    0x0440U, 0x065CU, 0x064AU, 0x097BU, 0x0644U, 0x0969U, 0x0957U, 0x06A1U, 0x0642U, 0x0963U, 0x0951U, 0x0A8EU,
+    0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0440U, 0x055BU, 0x0549U, 0x049BU, 0x0543U, 0x0497U, 0x0493U, 0x05A0U,
+    0x0541U, 0x0396U, 0x0392U, 0x059CU, 0x0291U, 0x0598U, 0x0594U, 0x09A8U, 0x0440U, 0x0396U, 0x0392U, 0x049BU,
+    0x0291U, 0x0497U, 0x0493U, 0x09A4U, 0x0291U, 0x0396U, 0x0392U, 0x00FFU, 0x0291U, 0x00FFU, 0x00FFU, 0x00FFU,
+    0x0600U, 0x0720U, 0x0710U, 0x0676U, 0x0708U, 0x0830U, 0x0652U, 0x05A0U, 0x0704U, 0x0828U, 0x0818U, 0x077FU,
+    0x0646U, 0x076DU, 0x0594U, 0x06A5U, 0x0702U, 0x0824U, 0x0814U, 0x0779U, 0x080CU, 0x0A39U, 0x0755U, 0x06A1U,
+    0x0642U, 0x0761U, 0x074FU, 0x0888U, 0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0701U, 0x0822U, 0x0812U, 0x0777U,
+    0x080AU, 0x0A35U, 0x0753U, 0x05A0U, 0x0806U, 0x0A2DU, 0x0A1DU, 0x0882U, 0x0747U, 0x0870U, 0x0594U, 0x07A6U,
+    0x0440U, 0x075DU, 0x074BU, 0x087CU, 0x0745U, 0x086AU, 0x0858U, 0x07A2U, 0x0291U, 0x0396U, 0x0392U, 0x079EU,
+    0x0291U, 0x079AU, 0x00FFU, 0x00FFU, 0x0600U, 0x0821U, 0x0811U, 0x0676U, 0x0809U, 0x0A33U, 0x0652U, 0x05A0U,
+    0x0805U, 0x0A2BU, 0x0A1BU, 0x0880U, 0x0646U, 0x086EU, 0x0594U, 0x06A5U, 0x0803U, 0x0A27U, 0x0A17U, 0x087AU,
+    0x0A0FU, 0x0B3EU, 0x0856U, 0x06A1U, 0x0642U, 0x0862U, 0x0850U, 0x0A8CU, 0x0291U, 0x0699U, 0x0695U, 0x00FFU,
+    0x0440U, 0x055BU, 0x0549U, 0x0878U, 0x0543U, 0x0866U, 0x0854U, 0x05A0U, 0x0541U, 0x0860U, 0x084EU, 0x0A86U,
+    0x0848U, 0x0A74U, 0x0594U, 0x08A7U, 0x0440U, 0x0396U, 0x0392U, 0x049BU, 0x0291U, 0x0497U, 0x0493U, 0x08A3U,
+    0x0291U, 0x0396U, 0x0392U, 0x089FU, 0x0291U, 0x00FFU, 0x00FFU, 0x00FFU, 0x0600U, 0x0720U, 0x0710U, 0x0676U,
+    0x0708U, 0x0664U, 0x0652U, 0x05A0U, 0x0704U, 0x065EU, 0x064CU, 0x077FU, 0x0646U, 0x076DU, 0x0594U, 0x06A5U,
+    0x0702U, 0x065CU, 0x064AU, 0x0779U, 0x0644U, 0x0767U, 0x0755U, 0x06A1U, 0x0642U, 0x0761U, 0x074FU, 0x0A8AU,
+    0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0701U, 0x055BU, 0x0549U, 0x0777U, 0x0543U, 0x0765U, 0x0753U, 0x05A0U,
+    0x0541U, 0x075FU, 0x074DU, 0x0A84U, 0x0747U, 0x0A72U, 0x0594U, 0x07A6U, 0x0440U, 0x075DU, 0x074BU, 0x0A7EU,
+    0x0745U, 0x0A6CU, 0x0A5AU, 0x07A2U, 0x0291U, 0x0396U, 0x0392U, 0x079EU, 0x0291U, 0x079AU, 0x00FFU, 0x00FFU,
+    0x0600U, 0x055BU, 0x0549U, 0x0676U, 0x0543U, 0x0664U, 0x0652U, 0x05A0U, 0x0541U, 0x065EU, 0x064CU, 0x059CU,
+    0x0646U, 0x0598U, 0x0594U, 0x06A5U, 0x0440U, 0x065CU, 0x064AU, 0x049BU, 0x0644U, 0x0497U, 0x0493U, 0x06A1U,
+    0x0642U, 0x0396U, 0x0392U, 0x069DU, 0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0440U, 0x055BU, 0x0549U, 0x049BU,
+    0x0543U, 0x0497U, 0x0493U, 0x05A0U, 0x0541U, 0x0396U, 0x0392U, 0x059CU, 0x0291U, 0x0598U, 0x0594U, 0x0AA9U,
+    0x0440U, 0x0396U, 0x0392U, 0x049BU, 0x0291U, 0x0497U, 0x0493U, 0x00FFU, 0x0291U, 0x0396U, 0x0392U, 0x00FFU,
+    0x0291U, 0x00FFU, 0x00FFU, 0x00FFU, 0x0600U, 0x0720U, 0x0710U, 0x0676U, 0x0708U, 0x0830U, 0x0652U, 0x05A0U,
+    0x0704U, 0x0828U, 0x0818U, 0x077FU, 0x0646U, 0x076DU, 0x0594U, 0x06A5U, 0x0702U, 0x0824U, 0x0814U, 0x0779U,
+    0x080CU, 0x0938U, 0x0755U, 0x06A1U, 0x0642U, 0x0761U, 0x074FU, 0x0888U, 0x0291U, 0x0699U, 0x0695U, 0x00FFU,
+    0x0701U, 0x0822U, 0x0812U, 0x0777U, 0x080AU, 0x0934U, 0x0753U, 0x05A0U, 0x0806U, 0x092CU, 0x091CU, 0x0882U,
+    0x0747U, 0x0870U, 0x0594U, 0x07A6U, 0x0440U, 0x075DU, 0x074BU, 0x087CU, 0x0745U, 0x086AU, 0x0858U, 0x07A2U,
+    0x0291U, 0x0396U, 0x0392U, 0x079EU, 0x0291U, 0x079AU, 0x00FFU, 0x00FFU, 0x0600U, 0x0821U, 0x0811U, 0x0676U,
+    0x0809U, 0x0932U, 0x0652U, 0x05A0U, 0x0805U, 0x092AU, 0x091AU, 0x0880U, 0x0646U, 0x086EU, 0x0594U, 0x06A5U,
+    0x0803U, 0x0926U, 0x0916U, 0x087AU, 0x090EU, 0x0B3DU, 0x0856U, 0x06A1U, 0x0642U, 0x0862U, 0x0850U, 0x098BU,
+    0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0440U, 0x055BU, 0x0549U, 0x0878U, 0x0543U, 0x0866U, 0x0854U, 0x05A0U,
+    0x0541U, 0x0860U, 0x084EU, 0x0985U, 0x0848U, 0x0973U, 0x0594U, 0x08A7U, 0x0440U, 0x0396U, 0x0392U, 0x049BU,
+    0x0291U, 0x0497U, 0x0493U, 0x08A3U, 0x0291U, 0x0396U, 0x0392U, 0x089FU, 0x0291U, 0x00FFU, 0x00FFU, 0x00FFU,
+    0x0600U, 0x0720U, 0x0710U, 0x0676U, 0x0708U, 0x0931U, 0x0652U, 0x05A0U, 0x0704U, 0x0929U, 0x0919U, 0x077FU,
+    0x0646U, 0x076DU, 0x0594U, 0x06A5U, 0x0702U, 0x0925U, 0x0915U, 0x0779U, 0x090DU, 0x0B3BU, 0x0755U, 0x06A1U,
+    0x0642U, 0x0761U, 0x074FU, 0x0989U, 0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0701U, 0x0923U, 0x0913U, 0x0777U,
+    0x090BU, 0x0B37U, 0x0753U, 0x05A0U, 0x0907U, 0x0B2FU, 0x0B1FU, 0x0983U, 0x0747U, 0x0971U, 0x0594U, 0x07A6U,
+    0x0440U, 0x075DU, 0x074BU, 0x097DU, 0x0745U, 0x096BU, 0x0959U, 0x07A2U, 0x0291U, 0x0396U, 0x0392U, 0x079EU,
+    0x0291U, 0x079AU, 0x00FFU, 0x00FFU, 0x0600U, 0x055BU, 0x0549U, 0x0676U, 0x0543U, 0x0664U, 0x0652U, 0x05A0U,
+    0x0541U, 0x065EU, 0x064CU, 0x0981U, 0x0646U, 0x096FU, 0x0594U, 0x06A5U, 0x0440U, 0x065CU, 0x064AU, 0x097BU,
+    0x0644U, 0x0969U, 0x0957U, 0x06A1U, 0x0642U, 0x0963U, 0x0951U, 0x0B8FU, 0x0291U, 0x0699U, 0x0695U, 0x00FFU,
+    0x0440U, 0x055BU, 0x0549U, 0x049BU, 0x0543U, 0x0497U, 0x0493U, 0x05A0U, 0x0541U, 0x0396U, 0x0392U, 0x059CU,
+    0x0291U, 0x0598U, 0x0594U, 0x09A8U, 0x0440U, 0x0396U, 0x0392U, 0x049BU, 0x0291U, 0x0497U, 0x0493U, 0x09A4U,
+    0x0291U, 0x0396U, 0x0392U, 0x00FFU, 0x0291U, 0x00FFU, 0x00FFU, 0x00FFU, 0x0600U, 0x0720U, 0x0710U, 0x0676U,
+    0x0708U, 0x0830U, 0x0652U, 0x05A0U, 0x0704U, 0x0828U, 0x0818U, 0x077FU, 0x0646U, 0x076DU, 0x0594U, 0x06A5U,
+    0x0702U, 0x0824U, 0x0814U, 0x0779U, 0x080CU, 0x0767U, 0x0755U, 0x06A1U, 0x0642U, 0x0761U, 0x074FU, 0x0888U,
+    0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0701U, 0x0822U, 0x0812U, 0x0777U, 0x080AU, 0x0765U, 0x0753U, 0x05A0U,
+    0x0806U, 0x075FU, 0x074DU, 0x0882U, 0x0747U, 0x0870U, 0x0594U, 0x07A6U, 0x0440U, 0x075DU, 0x074BU, 0x087CU,
+    0x0745U, 0x086AU, 0x0858U, 0x07A2U, 0x0291U, 0x0396U, 0x0392U, 0x079EU, 0x0291U, 0x079AU, 0x00FFU, 0x00FFU,
+    0x0600U, 0x0821U, 0x0811U, 0x0676U, 0x0809U, 0x0664U, 0x0652U, 0x05A0U, 0x0805U, 0x065EU, 0x064CU, 0x0880U,
+    0x0646U, 0x086EU, 0x0594U, 0x06A5U, 0x0803U, 0x065CU, 0x064AU, 0x087AU, 0x0644U, 0x0868U, 0x0856U, 0x06A1U,
+    0x0642U, 0x0862U, 0x0850U, 0x0B8DU, 0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0440U, 0x055BU, 0x0549U, 0x0878U,
+    0x0543U, 0x0866U, 0x0854U, 0x05A0U, 0x0541U, 0x0860U, 0x084EU, 0x0B87U, 0x0848U, 0x0B75U, 0x0594U, 0x08A7U,
+    0x0440U, 0x0396U, 0x0392U, 0x049BU, 0x0291U, 0x0497U, 0x0493U, 0x08A3U, 0x0291U, 0x0396U, 0x0392U, 0x089FU,
+    0x0291U, 0x00FFU, 0x00FFU, 0x00FFU, 0x0600U, 0x0720U, 0x0710U, 0x0676U, 0x0708U, 0x0664U, 0x0652U, 0x05A0U,
+    0x0704U, 0x065EU, 0x064CU, 0x077FU, 0x0646U, 0x076DU, 0x0594U, 0x06A5U, 0x0702U, 0x065CU, 0x064AU, 0x0779U,
+    0x0644U, 0x0767U, 0x0755U, 0x06A1U, 0x0642U, 0x0761U, 0x074FU, 0x069DU, 0x0291U, 0x0699U, 0x0695U, 0x00FFU,
+    0x0701U, 0x055BU, 0x0549U, 0x0777U, 0x0543U, 0x0765U, 0x0753U, 0x05A0U, 0x0541U, 0x075FU, 0x074DU, 0x059CU,
+    0x0747U, 0x0598U, 0x0594U, 0x07A6U, 0x0440U, 0x075DU, 0x074BU, 0x049BU, 0x0745U, 0x0497U, 0x0493U, 0x07A2U,
+    0x0291U, 0x0396U, 0x0392U, 0x079EU, 0x0291U, 0x079AU, 0x00FFU, 0x00FFU, 0x0600U, 0x055BU, 0x0549U, 0x0676U,
+    0x0543U, 0x0664U, 0x0652U, 0x05A0U, 0x0541U, 0x065EU, 0x064CU, 0x059CU, 0x0646U, 0x0598U, 0x0594U, 0x06A5U,
+    0x0440U, 0x065CU, 0x064AU, 0x049BU, 0x0644U, 0x0497U, 0x0493U, 0x06A1U, 0x0642U, 0x0396U, 0x0392U, 0x069DU,
+    0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0440U, 0x055BU, 0x0549U, 0x049BU, 0x0543U, 0x0497U, 0x0493U, 0x05A0U,
+    0x0541U, 0x0396U, 0x0392U, 0x059CU, 0x0291U, 0x0598U, 0x0594U, 0x00FFU, 0x0440U, 0x0396U, 0x0392U, 0x049BU,
+    0x0291U, 0x0497U, 0x0493U, 0x00FFU, 0x0291U, 0x0396U, 0x0392U, 0x00FFU, 0x0291U, 0x00FFU, 0x00FFU, 0x00FFU,
+    0x0600U, 0x0720U, 0x0710U, 0x0676U, 0x0708U, 0x0830U, 0x0652U, 0x05A0U, 0x0704U, 0x0828U, 0x0818U, 0x077FU,
+    0x0646U, 0x076DU, 0x0594U, 0x06A5U, 0x0702U, 0x0824U, 0x0814U, 0x0779U, 0x080CU, 0x0938U, 0x0755U, 0x06A1U,
+    0x0642U, 0x0761U, 0x074FU, 0x0888U, 0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0701U, 0x0822U, 0x0812U, 0x0777U,
+    0x080AU, 0x0934U, 0x0753U, 0x05A0U, 0x0806U, 0x092CU, 0x091CU, 0x0882U, 0x0747U, 0x0870U, 0x0594U, 0x07A6U,
+    0x0440U, 0x075DU, 0x074BU, 0x087CU, 0x0745U, 0x086AU, 0x0858U, 0x07A2U, 0x0291U, 0x0396U, 0x0392U, 0x079EU,
+    0x0291U, 0x079AU, 0x00FFU, 0x00FFU, 0x0600U, 0x0821U, 0x0811U, 0x0676U, 0x0809U, 0x0932U, 0x0652U, 0x05A0U,
+    0x0805U, 0x092AU, 0x091AU, 0x0880U, 0x0646U, 0x086EU, 0x0594U, 0x06A5U, 0x0803U, 0x0926U, 0x0916U, 0x087AU,
+    0x090EU, 0x0A3CU, 0x0856U, 0x06A1U, 0x0642U, 0x0862U, 0x0850U, 0x098BU, 0x0291U, 0x0699U, 0x0695U, 0x00FFU,
+    0x0440U, 0x055BU, 0x0549U, 0x0878U, 0x0543U, 0x0866U, 0x0854U, 0x05A0U, 0x0541U, 0x0860U, 0x084EU, 0x0985U,
+    0x0848U, 0x0973U, 0x0594U, 0x08A7U, 0x0440U, 0x0396U, 0x0392U, 0x049BU, 0x0291U, 0x0497U, 0x0493U, 0x08A3U,
+    0x0291U, 0x0396U, 0x0392U, 0x089FU, 0x0291U, 0x00FFU, 0x00FFU, 0x00FFU, 0x0600U, 0x0720U, 0x0710U, 0x0676U,
+    0x0708U, 0x0931U, 0x0652U, 0x05A0U, 0x0704U, 0x0929U, 0x0919U, 0x077FU, 0x0646U, 0x076DU, 0x0594U, 0x06A5U,
+    0x0702U, 0x0925U, 0x0915U, 0x0779U, 0x090DU, 0x0A3AU, 0x0755U, 0x06A1U, 0x0642U, 0x0761U, 0x074FU, 0x0989U,
+    0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0701U, 0x0923U, 0x0913U, 0x0777U, 0x090BU, 0x0A36U, 0x0753U, 0x05A0U,
+    0x0907U, 0x0A2EU, 0x0A1EU, 0x0983U, 0x0747U, 0x0971U, 0x0594U, 0x07A6U, 0x0440U, 0x075DU, 0x074BU, 0x097DU,
+    0x0745U, 0x096BU, 0x0959U, 0x07A2U, 0x0291U, 0x0396U, 0x0392U, 0x079EU, 0x0291U, 0x079AU, 0x00FFU, 0x00FFU,
+    0x0600U, 0x055BU, 0x0549U, 0x0676U, 0x0543U, 0x0664U, 0x0652U, 0x05A0U, 0x0541U, 0x065EU, 0x064CU, 0x0981U,
+    0x0646U, 0x096FU, 0x0594U, 0x06A5U, 0x0440U, 0x065CU, 0x064AU, 0x097BU, 0x0644U, 0x0969U, 0x0957U, 0x06A1U,
+    0x0642U, 0x0963U, 0x0951U, 0x0A8EU, 0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0440U, 0x055BU, 0x0549U, 0x049BU,
+    0x0543U, 0x0497U, 0x0493U, 0x05A0U, 0x0541U, 0x0396U, 0x0392U, 0x059CU, 0x0291U, 0x0598U, 0x0594U, 0x09A8U,
+    0x0440U, 0x0396U, 0x0392U, 0x049BU, 0x0291U, 0x0497U, 0x0493U, 0x09A4U, 0x0291U, 0x0396U, 0x0392U, 0x00FFU,
+    0x0291U, 0x00FFU, 0x00FFU, 0x00FFU, 0x0600U, 0x0720U, 0x0710U, 0x0676U, 0x0708U, 0x0830U, 0x0652U, 0x05A0U,
+    0x0704U, 0x0828U, 0x0818U, 0x077FU, 0x0646U, 0x076DU, 0x0594U, 0x06A5U, 0x0702U, 0x0824U, 0x0814U, 0x0779U,
+    0x080CU, 0x0A39U, 0x0755U, 0x06A1U, 0x0642U, 0x0761U, 0x074FU, 0x0888U, 0x0291U, 0x0699U, 0x0695U, 0x00FFU,
+    0x0701U, 0x0822U, 0x0812U, 0x0777U, 0x080AU, 0x0A35U, 0x0753U, 0x05A0U, 0x0806U, 0x0A2DU, 0x0A1DU, 0x0882U,
+    0x0747U, 0x0870U, 0x0594U, 0x07A6U, 0x0440U, 0x075DU, 0x074BU, 0x087CU, 0x0745U, 0x086AU, 0x0858U, 0x07A2U,
+    0x0291U, 0x0396U, 0x0392U, 0x079EU, 0x0291U, 0x079AU, 0x00FFU, 0x00FFU, 0x0600U, 0x0821U, 0x0811U, 0x0676U,
+    0x0809U, 0x0A33U, 0x0652U, 0x05A0U, 0x0805U, 0x0A2BU, 0x0A1BU, 0x0880U, 0x0646U, 0x086EU, 0x0594U, 0x06A5U,
+    0x0803U, 0x0A27U, 0x0A17U, 0x087AU, 0x0A0FU, 0x0868U, 0x0856U, 0x06A1U, 0x0642U, 0x0862U, 0x0850U, 0x0A8CU,
+    0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0440U, 0x055BU, 0x0549U, 0x0878U, 0x0543U, 0x0866U, 0x0854U, 0x05A0U,
+    0x0541U, 0x0860U, 0x084EU, 0x0A86U, 0x0848U, 0x0A74U, 0x0594U, 0x08A7U, 0x0440U, 0x0396U, 0x0392U, 0x049BU,
+    0x0291U, 0x0497U, 0x0493U, 0x08A3U, 0x0291U, 0x0396U, 0x0392U, 0x089FU, 0x0291U, 0x00FFU, 0x00FFU, 0x00FFU,
+    0x0600U, 0x0720U, 0x0710U, 0x0676U, 0x0708U, 0x0664U, 0x0652U, 0x05A0U, 0x0704U, 0x065EU, 0x064CU, 0x077FU,
+    0x0646U, 0x076DU, 0x0594U, 0x06A5U, 0x0702U, 0x065CU, 0x064AU, 0x0779U, 0x0644U, 0x0767U, 0x0755U, 0x06A1U,
+    0x0642U, 0x0761U, 0x074FU, 0x0A8AU, 0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0701U, 0x055BU, 0x0549U, 0x0777U,
+    0x0543U, 0x0765U, 0x0753U, 0x05A0U, 0x0541U, 0x075FU, 0x074DU, 0x0A84U, 0x0747U, 0x0A72U, 0x0594U, 0x07A6U,
+    0x0440U, 0x075DU, 0x074BU, 0x0A7EU, 0x0745U, 0x0A6CU, 0x0A5AU, 0x07A2U, 0x0291U, 0x0396U, 0x0392U, 0x079EU,
+    0x0291U, 0x079AU, 0x00FFU, 0x00FFU, 0x0600U, 0x055BU, 0x0549U, 0x0676U, 0x0543U, 0x0664U, 0x0652U, 0x05A0U,
+    0x0541U, 0x065EU, 0x064CU, 0x059CU, 0x0646U, 0x0598U, 0x0594U, 0x06A5U, 0x0440U, 0x065CU, 0x064AU, 0x049BU,
+    0x0644U, 0x0497U, 0x0493U, 0x06A1U, 0x0642U, 0x0396U, 0x0392U, 0x069DU, 0x0291U, 0x0699U, 0x0695U, 0x00FFU,
+    0x0440U, 0x055BU, 0x0549U, 0x049BU, 0x0543U, 0x0497U, 0x0493U, 0x05A0U, 0x0541U, 0x0396U, 0x0392U, 0x059CU,
+    0x0291U, 0x0598U, 0x0594U, 0x0AA9U, 0x0440U, 0x0396U, 0x0392U, 0x049BU, 0x0291U, 0x0497U, 0x0493U, 0x00FFU,
+    0x0291U, 0x0396U, 0x0392U, 0x00FFU, 0x0291U, 0x00FFU, 0x00FFU, 0x00FFU, 0x0600U, 0x0720U, 0x0710U, 0x0676U,
+    0x0708U, 0x0830U, 0x0652U, 0x05A0U, 0x0704U, 0x0828U, 0x0818U, 0x077FU, 0x0646U, 0x076DU, 0x0594U, 0x06A5U,
+    0x0702U, 0x0824U, 0x0814U, 0x0779U, 0x080CU, 0x0938U, 0x0755U, 0x06A1U, 0x0642U, 0x0761U, 0x074FU, 0x0888U,
+    0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0701U, 0x0822U, 0x0812U, 0x0777U, 0x080AU, 0x0934U, 0x0753U, 0x05A0U,
+    0x0806U, 0x092CU, 0x091CU, 0x0882U, 0x0747U, 0x0870U, 0x0594U, 0x07A6U, 0x0440U, 0x075DU, 0x074BU, 0x087CU,
+    0x0745U, 0x086AU, 0x0858U, 0x07A2U, 0x0291U, 0x0396U, 0x0392U, 0x079EU, 0x0291U, 0x079AU, 0x00FFU, 0x00FFU,
+    0x0600U, 0x0821U, 0x0811U, 0x0676U, 0x0809U, 0x0932U, 0x0652U, 0x05A0U, 0x0805U, 0x092AU, 0x091AU, 0x0880U,
+    0x0646U, 0x086EU, 0x0594U, 0x06A5U, 0x0803U, 0x0926U, 0x0916U, 0x087AU, 0x090EU, 0x0868U, 0x0856U, 0x06A1U,
+    0x0642U, 0x0862U, 0x0850U, 0x098BU, 0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0440U, 0x055BU, 0x0549U, 0x0878U,
+    0x0543U, 0x0866U, 0x0854U, 0x05A0U, 0x0541U, 0x0860U, 0x084EU, 0x0985U, 0x0848U, 0x0973U, 0x0594U, 0x08A7U,
+    0x0440U, 0x0396U, 0x0392U, 0x049BU, 0x0291U, 0x0497U, 0x0493U, 0x08A3U, 0x0291U, 0x0396U, 0x0392U, 0x089FU,
+    0x0291U, 0x00FFU, 0x00FFU, 0x00FFU, 0x0600U, 0x0720U, 0x0710U, 0x0676U, 0x0708U, 0x0931U, 0x0652U, 0x05A0U,
+    0x0704U, 0x0929U, 0x0919U, 0x077FU, 0x0646U, 0x076DU, 0x0594U, 0x06A5U, 0x0702U, 0x0925U, 0x0915U, 0x0779U,
+    0x090DU, 0x0767U, 0x0755U, 0x06A1U, 0x0642U, 0x0761U, 0x074FU, 0x0989U, 0x0291U, 0x0699U, 0x0695U, 0x00FFU,
+    0x0701U, 0x0923U, 0x0913U, 0x0777U, 0x090BU, 0x0765U, 0x0753U, 0x05A0U, 0x0907U, 0x075FU, 0x074DU, 0x0983U,
+    0x0747U, 0x0971U, 0x0594U, 0x07A6U, 0x0440U, 0x075DU, 0x074BU, 0x097DU, 0x0745U, 0x096BU, 0x0959U, 0x07A2U,
+    0x0291U, 0x0396U, 0x0392U, 0x079EU, 0x0291U, 0x079AU, 0x00FFU, 0x00FFU, 0x0600U, 0x055BU, 0x0549U, 0x0676U,
+    0x0543U, 0x0664U, 0x0652U, 0x05A0U, 0x0541U, 0x065EU, 0x064CU, 0x0981U, 0x0646U, 0x096FU, 0x0594U, 0x06A5U,
+    0x0440U, 0x065CU, 0x064AU, 0x097BU, 0x0644U, 0x0969U, 0x0957U, 0x06A1U, 0x0642U, 0x0963U, 0x0951U, 0x069DU,
+    0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0440U, 0x055BU, 0x0549U, 0x049BU, 0x0543U, 0x0497U, 0x0493U, 0x05A0U,
+    0x0541U, 0x0396U, 0x0392U, 0x059CU, 0x0291U, 0x0598U, 0x0594U, 0x09A8U, 0x0440U, 0x0396U, 0x0392U, 0x049BU,
+    0x0291U, 0x0497U, 0x0493U, 0x09A4U, 0x0291U, 0x0396U, 0x0392U, 0x00FFU, 0x0291U, 0x00FFU, 0x00FFU, 0x00FFU,
+    0x0600U, 0x0720U, 0x0710U, 0x0676U, 0x0708U, 0x0830U, 0x0652U, 0x05A0U, 0x0704U, 0x0828U, 0x0818U, 0x077FU,
+    0x0646U, 0x076DU, 0x0594U, 0x06A5U, 0x0702U, 0x0824U, 0x0814U, 0x0779U, 0x080CU, 0x0767U, 0x0755U, 0x06A1U,
+    0x0642U, 0x0761U, 0x074FU, 0x0888U, 0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0701U, 0x0822U, 0x0812U, 0x0777U,
+    0x080AU, 0x0765U, 0x0753U, 0x05A0U, 0x0806U, 0x075FU, 0x074DU, 0x0882U, 0x0747U, 0x0870U, 0x0594U, 0x07A6U,
+    0x0440U, 0x075DU, 0x074BU, 0x087CU, 0x0745U, 0x086AU, 0x0858U, 0x07A2U, 0x0291U, 0x0396U, 0x0392U, 0x079EU,
+    0x0291U, 0x079AU, 0x00FFU, 0x00FFU, 0x0600U, 0x0821U, 0x0811U, 0x0676U, 0x0809U, 0x0664U, 0x0652U, 0x05A0U,
+    0x0805U, 0x065EU, 0x064CU, 0x0880U, 0x0646U, 0x086EU, 0x0594U, 0x06A5U, 0x0803U, 0x065CU, 0x064AU, 0x087AU,
+    0x0644U, 0x0868U, 0x0856U, 0x06A1U, 0x0642U, 0x0862U, 0x0850U, 0x069DU, 0x0291U, 0x0699U, 0x0695U, 0x00FFU,
+    0x0440U, 0x055BU, 0x0549U, 0x0878U, 0x0543U, 0x0866U, 0x0854U, 0x05A0U, 0x0541U, 0x0860U, 0x084EU, 0x059CU,
+    0x0848U, 0x0598U, 0x0594U, 0x08A7U, 0x0440U, 0x0396U, 0x0392U, 0x049BU, 0x0291U, 0x0497U, 0x0493U, 0x08A3U,
+    0x0291U, 0x0396U, 0x0392U, 0x089FU, 0x0291U, 0x00FFU, 0x00FFU, 0x00FFU, 0x0600U, 0x0720U, 0x0710U, 0x0676U,
+    0x0708U, 0x0664U, 0x0652U, 0x05A0U, 0x0704U, 0x065EU, 0x064CU, 0x077FU, 0x0646U, 0x076DU, 0x0594U, 0x06A5U,
+    0x0702U, 0x065CU, 0x064AU, 0x0779U, 0x0644U, 0x0767U, 0x0755U, 0x06A1U, 0x0642U, 0x0761U, 0x074FU, 0x069DU,
+    0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0701U, 0x055BU, 0x0549U, 0x0777U, 0x0543U, 0x0765U, 0x0753U, 0x05A0U,
+    0x0541U, 0x075FU, 0x074DU, 0x059CU, 0x0747U, 0x0598U, 0x0594U, 0x07A6U, 0x0440U, 0x075DU, 0x074BU, 0x049BU,
+    0x0745U, 0x0497U, 0x0493U, 0x07A2U, 0x0291U, 0x0396U, 0x0392U, 0x079EU, 0x0291U, 0x079AU, 0x00FFU, 0x00FFU,
+    0x0600U, 0x055BU, 0x0549U, 0x0676U, 0x0543U, 0x0664U, 0x0652U, 0x05A0U, 0x0541U, 0x065EU, 0x064CU, 0x059CU,
+    0x0646U, 0x0598U, 0x0594U, 0x06A5U, 0x0440U, 0x065CU, 0x064AU, 0x049BU, 0x0644U, 0x0497U, 0x0493U, 0x06A1U,
+    0x0642U, 0x0396U, 0x0392U, 0x069DU, 0x0291U, 0x0699U, 0x0695U, 0x00FFU, 0x0440U, 0x055BU, 0x0549U, 0x049BU,
+    0x0543U, 0x0497U, 0x0493U, 0x05A0U, 0x0541U, 0x0396U, 0x0392U, 0x059CU, 0x0291U, 0x0598U, 0x0594U, 0x00FFU,
+    0x0440U, 0x0396U, 0x0392U, 0x049BU, 0x0291U, 0x0497U, 0x0493U, 0x00FFU, 0x0291U, 0x0396U, 0x0392U, 0x00FFU,
+    0x0291U, 0x00FFU, 0x00FFU, 0x00FFU
+};
+
+static const int8_t prv_varint_shuf_tbl[170][16] = {
+    {0, -1, 1, -1, 2, -1, 3, -1, 4, -1, 5, -1, -1, -1, -1, -1},
+    {0, -1, 1, -1, 2, -1, 3, -1, 4, -1, 5, 6, -1, -1, -1, -1},
+    {0, -1, 1, -1, 2, -1, 3, -1, 4, 5, 6, -1, -1, -1, -1, -1},
+    {0, -1, 1, -1, 2, -1, 3, -1, 4, 5, 6, 7, -1, -1, -1, -1},
+    {0, -1, 1, -1, 2, -1, 3, 4, 5, -1, 6, -1, -1, -1, -1, -1},
+    {0, -1, 1, -1, 2, -1, 3, 4, 5, -1, 6, 7, -1, -1, -1, -1},
+    {0, -1, 1, -1, 2, -1, 3, 4, 5, 6, 7, -1, -1, -1, -1, -1},
+    {0, -1, 1, -1, 2, -1, 3, 4, 5, 6, 7, 8, -1, -1, -1, -1},
+    {0, -1, 1, -1, 2, 3, 4, -1, 5, -1, 6, -1, -1, -1, -1, -1},
+    {0, -1, 1, -1, 2, 3, 4, -1, 5, -1, 6, 7, -1, -1, -1, -1},
+    {0, -1, 1, -1, 2, 3, 4, -1, 5, 6, 7, -1, -1, -1, -1, -1},
+    {0, -1, 1, -1, 2, 3, 4, -1, 5, 6, 7, 8, -1, -1, -1, -1},
+    {0, -1, 1, -1, 2, 3, 4, 5, 6, -1, 7, -1, -1, -1, -1, -1},
+    {0, -1, 1, -1, 2, 3, 4, 5, 6, -1, 7, 8, -1, -1, -1, -1},
+    {0, -1, 1, -1, 2, 3, 4, 5, 6, 7, 8, -1, -1, -1, -1, -1},
+    {0, -1, 1, -1, 2, 3, 4, 5, 6, 7, 8, 9, -1, -1, -1, -1},
+    {0, -1, 1, 2, 3, -1, 4, -1, 5, -1, 6, -1, -1, -1, -1, -1},
+    {0, -1, 1, 2, 3, -1, 4, -1, 5, -1, 6, 7, -1, -1, -1, -1},
+    {0, -1, 1, 2, 3, -1, 4, -1, 5, 6, 7, -1, -1, -1, -1, -1},
+    {0, -1, 1, 2, 3, -1, 4, -1, 5, 6, 7, 8, -1, -1, -1, -1},
+    {0, -1, 1, 2, 3, -1, 4, 5, 6, -1, 7, -1, -1, -1, -1, -1},
+    {0, -1, 1, 2, 3, -1, 4, 5, 6, -1, 7, 8, -1, -1, -1, -1},
+    {0, -1, 1, 2, 3, -1, 4, 5, 6, 7, 8, -1, -1, -1, -1, -1},
+    {0, -1, 1, 2, 3, -1, 4, 5, 6, 7, 8, 9, -1, -1, -1, -1},
+    {0, -1, 1, 2, 3, 4, 5, -1, 6, -1, 7, -1, -1, -1, -1, -1},
+    {0, -1, 1, 2, 3, 4, 5, -1, 6, -1, 7, 8, -1, -1, -1, -1},
+    {0, -1, 1, 2, 3, 4, 5, -1, 6, 7, 8, -1, -1, -1, -1, -1},
+    {0, -1, 1, 2, 3, 4, 5, -1, 6, 7, 8, 9, -1, -1, -1, -1},
+    {0, -1, 1, 2, 3, 4, 5, 6, 7, -1, 8, -1, -1, -1, -1, -1},
+    {0, -1, 1, 2, 3, 4, 5, 6, 7, -1, 8, 9, -1, -1, -1, -1},
+    {0, -1, 1, 2, 3, 4, 5, 6, 7, 8, 9, -1, -1, -1, -1, -1},
+    {0, -1, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, -1, -1, -1, -1},
+    {0, 1, 2, -1, 3, -1, 4, -1, 5, -1, 6, -1, -1, -1, -1, -1},
+    {0, 1, 2, -1, 3, -1, 4, -1, 5, -1, 6, 7, -1, -1, -1, -1},
+    {0, 1, 2, -1, 3, -1, 4, -1, 5, 6, 7, -1, -1, -1, -1, -1},
+    {0, 1, 2, -1, 3, -1, 4, -1, 5, 6, 7, 8, -1, -1, -1, -1},
+    {0, 1, 2, -1, 3, -1, 4, 5, 6, -1, 7, -1, -1, -1, -1, -1},
+    {0, 1, 2, -1, 3, -1, 4, 5, 6, -1, 7, 8, -1, -1, -1, -1},
+    {0, 1, 2, -1, 3, -1, 4, 5, 6, 7, 8, -1, -1, -1, -1, -1},
+    {0, 1, 2, -1, 3, -1, 4, 5, 6, 7, 8, 9, -1, -1, -1, -1},
+    {0, 1, 2, -1, 3, 4, 5, -1, 6, -1, 7, -1, -1, -1, -1, -1},
+    {0, 1, 2, -1, 3, 4, 5, -1, 6, -1, 7, 8, -1, -1, -1, -1},
+    {0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, -1, -1, -1, -1},
+    {0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, 9, -1, -1, -1, -1},
+    {0, 1, 2, -1, 3, 4, 5, 6, 7, -1, 8, -1, -1, -1, -1, -1},
+    {0, 1, 2, -1, 3, 4, 5, 6, 7, -1, 8, 9, -1, -1, -1, -1},
+    {0, 1, 2, -1, 3, 4, 5, 6, 7, 8, 9, -1, -1, -1, -1, -1},
+    {0, 1, 2, -1, 3, 4, 5, 6, 7, 8, 9, 10, -1, -1, -1, -1},
+    {0, 1, 2, 3, 4, -1, 5, -1, 6, -1, 7, -1, -1, -1, -1, -1},
+    {0, 1, 2, 3, 4, -1, 5, -1, 6, -1, 7, 8, -1, -1, -1, -1},
+    {0, 1, 2, 3, 4, -1, 5, -1, 6, 7, 8, -1, -1, -1, -1, -1},
+    {0, 1, 2, 3, 4, -1, 5, -1, 6, 7, 8, 9, -1, -1, -1, -1},
+    {0, 1, 2, 3, 4, -1, 5, 6, 7, -1, 8, -1, -1, -1, -1, -1},
+    {0, 1, 2, 3, 4, -1, 5, 6, 7, -1, 8, 9, -1, -1, -1, -1},
+    {0, 1, 2, 3, 4, -1, 5, 6, 7, 8, 9, -1, -1, -1, -1, -1},
+    {0, 1, 2, 3, 4, -1, 5, 6, 7, 8, 9, 10, -1, -1, -1, -1},
+    {0, 1, 2, 3, 4, 5, 6, -1, 7, -1, 8, -1, -1, -1, -1, -1},
+    {0, 1, 2, 3, 4, 5, 6, -1, 7, -1, 8, 9, -1, -1, -1, -1},
+    {0, 1, 2, 3, 4, 5, 6, -1, 7, 8, 9, -1, -1, -1, -1, -1},
+    {0, 1, 2, 3, 4, 5, 6, -1, 7, 8, 9, 10, -1, -1, -1, -1},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, -1, 9, -1, -1, -1, -1, -1},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, -1, 9, 10, -1, -1, -1, -1},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, -1, -1, -1, -1, -1},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, -1, -1, -1, -1},
+    {0, -1, -1, -1, 1, -1, -1, -1, 2, -1, -1, -1, 3, -1, -1, -1},
+    {0, -1, -1, -1, 1, -1, -1, -1, 2, -1, -1, -1, 3, 4, -1, -1},
+    {0, -1, -1, -1, 1, -1, -1, -1, 2, -1, -1, -1, 3, 4, 5, -1},
+    {0, -1, -1, -1, 1, -1, -1, -1, 2, 3, -1, -1, 4, -1, -1, -1},
+    {0, -1, -1, -1, 1, -1, -1, -1, 2, 3, -1, -1, 4, 5, -1, -1},
+    {0, -1, -1, -1, 1, -1, -1, -1, 2, 3, -1, -1, 4, 5, 6, -1},
+    {0, -1, -1, -1, 1, -1, -1, -1, 2, 3, 4, -1, 5, -1, -1, -1},
+    {0, -1, -1, -1, 1, -1, -1, -1, 2, 3, 4, -1, 5, 6, -1, -1},
+    {0, -1, -1, -1, 1, -1, -1, -1, 2, 3, 4, -1, 5, 6, 7, -1},
+    {0, -1, -1, -1, 1, 2, -1, -1, 3, -1, -1, -1, 4, -1, -1, -1},
+    {0, -1, -1, -1, 1, 2, -1, -1, 3, -1, -1, -1, 4, 5, -1, -1},
+    {0, -1, -1, -1, 1, 2, -1, -1, 3, -1, -1, -1, 4, 5, 6, -1},
+    {0, -1, -1, -1, 1, 2, -1, -1, 3, 4, -1, -1, 5, -1, -1, -1},
+    {0, -1, -1, -1, 1, 2, -1, -1, 3, 4, -1, -1, 5, 6, -1, -1},
+    {0, -1, -1, -1, 1, 2, -1, -1, 3, 4, -1, -1, 5, 6, 7, -1},
+    {0, -1, -1, -1, 1, 2, -1, -1, 3, 4, 5, -1, 6, -1, -1, -1},
+    {0, -1, -1, -1, 1, 2, -1, -1, 3, 4, 5, -1, 6, 7, -1, -1},
+    {0, -1, -1, -1, 1, 2, -1, -1, 3, 4, 5, -1, 6, 7, 8, -1},
+    {0, -1, -1, -1, 1, 2, 3, -1, 4, -1, -1, -1, 5, -1, -1, -1},
+    {0, -1, -1, -1, 1, 2, 3, -1, 4, -1, -1, -1, 5, 6, -1, -1},
+    {0, -1, -1, -1, 1, 2, 3, -1, 4, -1, -1, -1, 5, 6, 7, -1},
+    {0, -1, -1, -1, 1, 2, 3, -1, 4, 5, -1, -1, 6, -1, -1, -1},
+    {0, -1, -1, -1, 1, 2, 3, -1, 4, 5, -1, -1, 6, 7, -1, -1},
+    {0, -1, -1, -1, 1, 2, 3, -1, 4, 5, -1, -1, 6, 7, 8, -1},
+    {0, -1, -1, -1, 1, 2, 3, -1, 4, 5, 6, -1, 7, -1, -1, -1},
+    {0, -1, -1, -1, 1, 2, 3, -1, 4, 5, 6, -1, 7, 8, -1, -1},
+    {0, -1, -1, -1, 1, 2, 3, -1, 4, 5, 6, -1, 7, 8, 9, -1},
+    {0, 1, -1, -1, 2, -1, -1, -1, 3, -1, -1, -1, 4, -1, -1, -1},
+    {0, 1, -1, -1, 2, -1, -1, -1, 3, -1, -1, -1, 4, 5, -1, -1},
+    {0, 1, -1, -1, 2, -1, -1, -1, 3, -1, -1, -1, 4, 5, 6, -1},
+    {0, 1, -1, -1, 2, -1, -1, -1, 3, 4, -1, -1, 5, -1, -1, -1},
+    {0, 1, -1, -1, 2, -1, -1, -1, 3, 4, -1, -1, 5, 6, -1, -1},
+    {0, 1, -1, -1, 2, -1, -1, -1, 3, 4, -1, -1, 5, 6, 7, -1},
+    {0, 1, -1, -1, 2, -1, -1, -1, 3, 4, 5, -1, 6, -1, -1, -1},
+    {0, 1, -1, -1, 2, -1, -1, -1, 3, 4, 5, -1, 6, 7, -1, -1},
+    {0, 1, -1, -1, 2, -1, -1, -1, 3, 4, 5, -1, 6, 7, 8, -1},
+    {0, 1, -1, -1, 2, 3, -1, -1, 4, -1, -1, -1, 5, -1, -1, -1},
+    {0, 1, -1, -1, 2, 3, -1, -1, 4, -1, -1, -1, 5, 6, -1, -1},
+    {0, 1, -1, -1, 2, 3, -1, -1, 4, -1, -1, -1, 5, 6, 7, -1},
+    {0, 1, -1, -1, 2, 3, -1, -1, 4, 5, -1, -1, 6, -1, -1, -1},
+    {0, 1, -1, -1, 2, 3, -1, -1, 4, 5, -1, -1, 6, 7, -1, -1},
+    {0, 1, -1, -1, 2, 3, -1, -1, 4, 5, -1, -1, 6, 7, 8, -1},
+    {0, 1, -1, -1, 2, 3, -1, -1, 4, 5, 6, -1, 7, -1, -1, -1},
+    {0, 1, -1, -1, 2, 3, -1, -1, 4, 5, 6, -1, 7, 8, -1, -1},
+    {0, 1, -1, -1, 2, 3, -1, -1, 4, 5, 6, -1, 7, 8, 9, -1},
+    {0, 1, -1, -1, 2, 3, 4, -1, 5, -1, -1, -1, 6, -1, -1, -1},
+    {0, 1, -1, -1, 2, 3, 4, -1, 5, -1, -1, -1, 6, 7, -1, -1},
+    {0, 1, -1, -1, 2, 3, 4, -1, 5, -1, -1, -1, 6, 7, 8, -1},
+    {0, 1, -1, -1, 2, 3, 4, -1, 5, 6, -1, -1, 7, -1, -1, -1},
+    {0, 1, -1, -1, 2, 3, 4, -1, 5, 6, -1, -1, 7, 8, -1, -1},
+    {0, 1, -1, -1, 2, 3, 4, -1, 5, 6, -1, -1, 7, 8, 9, -1},
+    {0, 1, -1, -1, 2, 3, 4, -1, 5, 6, 7, -1, 8, -1, -1, -1},
+    {0, 1, -1, -1, 2, 3, 4, -1, 5, 6, 7, -1, 8, 9, -1, -1},
+    {0, 1, -1, -1, 2, 3, 4, -1, 5, 6, 7, -1, 8, 9, 10, -1},
+    {0, 1, 2, -1, 3, -1, -1, -1, 4, -1, -1, -1, 5, -1, -1, -1},
+    {0, 1, 2, -1, 3, -1, -1, -1, 4, -1, -1, -1, 5, 6, -1, -1},
+    {0, 1, 2, -1, 3, -1, -1, -1, 4, -1, -1, -1, 5, 6, 7, -1},
+    {0, 1, 2, -1, 3, -1, -1, -1, 4, 5, -1, -1, 6, -1, -1, -1},
+    {0, 1, 2, -1, 3, -1, -1, -1, 4, 5, -1, -1, 6, 7, -1, -1},
+    {0, 1, 2, -1, 3, -1, -1, -1, 4, 5, -1, -1, 6, 7, 8, -1},
+    {0, 1, 2, -1, 3, -1, -1, -1, 4, 5, 6, -1, 7, -1, -1, -1},
+    {0, 1, 2, -1, 3, -1, -1, -1, 4, 5, 6, -1, 7, 8, -1, -1},
+    {0, 1, 2, -1, 3, -1, -1, -1, 4, 5, 6, -1, 7, 8, 9, -1},
+    {0, 1, 2, -1, 3, 4, -1, -1, 5, -1, -1, -1, 6, -1, -1, -1},
+    {0, 1, 2, -1, 3, 4, -1, -1, 5, -1, -1, -1, 6, 7, -1, -1},
+    {0, 1, 2, -1, 3, 4, -1, -1, 5, -1, -1, -1, 6, 7, 8, -1},
+    {0, 1, 2, -1, 3, 4, -1, -1, 5, 6, -1, -1, 7, -1, -1, -1},
+    {0, 1, 2, -1, 3, 4, -1, -1, 5, 6, -1, -1, 7, 8, -1, -1},
+    {0, 1, 2, -1, 3, 4, -1, -1, 5, 6, -1, -1, 7, 8, 9, -1},
+    {0, 1, 2, -1, 3, 4, -1, -1, 5, 6, 7, -1, 8, -1, -1, -1},
+    {0, 1, 2, -1, 3, 4, -1, -1, 5, 6, 7, -1, 8, 9, -1, -1},
+    {0, 1, 2, -1, 3, 4, -1, -1, 5, 6, 7, -1, 8, 9, 10, -1},
+    {0, 1, 2, -1, 3, 4, 5, -1, 6, -1, -1, -1, 7, -1, -1, -1},
+    {0, 1, 2, -1, 3, 4, 5, -1, 6, -1, -1, -1, 7, 8, -1, -1},
+    {0, 1, 2, -1, 3, 4, 5, -1, 6, -1, -1, -1, 7, 8, 9, -1},
+    {0, 1, 2, -1, 3, 4, 5, -1, 6, 7, -1, -1, 8, -1, -1, -1},
+    {0, 1, 2, -1, 3, 4, 5, -1, 6, 7, -1, -1, 8, 9, -1, -1},
+    {0, 1, 2, -1, 3, 4, 5, -1, 6, 7, -1, -1, 8, 9, 10, -1},
+    {0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, -1, -1, -1},
+    {0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, -1, -1},
+    {0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1},
+    {0, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1},
+    {0, -1, -1, -1, -1, -1, -1, -1, 1, 2, -1, -1, -1, -1, -1, -1},
+    {0, -1, -1, -1, -1, -1, -1, -1, 1, 2, 3, -1, -1, -1, -1, -1},
+    {0, -1, -1, -1, -1, -1, -1, -1, 1, 2, 3, 4, -1, -1, -1, -1},
+    {0, -1, -1, -1, -1, -1, -1, -1, 1, 2, 3, 4, 5, -1, -1, -1},
+    {0, 1, -1, -1, -1, -1, -1, -1, 2, -1, -1, -1, -1, -1, -1, -1},
+    {0, 1, -1, -1, -1, -1, -1, -1, 2, 3, -1, -1, -1, -1, -1, -1},
+    {0, 1, -1, -1, -1, -1, -1, -1, 2, 3, 4, -1, -1, -1, -1, -1},
+    {0, 1, -1, -1, -1, -1, -1, -1, 2, 3, 4, 5, -1, -1, -1, -1},
+    {0, 1, -1, -1, -1, -1, -1, -1, 2, 3, 4, 5, 6, -1, -1, -1},
+    {0, 1, 2, -1, -1, -1, -1, -1, 3, -1, -1, -1, -1, -1, -1, -1},
+    {0, 1, 2, -1, -1, -1, -1, -1, 3, 4, -1, -1, -1, -1, -1, -1},
+    {0, 1, 2, -1, -1, -1, -1, -1, 3, 4, 5, -1, -1, -1, -1, -1},
+    {0, 1, 2, -1, -1, -1, -1, -1, 3, 4, 5, 6, -1, -1, -1, -1},
+    {0, 1, 2, -1, -1, -1, -1, -1, 3, 4, 5, 6, 7, -1, -1, -1},
+    {0, 1, 2, 3, -1, -1, -1, -1, 4, -1, -1, -1, -1, -1, -1, -1},
+    {0, 1, 2, 3, -1, -1, -1, -1, 4, 5, -1, -1, -1, -1, -1, -1},
+    {0, 1, 2, 3, -1, -1, -1, -1, 4, 5, 6, -1, -1, -1, -1, -1},
+    {0, 1, 2, 3, -1, -1, -1, -1, 4, 5, 6, 7, -1, -1, -1, -1},
+    {0, 1, 2, 3, -1, -1, -1, -1, 4, 5, 6, 7, 8, -1, -1, -1},
+    {0, 1, 2, 3, 4, -1, -1, -1, 5, -1, -1, -1, -1, -1, -1, -1},
+    {0, 1, 2, 3, 4, -1, -1, -1, 5, 6, -1, -1, -1, -1, -1, -1},
+    {0, 1, 2, 3, 4, -1, -1, -1, 5, 6, 7, -1, -1, -1, -1, -1},
+    {0, 1, 2, 3, 4, -1, -1, -1, 5, 6, 7, 8, -1, -1, -1, -1},
+    {0, 1, 2, 3, 4, -1, -1, -1, 5, 6, 7, 8, 9, -1, -1, -1}
+};
+
+/**
+ * \brief           Decode a block of varints with masked-VByte algorithm and SSE4.1 instructions
+ *
+ * Continuation bits of the input block are collected into a mask.
+ * A run of at least `8` single-byte values is widened directly,
+ * otherwise mask of the first `12` bytes selects a shuffle, which moves bytes of `6`, `4` or `2` values
+ * into `16-bit`, `32-bit` or `64-bit` lanes, where continuation bits are removed.
+ * Values of `5` bytes are truncated to `32-bit`, same as by the scalar decoder.
+ *
+ * \param[in]       p: Input data. Must have at least `16` bytes available
+ * \param[out]      vals_out: Output array. Must have at least `16` entries available
+ * \param[out]      len_out: Number of consumed bytes
+ * \return          Number of decoded values, `0` if the first values must be decoded by scalar code
+ */
+LWUTIL_TARGET("sse4.1")
+static size_t
+prv_ld_u32_varint_block_sse41(const uint8_t* p, uint32_t* vals_out, size_t* len_out) {
+    __m128i in = _mm_loadu_si128((const __m128i*)p), v;
+    uint32_t mask;
+    uint16_t entry;
+    uint8_t shuf;
+
+    mask = (uint32_t)_mm_movemask_epi8(in);
+    if ((mask & 0xFFU) == 0) {
+        _mm_storeu_si128((__m128i*)&vals_out[0], _mm_cvtepu8_epi32(in));
+        _mm_storeu_si128((__m128i*)&vals_out[4], _mm_cvtepu8_epi32(_mm_srli_si128(in, 4)));
+        _mm_storeu_si128((__m128i*)&vals_out[8], _mm_cvtepu8_epi32(_mm_srli_si128(in, 8)));
+        _mm_storeu_si128((__m128i*)&vals_out[12], _mm_cvtepu8_epi32(_mm_srli_si128(in, 12)));
+        *len_out = mask == 0 ? 16U : prv_ctz32(mask);
+        return *len_out;
+    }
+    entry = prv_varint_mask_tbl[mask & 0xFFFU];
+    shuf = (uint8_t)entry;
+    if (shuf == PRV_VARINT_SHUF_INVALID) {
+        return 0;
+    }
+    *len_out = (size_t)(entry >> 8U);
+    v = _mm_shuffle_epi8(in, _mm_loadu_si128((const __m128i*)prv_varint_shuf_tbl[shuf]));
+    if (shuf < PRV_VARINT_SHUF_U16_END) {
+        v = _mm_or_si128(_mm_and_si128(v, _mm_set1_epi16(0x007F)),
+                         _mm_and_si128(_mm_srli_epi16(v, 1), _mm_set1_epi16(0x3F80)));
+        _mm_storeu_si128((__m128i*)&vals_out[0], _mm_cvtepu16_epi32(v));
+        _mm_storeu_si128((__m128i*)&vals_out[4], _mm_cvtepu16_epi32(_mm_srli_si128(v, 8)));
+        return 6U;
+    } else if (shuf < PRV_VARINT_SHUF_U32_END) {
+        v = _mm_or_si128(_mm_or_si128(_mm_and_si128(v, _mm_set1_epi32(0x0000007F)),
+                                      _mm_and_si128(_mm_srli_epi32(v, 1), _mm_set1_epi32(0x00003F80))),
+                         _mm_and_si128(_mm_srli_epi32(v, 2), _mm_set1_epi32(0x001FC000)));
+        _mm_storeu_si128((__m128i*)vals_out, v);
+        return 4U;
+    }
+
+    /* Same steps as prv_varint_compact, in each 64-bit lane */
+    v = _mm_and_si128(v, _mm_set1_epi64x(0x0000007F7F7F7F7FLL));
+    v = _mm_or_si128(_mm_srli_epi64(_mm_and_si128(v, _mm_set1_epi64x(0x7F007F007F007F00LL)), 1),
+                     _mm_and_si128(v, _mm_set1_epi64x(0x007F007F007F007FLL)));
+    v = _mm_or_si128(_mm_srli_epi64(_mm_and_si128(v, _mm_set1_epi64x(0x3FFF00003FFF0000LL)), 2),
+                     _mm_and_si128(v, _mm_set1_epi64x(0x00003FFF00003FFFLL)));
+    v = _mm_or_si128(_mm_srli_epi64(_mm_and_si128(v, _mm_set1_epi64x(0x0FFFFFFF00000000LL)), 4),
+                     _mm_and_si128(v, _mm_set1_epi64x(0x000000000FFFFFFFLL)));
+    _mm_storel_epi64((__m128i*)vals_out, _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 2, 0)));
+    return 2U;
+}
+
+/**
+ * \brief           Encode a run of `16` values lower than `128` with SSE4.1 instructions
+ *
+ * Input values are narrowed to bytes with saturation and all of them are written to the output.
+ * Only the values before the first value requiring more than `1` byte are accepted.
+ *
+ * \param[in]       vals: Input values. Must have at least `16` entries available
+ * \param[out]      p: Output data. Must have at least `16` bytes available
+ * \return          Number of encoded values, each of them using exactly `1` byte
+ */
+LWUTIL_TARGET("sse4.1")
+static size_t
+prv_st_u32_varint_run_sse41(const uint32_t* vals, uint8_t* p) {
+    __m128i v[4];
+    uint32_t mask = 0;
+
+    for (size_t i = 0; i < 4U; ++i) {
+        v[i] = _mm_loadu_si128((const __m128i*)&vals[i * 4U]);
+        mask |= (uint32_t)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_srli_epi32(v[i], 7), _mm_setzero_si128())))
+                << (i * 4U);
+    }
+    v[0] = _mm_packus_epi16(_mm_packus_epi32(v[0], v[1]), _mm_packus_epi32(v[2], v[3]));
+    _mm_storeu_si128((__m128i*)p, v[0]);
+
+    /* Mask has bit set for every single-byte value, find first multi-byte one */
+    mask = ~mask & 0xFFFFU;
+    return mask == 0 ? 16U : prv_ctz32(mask);
+}
+
+/**
+ * \brief           Parse a run of up to `16` decimal digits with SSE4.1 instructions
+ *
+ * Digits before the first non-digit character are shifted to the end of the register,
+ * so that leading bytes act as zeros, and then joined in pairs, quads and octets.
+ *
+ * \param[in]       p: Input characters. Must have at least `16` bytes available
+ * \param[out]      val_out: Value of parsed digits
+ * \return          Number of parsed digits, from `0` to `16`
+ */
+LWUTIL_TARGET("sse4.1")
+static size_t
+prv_parse_digits16_sse41(const char* p, uint64_t* val_out) {
+    __m128i d = _mm_sub_epi8(_mm_loadu_si128((const __m128i*)p), _mm_set1_epi8('0'));
+    uint32_t mask, cnt;
+
+    mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(9)), d));
+    cnt = prv_ctz32(~mask);
+
+    /* Negative shuffle indexes clear leading bytes */
+    d = _mm_shuffle_epi8(d, _mm_add_epi8(_mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+                                         _mm_set1_epi8((char)((int)cnt - 16))));
+    d = _mm_maddubs_epi16(d, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1));
+    d = _mm_madd_epi16(d, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+    d = _mm_packus_epi32(d, d);
+    d = _mm_madd_epi16(d, _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
+    *val_out = (uint64_t)(uint32_t)_mm_cvtsi128_si32(d) * 100000000U + (uint32_t)_mm_extract_epi32(d, 1);
+    return cnt;
+}
+
+#endif /* LWUTIL_SIMD_MAX >= 2 */
+
+#if LWUTIL_SIMD_MAX >= 3
+
+/**
+ * \brief           Reverse byte order of every `width`-bytes long element with AVX2 byte shuffle
+ * \param[in]       in: Input bytes
+ * \param[out]      out: Output bytes. May be equal to `in`
+ * \param[in]       len: Number of input bytes. Only multiple of `16` bytes is processed
+ * \param[in]       width: Element width in units of bytes. `2`, `4` or `8`
+ * \return          Number of processed bytes
+ */
+LWUTIL_TARGET("avx2")
+static size_t
+prv_bswap_array_avx2(const uint8_t* in, uint8_t* out, size_t len, size_t width) {
+    uint8_t shuf[16];
+    __m256i mask;
+    size_t idx = 0;
+
+    for (size_t i = 0; i < sizeof(shuf); ++i) {
+        shuf[i] = (uint8_t)((i / width) * width + (width - 1U - (i % width)));
+    }
+    mask = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)shuf));
+    for (; (len - idx) >= 32U; idx += 32U) {
+        _mm256_storeu_si256((__m256i*)&out[idx],
+                            _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)&in[idx]), mask));
+    }
+    return idx + prv_bswap_array_ssse3(&in[idx], &out[idx], len - idx, width);
+}
+
+/**
+ * \brief           Encode block of bytes to hex characters with AVX2 nibble shuffle
+ * \param[in]       p: Input bytes
+ * \param[in]       len: Number of input bytes. Only multiple of `16` bytes is processed
+ * \param[out]      out: Output characters, `2 * len` long
+ * \param[in]       upper: Set to `1` for uppercase letters, `0` for lowercase
+ * \return          Number of processed input bytes
+ */
+LWUTIL_TARGET("avx2")
+static size_t
+prv_hex_encode_avx2(const uint8_t* p, size_t len, char* out, uint8_t upper) {
+    const __m256i lut = _mm256_broadcastsi128_si256(
+        upper ? _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F')
+              : _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'));
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+    size_t idx = 0;
+
+    for (; (len - idx) >= 32U; idx += 32U) {
+        __m256i in = _mm256_loadu_si256((const __m256i*)&p[idx]);
+        __m256i hi = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(in, 4), mask));
+        __m256i lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(in, mask));
+        __m256i r0 = _mm256_unpacklo_epi8(hi, lo), r1 = _mm256_unpackhi_epi8(hi, lo);
+
+        /* Unpack works within 128-bit lanes, restore linear order */
+        _mm256_storeu_si256((__m256i*)&out[2U * idx], _mm256_permute2x128_si256(r0, r1, 0x20));
+        _mm256_storeu_si256((__m256i*)&out[2U * idx + 32U], _mm256_permute2x128_si256(r0, r1, 0x31));
+    }
+    return idx + prv_hex_encode_ssse3(&p[idx], len - idx, &out[2U * idx], upper);
+}
+
+/**
+ * \brief           Decode a block of varints with AVX2 instructions
+ *
+ * A run of at least `16` single-byte values is widened with AVX2 instructions,
+ * other blocks are decoded by \ref prv_ld_u32_varint_block_sse41.
+ *
+ * \param[in]       p: Input data. Must have at least `32` bytes available
+ * \param[out]      vals_out: Output array. Must have at least `32` entries available
+ * \param[out]      len_out: Number of consumed bytes
+ * \return          Number of decoded values, `0` if the first values must be decoded by scalar code
+ */
+LWUTIL_TARGET("avx2")
+static size_t
+prv_ld_u32_varint_block_avx2(const uint8_t* p, uint32_t* vals_out, size_t* len_out) {
+    uint32_t mask;
+
+    mask = (uint32_t)_mm256_movemask_epi8(_mm256_loadu_si256((const __m256i*)p));
+    if ((mask & 0xFFFFU) != 0) {
+        /* Avoid AVX to SSE transition penalty, SSE4.1 kernel is not VEX-encoded */
+        _mm256_zeroupper();
+        return prv_ld_u32_varint_block_sse41(p, vals_out, len_out);
+    }
+    for (size_t i = 0; i < 32U; i += 8U) {
+        _mm256_storeu_si256((__m256i*)&vals_out[i], _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)&p[i])));
+    }
+    *len_out = mask == 0 ? 32U : prv_ctz32(mask);
+    return *len_out;
+}
+
+/**
+ * \brief           Encode a run of `32` values lower than `128` with AVX2 instructions
+ * \param[in]       vals: Input values. Must have at least `32` entries available
+ * \param[out]      p: Output data. Must have at least `32` bytes available
+ * \return          Number of encoded values, each of them using exactly `1` byte
+ */
+LWUTIL_TARGET("avx2")
+static size_t
+prv_st_u32_varint_run_avx2(const uint32_t* vals, uint8_t* p) {
+    __m256i v[4];
+    uint32_t mask = 0;
+
+    for (size_t i = 0; i < 4U; ++i) {
+        v[i] = _mm256_loadu_si256((const __m256i*)&vals[i * 8U]);
+        mask |= (uint32_t)_mm256_movemask_ps(
+                    _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_srli_epi32(v[i], 7), _mm256_setzero_si256())))
+                << (i * 8U);
+    }
+    /* Narrow 32-bit to 8-bit values and restore original order, mixed by in-lane packing */
+    v[0] = _mm256_packus_epi16(_mm256_packus_epi32(v[0], v[1]), _mm256_packus_epi32(v[2], v[3]));
+    v[0] = _mm256_permutevar8x32_epi32(v[0], _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+    _mm256_storeu_si256((__m256i*)p, v[0]);
+
+    /* Mask has bit set for every single-byte value, find first multi-byte one */
+    mask = ~mask;
+    return mask == 0 ? 32U : prv_ctz32(mask);
+}
+
+#endif /* LWUTIL_SIMD_MAX >= 3 */
+
+/**
+ * \brief           Set of accelerated kernels for one SIMD level
+ *
+ * `NULL` kernel means scalar code is used.
+ */
+typedef struct {
+    lwutil_simd_t level;                                                  /*!< SIMD level of the kernels */
+    size_t (*bswap_array)(const uint8_t* in, uint8_t* out, size_t len, size_t width); /*!< Byte swap */
+    size_t (*hex_encode)(const uint8_t* p, size_t len, char* out, uint8_t upper);     /*!< Hex encoder */
+    size_t (*hex_decode)(const char* hex, size_t len, uint8_t* out);                  /*!< Hex decoder */
+    size_t (*ld_varint_block)(const uint8_t* p, uint32_t* vals_out, size_t* len_out); /*!< Varint block decoder */
+    size_t (*st_varint_run)(const uint32_t* vals, uint8_t* p); /*!< Single-byte varint run encoder */
+    size_t varint_run_width; /*!< Number of bytes and values available to varint kernels */
+    size_t (*parse_digits16)(const char* p, uint64_t* val_out); /*!< Decimal digits parser */
+} prv_simd_kernels_t;
+
+/* Kernels for every compiled SIMD level, indexed by level */
+static const prv_simd_kernels_t prv_simd_kernels[] = {
+    {LWUTIL_SIMD_NONE, NULL, NULL, NULL, NULL, NULL, 0, NULL},
+#if LWUTIL_SIMD_MAX >= 1
+    {LWUTIL_SIMD_SSSE3, prv_bswap_array_ssse3, prv_hex_encode_ssse3, prv_hex_decode_ssse3, NULL, NULL, 0, NULL},
+#endif /* LWUTIL_SIMD_MAX >= 1 */
+#if LWUTIL_SIMD_MAX >= 2
+    {LWUTIL_SIMD_SSE41, prv_bswap_array_ssse3, prv_hex_encode_ssse3, prv_hex_decode_ssse3,
+     prv_ld_u32_varint_block_sse41, prv_st_u32_varint_run_sse41, 16U, prv_parse_digits16_sse41},
+#endif /* LWUTIL_SIMD_MAX >= 2 */
+#if LWUTIL_SIMD_MAX >= 3
+    {LWUTIL_SIMD_AVX2, prv_bswap_array_avx2, prv_hex_encode_avx2, prv_hex_decode_ssse3,
+     prv_ld_u32_varint_block_avx2, prv_st_u32_varint_run_avx2, 32U, prv_parse_digits16_sse41},
+#endif /* LWUTIL_SIMD_MAX >= 3 */
+};
+
+#if LWUTIL_SIMD_MAX > 0
+/*
+ * Active SIMD level plus `1`, `0` until bound on first use.
+ * It is atomic, as threads may make their first calls concurrently.
+ */
+#ifdef __cplusplus
+static std::atomic<int> prv_simd_active;
+#define PRV_SIMD_LOAD()     std::atomic_load_explicit(&prv_simd_active, std::memory_order_relaxed)
+#define PRV_SIMD_STORE(val) std::atomic_store_explicit(&prv_simd_active, (val), std::memory_order_relaxed)
+#else
+static atomic_int prv_simd_active;
+#define PRV_SIMD_LOAD()     atomic_load_explicit(&prv_simd_active, memory_order_relaxed)
+#define PRV_SIMD_STORE(val) atomic_store_explicit(&prv_simd_active, (val), memory_order_relaxed)
+#endif /* __cplusplus */
+#endif /* LWUTIL_SIMD_MAX > 0 */
+
+/**
+ * \brief           Get highest SIMD level, supported by the CPU and compiled into the library
+ * 
+ * Result is limited with \ref LWUTIL_CFG_SIMD_LEVEL configuration.
+ * 
+ * \return          Member of \ref lwutil_simd_t enumeration
+ */
+static lwutil_simd_t
+prv_simd_detect(void) {
+    lwutil_simd_t level = (lwutil_simd_t)LWUTIL_SIMD_MAX;
+
+#if defined(LWUTIL_SIMD_DISPATCH)
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        level = LWUTIL_SIMD_AVX2;
+    } else if (__builtin_cpu_supports("sse4.1")) {
+        level = LWUTIL_SIMD_SSE41;
+    } else if (__builtin_cpu_supports("ssse3")) {
+        level = LWUTIL_SIMD_SSSE3;
+    } else {
+        level = LWUTIL_SIMD_NONE;
+    }
+#else
+    {
+        int info[4];
+        int leaves;
+
+        __cpuid(info, 0);
+        leaves = info[0];
+        __cpuid(info, 1);
+        level = LWUTIL_SIMD_NONE;
+        if (info[2] & (1 << 9)) {
+            level = LWUTIL_SIMD_SSSE3;
+            if (info[2] & (1 << 19)) {
+                level = LWUTIL_SIMD_SSE41;
+                /* AVX2 also needs OS support for saving YMM registers */
+                if (leaves >= 7 && (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && (_xgetbv(0) & 0x06U) == 0x06U) {
+                    __cpuidex(info, 7, 0);
+                    if (info[1] & (1 << 5)) {
+                        level = LWUTIL_SIMD_AVX2;
+                    }
+                }
+            }
+        }
+    }
+#endif /* defined(__GNUC__) || defined(__clang__) */
+#endif /* defined(LWUTIL_SIMD_DISPATCH) */
+#if LWUTIL_CFG_SIMD_LEVEL >= 0
+    if ((int)level > LWUTIL_CFG_SIMD_LEVEL) {
+        level = (lwutil_simd_t)LWUTIL_CFG_SIMD_LEVEL;
+    }
+#endif /* LWUTIL_CFG_SIMD_LEVEL >= 0 */
+    return level;
+}
+
+/**
+ * \brief           Get active set of kernels
+ * 
+ * CPU features are detected on first call.
+ * Concurrent first calls detect the same level and store the same value.
+ * 
+ * \return          Active kernels
+ */
+static inline const prv_simd_kernels_t*
+prv_simd(void) {
+#if LWUTIL_SIMD_MAX > 0
+    int active = PRV_SIMD_LOAD();
+
+    if (active == 0) {
+        active = (int)prv_simd_detect() + 1;
+        PRV_SIMD_STORE(active);
+    }
+    return &prv_simd_kernels[active - 1];
+#else
+    return &prv_simd_kernels[0];
+#endif /* LWUTIL_SIMD_MAX > 0 */
+}
+
+/**
+ * \brief           Get SIMD level, used by the accelerated functions
+ * \return          Member of \ref lwutil_simd_t enumeration
+ */
+LWUTIL_API lwutil_simd_t
+lwutil_simd_get_level(void) {
+    return prv_simd()->level;
+}
+
+/**
+ * \brief           Get highest SIMD level, supported by the CPU and compiled into the library
+ * \return          Member of \ref lwutil_simd_t enumeration
+ */
+LWUTIL_API lwutil_simd_t
+lwutil_simd_get_max_level(void) {
+    return prv_simd_detect();
+}
+
+/**
+ * \brief           Set SIMD level, used by the accelerated functions
+ * 
+ * It is used to compare or test kernels of different levels on the same machine.
+ * Function is not thread-safe with other library functions, call it before accelerated functions are used.
+ * 
+ * \note            In header-only mode, every translation unit keeps its own level
+ * 
+ * \param[in]       level: Member of \ref lwutil_simd_t enumeration
+ * \return          `1` on success, `0` if level is higher than \ref lwutil_simd_get_max_level
+ */
+LWUTIL_API uint8_t
+lwutil_simd_set_level(lwutil_simd_t level) {
+    if ((int)level < 0 || level > prv_simd_detect()) {
+        return 0;
+    }
+#if LWUTIL_SIMD_MAX > 0
+    PRV_SIMD_STORE((int)level + 1);
+#endif /* LWUTIL_SIMD_MAX > 0 */
+    return 1;
+}
+
+#if LWUTIL_CFG_STATS
+
+/* Counters are `size_t` wide, as atomic `64-bit` operations are not available on every target */
+#ifdef __cplusplus
+typedef std::atomic<size_t> prv_stats_atomic_t;
+#define PRV_STATS_LOAD(obj)       std::atomic_load_explicit((obj), std::memory_order_relaxed)
+#define PRV_STATS_STORE(obj, val) std::atomic_store_explicit((obj), (val), std::memory_order_relaxed)
+#define PRV_STATS_ADD(obj, val)   std::atomic_fetch_add_explicit((obj), (val), std::memory_order_relaxed)
+#else
+typedef atomic_size_t prv_stats_atomic_t;
+#define PRV_STATS_LOAD(obj)       atomic_load_explicit((obj), memory_order_relaxed)
+#define PRV_STATS_STORE(obj, val) atomic_store_explicit((obj), (val), memory_order_relaxed)
+#define PRV_STATS_ADD(obj, val)   atomic_fetch_add_explicit((obj), (val), memory_order_relaxed)
+#endif /* __cplusplus */
+
+/* Thread-local storage class, slot is shared by all threads when not available */
+#if defined(__cplusplus)
+#define PRV_STATS_TLS thread_local
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_THREADS__)
+#define PRV_STATS_TLS _Thread_local
+#elif defined(__GNUC__) || defined(__clang__)
+#define PRV_STATS_TLS __thread
+#elif defined(_MSC_VER)
+#define PRV_STATS_TLS __declspec(thread)
+#endif
+
+/**
+ * \brief           Counter slot of single thread
+ */
+typedef struct {
+    prv_stats_atomic_t fn[LWUTIL_STATS_FN_END][3];             /*!< Calls, bytes and errors of every function */
+    prv_stats_atomic_t varint_len[LWUTIL_STATS_VARINT_LEN_MAX]; /*!< Decoded varints by length */
+    uint8_t pad[LWUTIL_CFG_CACHE_LINE]; /*!< Keeps counters of neighbour slots in separate cache lines */
+} prv_stats_slot_t;
+
+static prv_stats_slot_t prv_stats_slots[LWUTIL_CFG_STATS_SLOTS];
+static prv_stats_atomic_t prv_stats_next; /* Number of slots, claimed by threads */
+static lwutil_stats_trace_fn prv_stats_trace;
+static void* prv_stats_trace_arg;
+#ifdef PRV_STATS_TLS
+static PRV_STATS_TLS prv_stats_slot_t* prv_stats_slot_tls;
+static PRV_STATS_TLS uint8_t prv_stats_slot_shared;
+#endif /* PRV_STATS_TLS */
+
+/* Function names, indexed by \ref lwutil_stats_fn_t */
+static const char* const prv_stats_names[LWUTIL_STATS_FN_END] = {
+    "ld_u32_varint",       "ld_u64_varint", "st_u32_varint", "st_u64_varint", "ld_u32_varint_array",
+    "st_u32_varint_array", "hex_encode",    "hex_decode",    "u8_to_2asciis", "u16_to_4asciis",
+    "u32_to_8asciis",      "base64_encode", "base64_decode", "crc_update",
+};
+
+/**
+ * \brief           Add value to the counter of current thread's slot
+ * \param[in]       cnt: Counter
+ * \param[in]       val: Value to add
+ * \param[in]       shared: Set to `1` if slot is shared with other threads
+ */
+static inline void
+prv_stats_add(prv_stats_atomic_t* cnt, size_t val, uint8_t shared) {
+    if (shared) {
+        PRV_STATS_ADD(cnt, val);
+    } else {
+        /* Single writer, plain load and store suffice */
+        PRV_STATS_STORE(cnt, PRV_STATS_LOAD(cnt) + val);
+    }
+}
+
+/**
+ * \brief           Get counter slot of current thread
+ *
+ * On first use, thread claims its own counter slot, updated with plain relaxed loads and stores.
+ * When all slots but the last one are claimed, remaining threads share the last slot
+ * and update it with atomic additions.
+ *
+ * \param[out]      shared: Set to `1` if slot is shared with other threads
+ * \return          Counter slot
+ */
+static prv_stats_slot_t*
+prv_stats_slot_get(uint8_t* shared) {
+#ifdef PRV_STATS_TLS
+    if (prv_stats_slot_tls == NULL) {
+        size_t idx = PRV_STATS_ADD(&prv_stats_next, 1U);
+
+        /* Last slot is shared by the remaining threads */
+        prv_stats_slot_shared = idx >= (LWUTIL_CFG_STATS_SLOTS - 1U);
+        prv_stats_slot_tls = &prv_stats_slots[prv_stats_slot_shared ? (LWUTIL_CFG_STATS_SLOTS - 1U) : idx];
+    }
+    *shared = prv_stats_slot_shared;
+    return prv_stats_slot_tls;
+#else
+    *shared = 1;
+    return &prv_stats_slots[LWUTIL_CFG_STATS_SLOTS - 1U];
+#endif /* PRV_STATS_TLS */
+}
+
+/**
+ * \brief           Add varint length histogram of array or streaming decoder to the counters
+ * \param[in]       lens: Number of decoded varints by length, index `0` for `1` byte
+ */
+static void
+prv_stats_record_varint(const size_t* lens) {
+    prv_stats_slot_t* slot;
+    uint8_t shared;
+
+    slot = prv_stats_slot_get(&shared);
+    for (size_t i = 0; i < LWUTIL_STATS_VARINT_LEN_MAX; ++i) {
+        if (lens[i] > 0) {
+            prv_stats_add(&slot->varint_len[i], lens[i], shared);
+        }
+    }
+}
+
+/**
+ * \brief           Add lengths of varints in a block of complete values to the local histogram
+ * \param[in,out]   hist: Local varint length histogram
+ * \param[in]       p: Block of encoded values
+ * \param[in]       len: Block length in units of bytes
+ */
+static void
+prv_stats_varint_scan(size_t* hist, const uint8_t* p, size_t len) {
+    size_t start = 0;
+
+    for (size_t i = 0; i < len; ++i) {
+        if (p[i] < 0x80U) {
+            ++hist[i - start];
+            start = i + 1U;
+        }
+    }
+}
+
+/* Local varint length histogram of array and streaming decoders, added to the counters at once */
+#define PRV_STATS_VARINT_HIST(name)          size_t name[LWUTIL_STATS_VARINT_LEN_MAX] = {0}
+#define PRV_STATS_VARINT_HIST_ADD(hist, len, cnt) ((hist)[(len) - 1U] += (cnt))
+#define PRV_STATS_VARINT_HIST_SCAN(hist, p, len)  prv_stats_varint_scan((hist), (p), (len))
+#define PRV_STATS_VARINT_HIST_FLUSH(hist)    prv_stats_record_varint(hist)
+#else
+#define PRV_STATS_VARINT_HIST(name)
+#define PRV_STATS_VARINT_HIST_ADD(hist, len, cnt)
+#define PRV_STATS_VARINT_HIST_SCAN(hist, p, len)
+#define PRV_STATS_VARINT_HIST_FLUSH(hist)
+#endif /* LWUTIL_CFG_STATS */
+
+/**
+ * \brief           Get snapshot of instrumentation counters, summed over all threads
+ *
+ * Counters of calls, running concurrently with the snapshot, may or may not be included.
+ *
+ * \note            In header-only mode, every translation unit keeps its own counters
+ *
+ * \param[out]      stats: Snapshot output
+ * \return          `1` on success, `0` if instrumentation is disabled with \ref LWUTIL_CFG_STATS
+ */
+LWUTIL_API uint8_t
+lwutil_stats_snapshot(lwutil_stats_t* stats) {
+    if (LWUTIL_IS_NULL(stats)) {
+        return 0;
+    }
+    memset(stats, 0x00, sizeof(*stats));
+#if LWUTIL_CFG_STATS
+    for (size_t s = 0; s < LWUTIL_CFG_STATS_SLOTS; ++s) {
+        prv_stats_slot_t* slot = &prv_stats_slots[s];
+
+        for (size_t i = 0; i < LWUTIL_STATS_FN_END; ++i) {
+            stats->fn[i].calls += PRV_STATS_LOAD(&slot->fn[i][0]);
+            stats->fn[i].bytes += PRV_STATS_LOAD(&slot->fn[i][1]);
+            stats->fn[i].errors += PRV_STATS_LOAD(&slot->fn[i][2]);
+        }
+        for (size_t i = 0; i < LWUTIL_STATS_VARINT_LEN_MAX; ++i) {
+            stats->varint_len[i] += PRV_STATS_LOAD(&slot->varint_len[i]);
+        }
+    }
+    return 1;
+#else
+    return 0;
+#endif /* LWUTIL_CFG_STATS */
+}
+
+/**
+ * \brief           Reset instrumentation counters of all threads to zero
+ *
+ * Counters of calls, running concurrently with the reset, may be kept.
+ */
+LWUTIL_API void
+lwutil_stats_reset(void) {
+#if LWUTIL_CFG_STATS
+    for (size_t s = 0; s < LWUTIL_CFG_STATS_SLOTS; ++s) {
+        prv_stats_slot_t* slot = &prv_stats_slots[s];
+
+        for (size_t i = 0; i < LWUTIL_STATS_FN_END; ++i) {
+            for (size_t k = 0; k < 3U; ++k) {
+                PRV_STATS_STORE(&slot->fn[i][k], 0);
+            }
+        }
+        for (size_t i = 0; i < LWUTIL_STATS_VARINT_LEN_MAX; ++i) {
+            PRV_STATS_STORE(&slot->varint_len[i], 0);
+        }
+    }
+#endif /* LWUTIL_CFG_STATS */
+}
+
+/**
+ * \brief           Set trace callback, called after every instrumented call
+ *
+ * Function is not thread-safe with other library functions,
+ * call it before instrumented functions are used by other threads.
+ *
+ * \param[in]       fn: Callback function. Set to `NULL` to disable tracing
+ * \param[in]       arg: Custom user argument, passed to the callback
+ */
+LWUTIL_API void
+lwutil_stats_set_trace(lwutil_stats_trace_fn fn, void* arg) {
+#if LWUTIL_CFG_STATS
+    prv_stats_trace = fn;
+    prv_stats_trace_arg = arg;
+#else
+    LWUTIL_UNUSED(fn);
+    LWUTIL_UNUSED(arg);
+#endif /* LWUTIL_CFG_STATS */
+}
+
+/**
+ * \brief           Get name of instrumented function, for export of the counters
+ * \param[in]       fn: Instrumented function
+ * \return          Function name without `lwutil_` prefix, `NULL` for invalid value
+ */
+LWUTIL_API const char*
+lwutil_stats_get_name(lwutil_stats_fn_t fn) {
+#if LWUTIL_CFG_STATS
+    if ((size_t)fn < LWUTIL_ASZ(prv_stats_names)) {
+        return prv_stats_names[fn];
+    }
+#else
+    LWUTIL_UNUSED(fn);
+#endif /* LWUTIL_CFG_STATS */
+    return NULL;
+}
+
+/**
+ * \brief           Count single call of instrumented function
+ *
+ * It is called by instrumented functions when \ref LWUTIL_CFG_STATS is enabled.
+ * Every thread updates its own counter slot, until all slots but the last one are claimed.
+ * Remaining threads share the last slot and update it with atomic additions.
+ *
+ * \param[in]       fn: Instrumented function
+ * \param[in]       bytes: Number of bytes, encoded or decoded by the call
+ * \param[in]       err: Set to `1` if call returned an error, `0` otherwise
+ */
+LWUTIL_API void
+lwutil_stats_record(lwutil_stats_fn_t fn, size_t bytes, uint8_t err) {
+#if LWUTIL_CFG_STATS
+    prv_stats_slot_t* slot;
+    lwutil_stats_trace_fn trace = prv_stats_trace;
+    uint8_t shared;
+
+    if ((size_t)fn >= LWUTIL_STATS_FN_END) {
+        return;
+    }
+    slot = prv_stats_slot_get(&shared);
+    prv_stats_add(&slot->fn[fn][0], 1U, shared);
+    if (err) {
+        prv_stats_add(&slot->fn[fn][2], 1U, shared);
+    } else {
+        prv_stats_add(&slot->fn[fn][1], bytes, shared);
+        if (fn <= LWUTIL_STATS_LD_U64_VARINT && bytes > 0 && bytes <= LWUTIL_STATS_VARINT_LEN_MAX) {
+            prv_stats_add(&slot->varint_len[bytes - 1U], 1U, shared);
+        }
+    }
+    if (trace != NULL) {
+        trace(fn, bytes, err, prv_stats_trace_arg);
+    }
+#else
+    LWUTIL_UNUSED(fn);
+    LWUTIL_UNUSED(bytes);
+    LWUTIL_UNUSED(err);
+#endif /* LWUTIL_CFG_STATS */
+}
+
+#if defined(LWUTIL_HOST_LE) || defined(LWUTIL_HOST_BE)
+
+/**
+ * \brief           Reverse byte order of every `width`-bytes long element
+ * 
+ * Elements are processed with SSSE3/AVX2 byte shuffle when supported by the CPU,
+ * remaining elements are swapped with byte-swap instructions.
+ * Input and output may point to the same memory for in-place conversion.
+ * 
+ * \param[in]       in: Input elements
+ * \param[out]      out: Output elements
+ * \param[in]       count: Number of elements
+ * \param[in]       width: Element width in units of bytes. `2`, `4` or `8`
+ */
+static void
+prv_bswap_array(const uint8_t* in, uint8_t* out, size_t count, size_t width) {
+    const prv_simd_kernels_t* simd;
+    size_t idx = 0, len = count * width;
+
+    simd = prv_simd();
+    if (simd->bswap_array != NULL) {
+        idx = simd->bswap_array(in, out, len, width);
+    }
+    for (; idx < len; idx += width) {
+        if (width == 2U) {
+            uint16_t v;
+            memcpy(&v, &in[idx], sizeof(v));
+            v = prv_bswap16(v);
+            memcpy(&out[idx], &v, sizeof(v));
+        } else if (width == 4U) {
+            uint32_t v;
+            memcpy(&v, &in[idx], sizeof(v));
+            v = prv_bswap32(v);
+            memcpy(&out[idx], &v, sizeof(v));
+        } else {
+            uint64_t v;
+            memcpy(&v, &in[idx], sizeof(v));
+            v = prv_bswap64(v);
+            memcpy(&out[idx], &v, sizeof(v));
+        }
+    }
+}
+
+#endif /* defined(LWUTIL_HOST_LE) || defined(LWUTIL_HOST_BE) */
+
+/**
+ * \brief           Convert array of integers between host and little- or big-endian byte array
+ * 
+ * When host byte order matches the requested one, data are only copied.
+ * 
+ * \param[in]       in: Input array
+ * \param[out]      out: Output array. May be equal to `in` for in-place conversion
+ * \param[in]       count: Number of elements
+ * \param[in]       width: Element width in units of bytes. `2`, `4` or `8`
+ * \param[in]       big_endian: Set to `1` for big-endian byte array, `0` for little-endian
+ * \param[in]       store: Set to `1` when `in` holds host integers, `0` when `out` does
+ */
+static void
+prv_endian_array(const void* in, void* out, size_t count, size_t width, uint8_t big_endian, uint8_t store) {
+    if (LWUTIL_IS_NULL(in) || LWUTIL_IS_NULL(out) || count == 0) {
+        return;
+    }
+#if defined(LWUTIL_HOST_LE) || defined(LWUTIL_HOST_BE)
+#if defined(LWUTIL_HOST_BE)
+    if (big_endian) {
+#else
+    if (!big_endian) {
+#endif
+        if (in != out) {
+            memmove(out, in, count * width);
+        }
+    } else {
+        prv_bswap_array((const uint8_t*)in, (uint8_t*)out, count, width);
+    }
+    LWUTIL_UNUSED(store);
+#else
+    /* Host byte order is not known, use generic functions */
+    for (size_t i = 0; i < count; ++i) {
+        const uint8_t* p_in = (const uint8_t*)in + i * width;
+        uint8_t* p_out = (uint8_t*)out + i * width;
+
+        if (width == 2U) {
+            uint16_t v;
+            if (store) {
+                memcpy(&v, p_in, sizeof(v));
+                if (big_endian) {
+                    lwutil_st_u16_be(v, p_out);
+                } else {
+                    lwutil_st_u16_le(v, p_out);
+                }
+            } else {
+                v = big_endian ? lwutil_ld_u16_be(p_in) : lwutil_ld_u16_le(p_in);
+                memcpy(p_out, &v, sizeof(v));
+            }
+        } else if (width == 4U) {
+            uint32_t v;
+            if (store) {
+                memcpy(&v, p_in, sizeof(v));
+                if (big_endian) {
+                    lwutil_st_u32_be(v, p_out);
+                } else {
+                    lwutil_st_u32_le(v, p_out);
+                }
+            } else {
+                v = big_endian ? lwutil_ld_u32_be(p_in) : lwutil_ld_u32_le(p_in);
+                memcpy(p_out, &v, sizeof(v));
+            }
+        } else {
+            uint64_t v;
+            if (store) {
+                memcpy(&v, p_in, sizeof(v));
+                if (big_endian) {
+                    lwutil_st_u64_be(v, p_out);
+                } else {
+                    lwutil_st_u64_le(v, p_out);
+                }
+            } else {
+                v = big_endian ? lwutil_ld_u64_be(p_in) : lwutil_ld_u64_le(p_in);
+                memcpy(p_out, &v, sizeof(v));
+            }
+        }
+    }
+#endif /* defined(LWUTIL_HOST_LE) || defined(LWUTIL_HOST_BE) */
+}
+
+/**
+ * \brief           Store array of `16-bit` values to bytes array in little-endian format
+ * \param[in]       vals: Values to write to output array
+ * \param[in]       count: Number of values in `vals` array
+ * \param[out]      ptr: Minimum `2 * count` bytes long output array to write values to.
+ *                      It may point to `vals` array for in-place conversion
+ */
+LWUTIL_API void
+lwutil_st_u16_le_array(const uint16_t* vals, size_t count, void* ptr) {
+    prv_endian_array(vals, ptr, count, 2U, 0U, 1U);
+}
+
+/**
+ * \brief           Store array of `16-bit` values to bytes array in big-endian format
+ * \param[in]       vals: Values to write to output array
+ * \param[in]       count: Number of values in `vals` array
+ * \param[out]      ptr: Minimum `2 * count` bytes long output array to write values to.
+ *                      It may point to `vals` array for in-place conversion
+ */
+LWUTIL_API void
+lwutil_st_u16_be_array(const uint16_t* vals, size_t count, void* ptr) {
+    prv_endian_array(vals, ptr, count, 2U, 1U, 1U);
+}
+
+/**
+ * \brief           Load array of `16-bit` values from bytes array in little-endian format
+ * \param[in]       ptr: Minimum `2 * count` bytes long input array to extract values from
+ * \param[in]       count: Number of values to load
+ * \param[out]      vals_out: Output array to write values to.
+ *                      It may point to `ptr` array for in-place conversion
+ */
+LWUTIL_API void
+lwutil_ld_u16_le_array(const void* ptr, size_t count, uint16_t* vals_out) {
+    prv_endian_array(ptr, vals_out, count, 2U, 0U, 0U);
+}
+
+/**
+ * \brief           Load array of `16-bit` values from bytes array in big-endian format
+ * \param[in]       ptr: Minimum `2 * count` bytes long input array to extract values from
+ * \param[in]       count: Number of values to load
+ * \param[out]      vals_out: Output array to write values to.
+ *                      It may point to `ptr` array for in-place conversion
+ */
+LWUTIL_API void
+lwutil_ld_u16_be_array(const void* ptr, size_t count, uint16_t* vals_out) {
+    prv_endian_array(ptr, vals_out, count, 2U, 1U, 0U);
+}
+
+/**
+ * \brief           Store array of `32-bit` values to bytes array in little-endian format
+ * \param[in]       vals: Values to write to output array
+ * \param[in]       count: Number of values in `vals` array
+ * \param[out]      ptr: Minimum `4 * count` bytes long output array to write values to.
+ *                      It may point to `vals` array for in-place conversion
+ */
+LWUTIL_API void
+lwutil_st_u32_le_array(const uint32_t* vals, size_t count, void* ptr) {
+    prv_endian_array(vals, ptr, count, 4U, 0U, 1U);
+}
+
+/**
+ * \brief           Store array of `32-bit` values to bytes array in big-endian format
+ * \param[in]       vals: Values to write to output array
+ * \param[in]       count: Number of values in `vals` array
+ * \param[out]      ptr: Minimum `4 * count` bytes long output array to write values to.
+ *                      It may point to `vals` array for in-place conversion
+ */
+LWUTIL_API void
+lwutil_st_u32_be_array(const uint32_t* vals, size_t count, void* ptr) {
+    prv_endian_array(vals, ptr, count, 4U, 1U, 1U);
+}
+
+/**
+ * \brief           Load array of `32-bit` values from bytes array in little-endian format
+ * \param[in]       ptr: Minimum `4 * count` bytes long input array to extract values from
+ * \param[in]       count: Number of values to load
+ * \param[out]      vals_out: Output array to write values to.
+ *                      It may point to `ptr` array for in-place conversion
+ */
+LWUTIL_API void
+lwutil_ld_u32_le_array(const void* ptr, size_t count, uint32_t* vals_out) {
+    prv_endian_array(ptr, vals_out, count, 4U, 0U, 0U);
+}
+
+/**
+ * \brief           Load array of `32-bit` values from bytes array in big-endian format
+ * \param[in]       ptr: Minimum `4 * count` bytes long input array to extract values from
+ * \param[in]       count: Number of values to load
+ * \param[out]      vals_out: Output array to write values to.
+ *                      It may point to `ptr` array for in-place conversion
+ */
+LWUTIL_API void
+lwutil_ld_u32_be_array(const void* ptr, size_t count, uint32_t* vals_out) {
+    prv_endian_array(ptr, vals_out, count, 4U, 1U, 0U);
+}
+
+/**
+ * \brief           Store array of `64-bit` values to bytes array in little-endian format
+ * \param[in]       vals: Values to write to output array
+ * \param[in]       count: Number of values in `vals` array
+ * \param[out]      ptr: Minimum `8 * count` bytes long output array to write values to.
+ *                      It may point to `vals` array for in-place conversion
+ */
+LWUTIL_API void
+lwutil_st_u64_le_array(const uint64_t* vals, size_t count, void* ptr) {
+    prv_endian_array(vals, ptr, count, 8U, 0U, 1U);
+}
+
+/**
+ * \brief           Store array of `64-bit` values to bytes array in big-endian format
+ * \param[in]       vals: Values to write to output array
+ * \param[in]       count: Number of values in `vals` array
+ * \param[out]      ptr: Minimum `8 * count` bytes long output array to write values to.
+ *                      It may point to `vals` array for in-place conversion
+ */
+LWUTIL_API void
+lwutil_st_u64_be_array(const uint64_t* vals, size_t count, void* ptr) {
+    prv_endian_array(vals, ptr, count, 8U, 1U, 1U);
+}
+
+/**
+ * \brief           Load array of `64-bit` values from bytes array in little-endian format
+ * \param[in]       ptr: Minimum `8 * count` bytes long input array to extract values from
+ * \param[in]       count: Number of values to load
+ * \param[out]      vals_out: Output array to write values to.
+ *                      It may point to `ptr` array for in-place conversion
+ */
+LWUTIL_API void
+lwutil_ld_u64_le_array(const void* ptr, size_t count, uint64_t* vals_out) {
+    prv_endian_array(ptr, vals_out, count, 8U, 0U, 0U);
+}
+
+/**
+ * \brief           Load array of `64-bit` values from bytes array in big-endian format
+ * \param[in]       ptr: Minimum `8 * count` bytes long input array to extract values from
+ * \param[in]       count: Number of values to load
+ * \param[out]      vals_out: Output array to write values to.
+ *                      It may point to `ptr` array for in-place conversion
+ */
+LWUTIL_API void
+lwutil_ld_u64_be_array(const void* ptr, size_t count, uint64_t* vals_out) {
+    prv_endian_array(ptr, vals_out, count, 8U, 1U, 0U);
+}
+
+/* Two ASCII characters for every byte value, in lowercase */
+#define PRV_HEX_ROW(h)                                                                                                 \
+    h "0" h "1" h "2" h "3" h "4" h "5" h "6" h "7" h "8" h "9" h "a" h "b" h "c" h "d" h "e" h "f"
+static const char prv_hex_pairs[512U + 1U] = PRV_HEX_ROW("0") PRV_HEX_ROW("1") PRV_HEX_ROW("2") PRV_HEX_ROW("3")
+    PRV_HEX_ROW("4") PRV_HEX_ROW("5") PRV_HEX_ROW("6") PRV_HEX_ROW("7") PRV_HEX_ROW("8") PRV_HEX_ROW("9")
+        PRV_HEX_ROW("a") PRV_HEX_ROW("b") PRV_HEX_ROW("c") PRV_HEX_ROW("d") PRV_HEX_ROW("e") PRV_HEX_ROW("f");
+#undef PRV_HEX_ROW
+
+/**
+ * \brief           Write `2` lowercase ASCII characters for single byte, using pair look-up table
+ * \param[in]       byt: Byte to convert
+ * \param[out]      ascii: Minimum `2-bytes` long array to write characters to
+ */
+static inline void
+prv_hex_pair(uint8_t byt, char* ascii) {
+    memcpy(ascii, &prv_hex_pairs[2U * byt], 2U);
+}
+
+/**
+ * \brief           Write `2` uppercase ASCII characters for single byte, using pair look-up table
+ * 
+ * Lowercase letters `a-f` have bit `6` set and digits do not,
+ * so bit `5` is cleared for letters only, in both characters at once.
+ * 
+ * \param[in]       byt: Byte to convert
+ * \param[out]      ascii: Minimum `2-bytes` long array to write characters to
+ */
+static inline void
+prv_hex_pair_upper(uint8_t byt, char* ascii) {
+    uint16_t pair;
+
+    memcpy(&pair, &prv_hex_pairs[2U * byt], 2U);
+    pair = (uint16_t)(pair - ((pair >> 1U) & 0x2020U));
+    memcpy(ascii, &pair, 2U);
+}
+
+/**
+ * \brief           Makes ascii char array from `unsigned 8-bit` value
+ * \param[in]       hex: Hexadecimal data to be converted
+ * \param[out]      ascii: Minimum `3-bytes` long array to write value to
+ */
+LWUTIL_API void
+lwutil_u8_to_2asciis(uint8_t hex, char* ascii) {
+    prv_hex_pair(hex, &ascii[0]);
+    ascii[2U] = '\0';
+    LWUTIL_STATS_ADD(LWUTIL_STATS_U8_TO_2ASCIIS, 1U, 0);
+}
+
+/**
+ * \brief           Makes ascii char array from `unsigned 16-bit` value
+ * \param[in]       hex: Hexadecimal data to be converted
+ * \param[out]      ascii: Minimum `5-bytes` long array to write value to
+ */
+LWUTIL_API void
+lwutil_u16_to_4asciis(uint16_t hex, char* ascii) {
+    prv_hex_pair((uint8_t)(hex >> 8U), &ascii[0]);
+    prv_hex_pair((uint8_t)hex, &ascii[2]);
+    ascii[4] = '\0';
+    LWUTIL_STATS_ADD(LWUTIL_STATS_U16_TO_4ASCIIS, 2U, 0);
+}
+
+/**
+ * \brief           Makes ascii char array from `unsigned 32-bit` value
+ * \param[in]       hex: Hexadecimal data to be converted
+ * \param[out]      ascii: Minimum `9-bytes` long array to write value to
+ */
+LWUTIL_API void
+lwutil_u32_to_8asciis(uint32_t hex, char* ascii) {
+    prv_hex_pair((uint8_t)(hex >> 24U), &ascii[0]);
+    prv_hex_pair((uint8_t)(hex >> 16U), &ascii[2]);
+    prv_hex_pair((uint8_t)(hex >> 8U), &ascii[4]);
+    prv_hex_pair((uint8_t)hex, &ascii[6]);
+    ascii[8] = '\0';
+    LWUTIL_STATS_ADD(LWUTIL_STATS_U32_TO_8ASCIIS, 4U, 0);
+}
+
+/**
+ * \brief           Encode byte array to hexadecimal ASCII characters
+ * 
+ * Every input byte is written as `2` characters, most significant nibble first.
+ * Output is not NULL-terminated.
+ * Bytes are converted with `512-bytes` pair look-up table, or with SSSE3/AVX2 nibble shuffle,
+ * when instruction set is supported by the CPU.
+ * 
+ * \param[in]       buf: Input data to encode
+ * \param[in]       len: Number of bytes in `buf`
+ * \param[out]      out: Minimum `2 * len` bytes long output array
+ * \param[in]       upper: Set to `1` to use uppercase letters, `0` for lowercase
+ * \return          Number of characters written to `out`. `0` in case of an error.
+ */
+LWUTIL_API size_t
+lwutil_hex_encode(const void* buf, size_t len, char* out, uint8_t upper) {
+    const prv_simd_kernels_t* simd;
+    const uint8_t* p = (const uint8_t*)buf;
+    size_t idx = 0;
+
+    if (LWUTIL_IS_NULL(buf) || LWUTIL_IS_NULL(out)) {
+        LWUTIL_STATS_ADD(LWUTIL_STATS_HEX_ENCODE, 0, 1);
+        return 0;
+    }
+    simd = prv_simd();
+    if (simd->hex_encode != NULL && len >= 16U) {
+        idx = simd->hex_encode(p, len, out, upper);
+    }
+    if (upper) {
+        for (; idx < len; ++idx) {
+            prv_hex_pair_upper(p[idx], &out[2U * idx]);
+        }
+    } else {
+        for (; idx < len; ++idx) {
+            prv_hex_pair(p[idx], &out[2U * idx]);
+        }
+    }
+    LWUTIL_STATS_ADD(LWUTIL_STATS_HEX_ENCODE, len, 0);
+    return 2U * len;
+}
+
+/**
+ * \brief           Decode hexadecimal ASCII characters to byte array
+ * 
+ * Uppercase and lowercase letters are accepted.
+ * Input is fully validated, any other character (including whitespace) is an error.
+ * 
+ * \param[in]       hex: Input characters. It does not need to be NULL-terminated
+ * \param[in]       hex_len: Number of characters in `hex`. Must be even number
+ * \param[out]      out: Minimum `hex_len / 2` bytes long output array
+ * \return          Number of bytes written to `out`.
+ *                      `0` in case of an error, odd length or invalid character
+ */
+LWUTIL_API size_t
+lwutil_hex_decode(const char* hex, size_t hex_len, void* out) {
+    const prv_simd_kernels_t* simd;
+    uint8_t* p = (uint8_t*)out;
+    size_t idx = 0, len;
+
+    if (LWUTIL_IS_NULL(hex) || LWUTIL_IS_NULL(out) || (hex_len & 0x01U) != 0) {
+        LWUTIL_STATS_ADD(LWUTIL_STATS_HEX_DECODE, 0, 1);
+        return 0;
+    }
+    len = hex_len / 2U;
+    simd = prv_simd();
+    if (simd->hex_decode != NULL) {
+        idx = simd->hex_decode(hex, len, p);
+        if (idx == SIZE_MAX) {
+            LWUTIL_STATS_ADD(LWUTIL_STATS_HEX_DECODE, 0, 1);
+            return 0;
+        }
+    }
+    for (; idx < len; ++idx) {
+        uint8_t nib[2];
+
+        for (size_t i = 0; i < 2U; ++i) {
+            uint8_t c = (uint8_t)hex[2U * idx + i];
+
+            if ((uint8_t)(c - '0') < 10U) {
+                nib[i] = (uint8_t)(c - '0');
+            } else if ((uint8_t)((c | 0x20U) - 'a') < 6U) {
+                nib[i] = (uint8_t)((c | 0x20U) - 'a' + 10U);
+            } else {
+                LWUTIL_STATS_ADD(LWUTIL_STATS_HEX_DECODE, 0, 1);
+                return 0;
+            }
+        }
+        p[idx] = (uint8_t)((nib[0] << 4U) | nib[1]);
+    }
+    LWUTIL_STATS_ADD(LWUTIL_STATS_HEX_DECODE, len, 0);
+    return len;
+}
+
+/* Two ASCII digits for every value from `0` to `99` */
+#define PRV_DEC_ROW(d) d "0" d "1" d "2" d "3" d "4" d "5" d "6" d "7" d "8" d "9"
+static const char prv_dec_pairs[200U + 1U] = PRV_DEC_ROW("0") PRV_DEC_ROW("1") PRV_DEC_ROW("2") PRV_DEC_ROW("3")
+    PRV_DEC_ROW("4") PRV_DEC_ROW("5") PRV_DEC_ROW("6") PRV_DEC_ROW("7") PRV_DEC_ROW("8") PRV_DEC_ROW("9");
+#undef PRV_DEC_ROW
+
+/* Powers of `10`, that fit `64-bit` value */
+static const uint64_t prv_dec_pow10[20] = {
+    UINT64_C(1),
+    UINT64_C(10),
+    UINT64_C(100),
+    UINT64_C(1000),
+    UINT64_C(10000),
+    UINT64_C(100000),
+    UINT64_C(1000000),
+    UINT64_C(10000000),
+    UINT64_C(100000000),
+    UINT64_C(1000000000),
+    UINT64_C(10000000000),
+    UINT64_C(100000000000),
+    UINT64_C(1000000000000),
+    UINT64_C(10000000000000),
+    UINT64_C(100000000000000),
+    UINT64_C(1000000000000000),
+    UINT64_C(10000000000000000),
+    UINT64_C(100000000000000000),
+    UINT64_C(1000000000000000000),
+    UINT64_C(10000000000000000000),
+};
+
+/**
+ * \brief           Get number of decimal digits of the value
+ * \param[in]       val: Value to check
+ * \return          Number of digits, from `1` to `20`
+ */
+static inline uint8_t
+prv_dec_len(uint64_t val) {
+    /*
+     * Approximate log10 from the bit length, 1233 / 4096 ~ log10(2), and correct it with single compare.
+     * Value `0` is counted as `1`, which does not change the compare with even powers of `10`.
+     */
+    uint32_t t;
+
+    val |= 1U;
+    t = ((prv_msb64(val) + 1U) * 1233U) >> 12U;
+    return (uint8_t)(t + 1U - (uint32_t)(val < prv_dec_pow10[t]));
+}
+
+/**
+ * \brief           Write value lower than `100000000` as exactly `8` digits
+ * \param[in]       val: Value to write
+ * \param[out]      out: Output array of `8` characters
+ */
+static inline void
+prv_dec_write8(uint32_t val, char* out) {
+    uint32_t hi = val / 10000U, lo = val % 10000U;
+
+    memcpy(&out[0], &prv_dec_pairs[2U * (hi / 100U)], 2U);
+    memcpy(&out[2], &prv_dec_pairs[2U * (hi % 100U)], 2U);
+    memcpy(&out[4], &prv_dec_pairs[2U * (lo / 100U)], 2U);
+    memcpy(&out[6], &prv_dec_pairs[2U * (lo % 100U)], 2U);
+}
+
+/**
+ * \brief           Write decimal digits of the value, ending just before `end`
+ * \param[in]       val: Value to write
+ * \param[out]      end: Pointer after the last digit
+ */
+static inline void
+prv_dec_write(uint64_t val, char* end) {
+    uint32_t v32;
+
+    /* Split large values to groups of 8 digits, so that the rest of division is 32-bit */
+    while (val > UINT32_MAX) {
+        end -= 8;
+        prv_dec_write8((uint32_t)(val % 100000000U), end);
+        val /= 100000000U;
+    }
+    for (v32 = (uint32_t)val; v32 >= 100U; v32 /= 100U) {
+        end -= 2;
+        memcpy(end, &prv_dec_pairs[2U * (v32 % 100U)], 2U);
+    }
+    if (v32 >= 10U) {
+        memcpy(end - 2, &prv_dec_pairs[2U * v32], 2U);
+    } else {
+        end[-1] = (char)('0' + v32);
+    }
+}
+
+/**
+ * \brief           Format value to decimal ASCII characters
+ * \param[in]       mag: Absolute value
+ * \param[in]       neg: Set to `1` to write minus sign
+ * \param[out]      out: Output array
+ * \param[in]       width: Minimal number of characters, including sign. Value is padded with zeros.
+ *                      Set to `0` for no padding
+ * \param[in]       nul: Set to `1` to NULL-terminate the output
+ * \return          Number of characters written, without NULL termination.
+ *                      `0` if value requires more than `width` characters, when `width` is not `0`
+ */
+static size_t
+prv_dec_format(uint64_t mag, uint8_t neg, char* out, uint8_t width, uint8_t nul) {
+    size_t len = (size_t)prv_dec_len(mag) + neg;
+
+    if (width > 0) {
+        if (len > width) {
+            return 0;
+        }
+        memset(&out[neg], '0', width - len);
+        len = width;
+    }
+    if (neg) {
+        out[0] = '-';
+    }
+    prv_dec_write(mag, &out[len]);
+    if (nul) {
+        out[len] = '\0';
+    }
+    return len;
+}
+
+/**
+ * \brief           Get number of decimal digits of `unsigned 32-bit` value
+ * \param[in]       val: Value to check
+ * \return          Number of digits, from `1` to `10`
+ */
+LWUTIL_API uint8_t
+lwutil_u32_dec_len(uint32_t val) {
+    return prv_dec_len(val);
+}
+
+/**
+ * \brief           Get number of decimal digits of `unsigned 64-bit` value
+ * \param[in]       val: Value to check
+ * \return          Number of digits, from `1` to `20`
+ */
+LWUTIL_API uint8_t
+lwutil_u64_dec_len(uint64_t val) {
+    return prv_dec_len(val);
+}
+
+/**
+ * \brief           Format `unsigned 32-bit` value to decimal ASCII characters
+ * \param[in]       val: Value to format
+ * \param[out]      out: Minimum \ref LWUTIL_DEC_U32_MAX_LEN bytes long output array, one more with NULL termination
+ * \param[in]       nul: Set to `1` to NULL-terminate the output, `0` otherwise
+ * \return          Number of characters written, without NULL termination. `0` in case of an error
+ */
+LWUTIL_API size_t
+lwutil_u32_to_dec(uint32_t val, char* out, uint8_t nul) {
+    if (LWUTIL_IS_NULL(out)) {
+        return 0;
+    }
+    return prv_dec_format(val, 0, out, 0, nul);
+}
+
+/**
+ * \brief           Format `signed 32-bit` value to decimal ASCII characters
+ * \param[in]       val: Value to format
+ * \param[out]      out: Minimum \ref LWUTIL_DEC_S32_MAX_LEN bytes long output array, one more with NULL termination
+ * \param[in]       nul: Set to `1` to NULL-terminate the output, `0` otherwise
+ * \return          Number of characters written, without NULL termination. `0` in case of an error
+ */
+LWUTIL_API size_t
+lwutil_s32_to_dec(int32_t val, char* out, uint8_t nul) {
+    if (LWUTIL_IS_NULL(out)) {
+        return 0;
+    }
+    return prv_dec_format(val < 0 ? 0U - (uint32_t)val : (uint32_t)val, val < 0, out, 0, nul);
+}
+
+/**
+ * \brief           Format `unsigned 64-bit` value to decimal ASCII characters
+ * \param[in]       val: Value to format
+ * \param[out]      out: Minimum \ref LWUTIL_DEC_U64_MAX_LEN bytes long output array, one more with NULL termination
+ * \param[in]       nul: Set to `1` to NULL-terminate the output, `0` otherwise
+ * \return          Number of characters written, without NULL termination. `0` in case of an error
+ */
+LWUTIL_API size_t
+lwutil_u64_to_dec(uint64_t val, char* out, uint8_t nul) {
+    if (LWUTIL_IS_NULL(out)) {
+        return 0;
+    }
+    return prv_dec_format(val, 0, out, 0, nul);
+}
+
+/**
+ * \brief           Format `signed 64-bit` value to decimal ASCII characters
+ * \param[in]       val: Value to format
+ * \param[out]      out: Minimum \ref LWUTIL_DEC_S64_MAX_LEN bytes long output array, one more with NULL termination
+ * \param[in]       nul: Set to `1` to NULL-terminate the output, `0` otherwise
+ * \return          Number of characters written, without NULL termination. `0` in case of an error
+ */
+LWUTIL_API size_t
+lwutil_s64_to_dec(int64_t val, char* out, uint8_t nul) {
+    if (LWUTIL_IS_NULL(out)) {
+        return 0;
+    }
+    return prv_dec_format(val < 0 ? 0U - (uint64_t)val : (uint64_t)val, val < 0, out, 0, nul);
+}
+
+/**
+ * \brief           Format `unsigned 32-bit` value to fixed number of decimal ASCII characters, padded with zeros
+ * \param[in]       val: Value to format
+ * \param[out]      out: Minimum `width` bytes long output array, one more with NULL termination
+ * \param[in]       width: Number of characters to write
+ * \param[in]       nul: Set to `1` to NULL-terminate the output, `0` otherwise
+ * \return          `width` on success, `0` if value does not fit `width` characters
+ */
+LWUTIL_API size_t
+lwutil_u32_to_dec_fixed(uint32_t val, char* out, uint8_t width, uint8_t nul) {
+    if (LWUTIL_IS_NULL(out) || width == 0) {
+        return 0;
+    }
+    return prv_dec_format(val, 0, out, width, nul);
+}
+
+/**
+ * \brief           Format `signed 32-bit` value to fixed number of decimal ASCII characters, padded with zeros
+ *
+ * Minus sign is written before the padding, `-42` with width of `5` is written as `-0042`.
+ *
+ * \param[in]       val: Value to format
+ * \param[out]      out: Minimum `width` bytes long output array, one more with NULL termination
+ * \param[in]       width: Number of characters to write, including sign
+ * \param[in]       nul: Set to `1` to NULL-terminate the output, `0` otherwise
+ * \return          `width` on success, `0` if value does not fit `width` characters
+ */
+LWUTIL_API size_t
+lwutil_s32_to_dec_fixed(int32_t val, char* out, uint8_t width, uint8_t nul) {
+    if (LWUTIL_IS_NULL(out) || width == 0) {
+        return 0;
+    }
+    return prv_dec_format(val < 0 ? 0U - (uint32_t)val : (uint32_t)val, val < 0, out, width, nul);
+}
+
+/**
+ * \brief           Format `unsigned 64-bit` value to fixed number of decimal ASCII characters, padded with zeros
+ * \param[in]       val: Value to format
+ * \param[out]      out: Minimum `width` bytes long output array, one more with NULL termination
+ * \param[in]       width: Number of characters to write
+ * \param[in]       nul: Set to `1` to NULL-terminate the output, `0` otherwise
+ * \return          `width` on success, `0` if value does not fit `width` characters
+ */
+LWUTIL_API size_t
+lwutil_u64_to_dec_fixed(uint64_t val, char* out, uint8_t width, uint8_t nul) {
+    if (LWUTIL_IS_NULL(out) || width == 0) {
+        return 0;
+    }
+    return prv_dec_format(val, 0, out, width, nul);
+}
+
+/**
+ * \brief           Format `signed 64-bit` value to fixed number of decimal ASCII characters, padded with zeros
+ *
+ * Minus sign is written before the padding.
+ *
+ * \param[in]       val: Value to format
+ * \param[out]      out: Minimum `width` bytes long output array, one more with NULL termination
+ * \param[in]       width: Number of characters to write, including sign
+ * \param[in]       nul: Set to `1` to NULL-terminate the output, `0` otherwise
+ * \return          `width` on success, `0` if value does not fit `width` characters
+ */
+LWUTIL_API size_t
+lwutil_s64_to_dec_fixed(int64_t val, char* out, uint8_t width, uint8_t nul) {
+    if (LWUTIL_IS_NULL(out) || width == 0) {
+        return 0;
+    }
+    return prv_dec_format(val < 0 ? 0U - (uint64_t)val : (uint64_t)val, val < 0, out, width, nul);
+}
+
+/**
+ * \brief           Format array of values to decimal ASCII characters, separated by `sep` character
+ * \param[in]       vals32: Array of `32-bit` values or `NULL`
+ * \param[in]       vals64: Array of `64-bit` values, used when `vals32` is `NULL`
+ * \param[in]       is_signed: Set to `1` when values are signed
+ * \param[in]       count: Number of values
+ * \param[out]      out: Output array
+ * \param[in]       out_len: Length of output array
+ * \param[in]       sep: Separator character
+ * \return          Number of characters written. `0` if output array is too short for all values
+ */
+static size_t
+prv_dec_format_array(const uint32_t* vals32, const uint64_t* vals64, uint8_t is_signed, size_t count, char* out,
+                     size_t out_len, char sep) {
+    char tmp[LWUTIL_DEC_S64_MAX_LEN + 1U];
+    size_t len = 0;
+
+    for (size_t i = 0; i < count; ++i) {
+        uint64_t mag;
+        uint8_t neg = 0;
+        char* p;
+        size_t n = 0;
+
+        if (vals32 != NULL) {
+            mag = vals32[i];
+            if (is_signed && (vals32[i] & 0x80000000UL) != 0) {
+                mag = 0U - vals32[i];
+                neg = 1;
+            }
+        } else {
+            mag = vals64[i];
+            if (is_signed && (vals64[i] & UINT64_C(0x8000000000000000)) != 0) {
+                mag = 0U - vals64[i];
+                neg = 1;
+            }
+        }
+
+        /* Format directly to the output, unless it is close to the end */
+        p = (out_len - len) > sizeof(tmp) ? &out[len] : tmp;
+        if (i > 0) {
+            p[n++] = sep;
+        }
+        n += prv_dec_format(mag, neg, &p[n], 0, 0);
+        if (p == tmp) {
+            if (n > (out_len - len)) {
+                return 0;
+            }
+            memcpy(&out[len], tmp, n);
+        }
+        len += n;
+    }
+    return len;
+}
+
+/**
+ * \brief           Format array of `unsigned 32-bit` values to decimal ASCII characters
+ *
+ * Values are separated by `sep` character, with no separator after the last value.
+ * Output is not NULL-terminated.
+ *
+ * \param[in]       vals: Array of values to format
+ * \param[in]       count: Number of values in `vals` array
+ * \param[out]      out: Output array
+ * \param[in]       out_len: Length of output array
+ * \param[in]       sep: Separator character, for example `,` for CSV rows
+ * \return          Number of characters written.
+ *                      `0` in case of an error or if output array is too short for all values.
+ */
+LWUTIL_API size_t
+lwutil_u32_to_dec_array(const uint32_t* vals, size_t count, char* out, size_t out_len, char sep) {
+    if (LWUTIL_IS_NULL(vals) || LWUTIL_IS_NULL(out)) {
+        return 0;
+    }
+    return prv_dec_format_array(vals, NULL, 0, count, out, out_len, sep);
+}
+
+/**
+ * \brief           Format array of `signed 32-bit` values to decimal ASCII characters
+ *
+ * Values are separated by `sep` character, with no separator after the last value.
+ * Output is not NULL-terminated.
+ *
+ * \param[in]       vals: Array of values to format
+ * \param[in]       count: Number of values in `vals` array
+ * \param[out]      out: Output array
+ * \param[in]       out_len: Length of output array
+ * \param[in]       sep: Separator character, for example `,` for CSV rows
+ * \return          Number of characters written.
+ *                      `0` in case of an error or if output array is too short for all values.
+ */
+LWUTIL_API size_t
+lwutil_s32_to_dec_array(const int32_t* vals, size_t count, char* out, size_t out_len, char sep) {
+    if (LWUTIL_IS_NULL(vals) || LWUTIL_IS_NULL(out)) {
+        return 0;
+    }
+    return prv_dec_format_array((const uint32_t*)vals, NULL, 1, count, out, out_len, sep);
+}
+
+/**
+ * \brief           Format array of `unsigned 64-bit` values to decimal ASCII characters
+ *
+ * Values are separated by `sep` character, with no separator after the last value.
+ * Output is not NULL-terminated.
+ *
+ * \param[in]       vals: Array of values to format
+ * \param[in]       count: Number of values in `vals` array
+ * \param[out]      out: Output array
+ * \param[in]       out_len: Length of output array
+ * \param[in]       sep: Separator character, for example `,` for CSV rows
+ * \return          Number of characters written.
+ *                      `0` in case of an error or if output array is too short for all values.
+ */
+LWUTIL_API size_t
+lwutil_u64_to_dec_array(const uint64_t* vals, size_t count, char* out, size_t out_len, char sep) {
+    if (LWUTIL_IS_NULL(vals) || LWUTIL_IS_NULL(out)) {
+        return 0;
+    }
+    return prv_dec_format_array(NULL, vals, 0, count, out, out_len, sep);
+}
+
+/**
+ * \brief           Format array of `signed 64-bit` values to decimal ASCII characters
+ *
+ * Values are separated by `sep` character, with no separator after the last value.
+ * Output is not NULL-terminated.
+ *
+ * \param[in]       vals: Array of values to format
+ * \param[in]       count: Number of values in `vals` array
+ * \param[out]      out: Output array
+ * \param[in]       out_len: Length of output array
+ * \param[in]       sep: Separator character, for example `,` for CSV rows
+ * \return          Number of characters written.
+ *                      `0` in case of an error or if output array is too short for all values.
+ */
+LWUTIL_API size_t
+lwutil_s64_to_dec_array(const int64_t* vals, size_t count, char* out, size_t out_len, char sep) {
+    if (LWUTIL_IS_NULL(vals) || LWUTIL_IS_NULL(out)) {
+        return 0;
+    }
+    return prv_dec_format_array(NULL, (const uint64_t*)vals, 1, count, out, out_len, sep);
+}
+
+/**
+ * \brief           Parse a run of up to `8` decimal digits with SWAR operations
+ *
+ * Digits before the first non-digit character are shifted to the top of the word,
+ * so that leading bytes act as zeros, and then joined in pairs, quads and octets.
+ *
+ * \param[in]       p: Input characters. Must have at least `8` bytes available
+ * \param[out]      val_out: Value of parsed digits
+ * \return          Number of parsed digits, from `0` to `8`
+ */
+static inline size_t
+prv_parse_digits8(const char* p, uint64_t* val_out) {
+    uint64_t word = lwutil_ld_u64_le(p), nd;
+    size_t cnt;
+
+    /* Byte is a digit when both its high nibble and high nibble of byte plus 6 are equal to 3 */
+    nd = ((word & 0xF0F0F0F0F0F0F0F0ULL) | (((word + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4U))
+         ^ 0x3333333333333333ULL;
+    nd = (((nd & 0x7F7F7F7F7F7F7F7FULL) + 0x7F7F7F7F7F7F7F7FULL) | nd) & 0x8080808080808080ULL;
+    cnt = nd == 0 ? 8U : (size_t)(prv_ctz64(nd) >> 3U);
+    if (cnt == 0) {
+        *val_out = 0;
+        return 0;
+    }
+
+    /* Carries from non-digit bytes only affect bytes shifted out here */
+    word = (word & 0x0F0F0F0F0F0F0F0FULL) << (8U * (8U - cnt));
+    word = (word * (1U + (10U << 8U))) >> 8U;
+    word = ((word & 0x00FF00FF00FF00FFULL) * (1U + (100U << 16U))) >> 16U;
+    *val_out = ((word & 0x0000FFFF0000FFFFULL) * (1U + (10000ULL << 32U))) >> 32U;
+    return cnt;
+}
+
+/**
+ * \brief           Parse decimal digits and an optional minus sign to a value
+ *
+ * Leading zeros are skipped first, then digits are processed in runs of `16` or `8`,
+ * depending on available SIMD kernels and input length, and the rest one at a time.
+ * Overflow is checked exactly, once value reaches `20` significant digits.
+ *
+ * \param[in]       str: Input characters
+ * \param[in]       len: Number of characters available in `str`
+ * \param[in]       max: Maximum accepted positive value
+ * \param[in]       allow_neg: Set to `1` to accept leading `-` character, allowing `max + 1` magnitude
+ * \param[out]      mag_out: Parsed magnitude
+ * \param[out]      neg_out: Set to `1` if value is negative, `0` otherwise
+ * \return          Number of consumed characters. `0` if there are no digits or value overflows
+ */
+static size_t
+prv_parse_dec(const char* str, size_t len, uint64_t max, uint8_t allow_neg, uint64_t* mag_out, uint8_t* neg_out) {
+    const prv_simd_kernels_t* simd = prv_simd();
+    uint64_t val = 0, run;
+    size_t i = 0, start, digits = 0, cnt, width;
+    uint8_t neg = 0;
+
+    if (allow_neg && len > 0 && str[0] == '-') {
+        neg = 1;
+        i = 1;
+    }
+    start = i;
+    while (i < len && str[i] == '0') {
+        ++i;
+    }
+    for (;;) {
+        if (simd->parse_digits16 != NULL && (len - i) >= 16U) {
+            width = 16U;
+            cnt = simd->parse_digits16(&str[i], &run);
+        } else if ((len - i) >= 8U) {
+            width = 8U;
+            cnt = prv_parse_digits8(&str[i], &run);
+        } else {
+            width = 1U;
+            cnt = (i < len && (uint8_t)(str[i] - '0') <= 9U) ? 1U : 0U;
+            run = cnt > 0 ? (uint64_t)(uint8_t)(str[i] - '0') : 0U;
+        }
+        if (cnt == 0) {
+            break;
+        }
+
+        /* Significant digits start with non-zero one, more than 20 of them never fit */
+        digits += cnt;
+        if (digits > 20U) {
+            return 0;
+        } else if (digits >= 20U && val > (UINT64_MAX - run) / prv_dec_pow10[cnt]) {
+            return 0;
+        }
+        val = val * prv_dec_pow10[cnt] + run;
+        i += cnt;
+        if (cnt < width) {
+            break;
+        }
+    }
+    if (i == start || val > max + neg) {
+        return 0;
+    }
+    *mag_out = val;
+    *neg_out = neg;
+    return i;
+}
+
+/**
+ * \brief           Parse decimal ASCII characters to `unsigned 32-bit` value
+ *
+ * Parsing stops at first non-digit character or at the end of input, NULL termination is not required.
+ * Leading whitespace and sign characters are not accepted.
+ *
+ * \param[in]       str: Input characters
+ * \param[in]       len: Number of characters available in `str`
+ * \param[out]      val_out: Output variable to write parsed value to
+ * \return          Number of consumed characters.
+ *                      `0` in case of an error, if there are no digits or if value does not fit the type
+ */
+LWUTIL_API size_t
+lwutil_parse_u32(const char* str, size_t len, uint32_t* val_out) {
+    uint64_t mag;
+    uint8_t neg;
+    size_t n;
+
+    if (LWUTIL_IS_NULL(str) || LWUTIL_IS_NULL(val_out)) {
+        return 0;
+    }
+    n = prv_parse_dec(str, len, UINT32_MAX, 0, &mag, &neg);
+    if (n > 0) {
+        *val_out = (uint32_t)mag;
+    }
+    return n;
+}
+
+/**
+ * \brief           Parse decimal ASCII characters to `signed 32-bit` value
+ *
+ * Parsing stops at first non-digit character or at the end of input, NULL termination is not required.
+ * Optional leading `-` character is accepted, leading whitespace and `+` character are not.
+ *
+ * \param[in]       str: Input characters
+ * \param[in]       len: Number of characters available in `str`
+ * \param[out]      val_out: Output variable to write parsed value to
+ * \return          Number of consumed characters, including sign.
+ *                      `0` in case of an error, if there are no digits or if value does not fit the type
+ */
+LWUTIL_API size_t
+lwutil_parse_s32(const char* str, size_t len, int32_t* val_out) {
+    uint64_t mag;
+    uint8_t neg;
+    size_t n;
+
+    if (LWUTIL_IS_NULL(str) || LWUTIL_IS_NULL(val_out)) {
+        return 0;
+    }
+    n = prv_parse_dec(str, len, INT32_MAX, 1, &mag, &neg);
+    if (n > 0) {
+        *val_out = neg ? (int32_t)(-(int64_t)mag) : (int32_t)mag;
+    }
+    return n;
+}
+
+/**
+ * \brief           Parse decimal ASCII characters to `unsigned 64-bit` value
+ *
+ * Parsing stops at first non-digit character or at the end of input, NULL termination is not required.
+ * Leading whitespace and sign characters are not accepted.
+ *
+ * \param[in]       str: Input characters
+ * \param[in]       len: Number of characters available in `str`
+ * \param[out]      val_out: Output variable to write parsed value to
+ * \return          Number of consumed characters.
+ *                      `0` in case of an error, if there are no digits or if value does not fit the type
+ */
+LWUTIL_API size_t
+lwutil_parse_u64(const char* str, size_t len, uint64_t* val_out) {
+    uint64_t mag;
+    uint8_t neg;
+    size_t n;
+
+    if (LWUTIL_IS_NULL(str) || LWUTIL_IS_NULL(val_out)) {
+        return 0;
+    }
+    n = prv_parse_dec(str, len, UINT64_MAX, 0, &mag, &neg);
+    if (n > 0) {
+        *val_out = mag;
+    }
+    return n;
+}
+
+/**
+ * \brief           Parse decimal ASCII characters to `signed 64-bit` value
+ *
+ * Parsing stops at first non-digit character or at the end of input, NULL termination is not required.
+ * Optional leading `-` character is accepted, leading whitespace and `+` character are not.
+ *
+ * \param[in]       str: Input characters
+ * \param[in]       len: Number of characters available in `str`
+ * \param[out]      val_out: Output variable to write parsed value to
+ * \return          Number of consumed characters, including sign.
+ *                      `0` in case of an error, if there are no digits or if value does not fit the type
+ */
+LWUTIL_API size_t
+lwutil_parse_s64(const char* str, size_t len, int64_t* val_out) {
+    uint64_t mag;
+    uint8_t neg;
+    size_t n;
+
+    if (LWUTIL_IS_NULL(str) || LWUTIL_IS_NULL(val_out)) {
+        return 0;
+    }
+    n = prv_parse_dec(str, len, INT64_MAX, 1, &mag, &neg);
+    if (n > 0) {
+        *val_out = neg ? -(int64_t)(mag - 1U) - 1 : (int64_t)mag;
+    }
+    return n;
+}
+
+/**
+ * \brief           Remove continuation bits from up to `8` varint bytes and join `7-bit` groups
+ * \param[in]       word: Little-endian varint bytes. Bytes after the last one must be set to `0`
+ * \return          Joined value, up to `56` bits long
+ */
+static inline uint64_t
+prv_varint_compact(uint64_t word) {
+    word &= 0x7F7F7F7F7F7F7F7FULL;
+    word = ((word & 0x7F007F007F007F00ULL) >> 1U) | (word & 0x007F007F007F007FULL);
+    word = ((word & 0x3FFF00003FFF0000ULL) >> 2U) | (word & 0x00003FFF00003FFFULL);
+    word = ((word & 0x0FFFFFFF00000000ULL) >> 4U) | (word & 0x000000000FFFFFFFULL);
+    return word;
+}
+
+/**
+ * \brief           Load variable length integer of up to `max_bytes` bytes
+ * 
+ * When at least `8` bytes are available, terminating byte is found with single unaligned load
+ * and count-trailing-zeros operation, with no loop over the individual bytes.
+ * Near the end of the input array, bytes are checked one by one.
+ * 
+ * \param[in]       p: Array pointer to load data from
+ * \param[in]       ptr_len: Input array length
+ * \param[in]       max_bytes: Maximum varint length. `5` for `32-bit` and `10` for `64-bit` integers
+ * \param[out]      val_out: Pointer to variable to write result value
+ * \return          Number of bytes used for the value. `0` in case of an error.
+ */
+static size_t
+prv_ld_varint(const uint8_t* p, size_t ptr_len, size_t max_bytes, uint64_t* val_out) {
+    uint64_t val = 0;
+    size_t cnt = 0;
+
+    if (ptr_len >= 8U) {
+        uint64_t word = prv_ld_u64_le_unaligned(p);
+        uint64_t stop = ~word & 0x8080808080808080ULL;
+
+        if (stop != 0) {
+            cnt = prv_ctz64(stop) / 8U + 1U;
+            if (cnt > max_bytes) {
+                return 0;
+            }
+            *val_out = prv_varint_compact(word & (0xFFFFFFFFFFFFFFFFULL >> (64U - 8U * cnt)));
+            return cnt;
+        }
+        val = prv_varint_compact(word);
+        cnt = 8U;
+    }
+    for (; cnt < ptr_len && cnt < max_bytes;) {
+        uint8_t byt = p[cnt];
+
+        val |= ((uint64_t)(byt & 0x7FU)) << (cnt * 7U);
+        ++cnt;
+        if (byt < 0x80U) {
+            *val_out = val;
+            return cnt;
+        }
+    }
+    return 0;
+}
+
+/**
+ * \brief           Load variable length integer from the byte stream to the variable.
+ * 
+ * Variable length integers (short varints) are stored with continuation bit (bit 7, 0x80),
+ * which tells us if there is a next byte to be used as part of the number sequence.
+ * 
+ * 32-bit integer can be stored with anything between `1` and `5` bytes.
+ * 
+ * \param           ptr: Array pointer to load data from
+ * \param           ptr_len: Input array length
+ * \param           val_out: Pointer to variable to write result value
+ * \return          Number of bytes written (stored). `0` in case of an error.
+ */
+LWUTIL_API uint8_t
+lwutil_ld_u32_varint(const void* ptr, size_t ptr_len, uint32_t* val_out) {
+    uint64_t val = 0;
+    size_t cnt;
+
+    if (LWUTIL_IS_NULL(ptr) || ptr_len == 0 || LWUTIL_IS_NULL(val_out)) {
+        LWUTIL_STATS_ADD(LWUTIL_STATS_LD_U32_VARINT, 0, 1);
+        return 0;
+    }
+    cnt = prv_ld_varint((const uint8_t*)ptr, ptr_len, 5U, &val);
+    *val_out = cnt > 0 ? (uint32_t)val : 0;
+    LWUTIL_STATS_ADD(LWUTIL_STATS_LD_U32_VARINT, cnt, cnt == 0);
+    return (uint8_t)cnt;
+}
+
+/**
+ * \brief           Store an integer into variable length byte sequence array.
+ * 
+ * Variable length integers (short varints) are stored with continuation bit (bit 7, 0x80),
+ * which tells us if there is a next byte to be used as part of the number sequence.
+ * 
+ * 32-bit integer can be stored with anything between `1` and `5` bytes.
+ * 
+ * \param           val: Value to encode into byte sequence
+ * \param           ptr: Array to write output result
+ * \param           ptr_len: Length of an input array
+ * \return          Number of bytes written (stored). `0` in case of an error.
+ */
+LWUTIL_API uint8_t
+lwutil_st_u32_varint(uint32_t val, void* ptr, size_t ptr_len) {
+    uint8_t* p_data = (uint8_t*)ptr;
+    size_t cnt = 0;
+
+    if (LWUTIL_IS_NULL(ptr) || ptr_len == 0) {
+        LWUTIL_STATS_ADD(LWUTIL_STATS_ST_U32_VARINT, 0, 1);
+        return 0;
+    }
+    do {
+        *p_data++ = (val & 0x7FU) | (val > 0x7FU ? 0x80U : 0x00U);
+        val >>= 7U;
+        ++cnt;
+    } while (--ptr_len > 0 && val > 0);
+
+    /* Memory check */
+    if (val > 0) {
+        cnt = 0;
+    }
+    LWUTIL_STATS_ADD(LWUTIL_STATS_ST_U32_VARINT, cnt, cnt == 0);
+    return cnt;
+}
+
+/**
+ * \brief           Load `64-bit` variable length integer from the byte stream to the variable.
+ * 
+ * 64-bit integer can be stored with anything between `1` and `10` bytes.
+ * 
+ * \param           ptr: Array pointer to load data from
+ * \param           ptr_len: Input array length
+ * \param           val_out: Pointer to variable to write result value
+ * \return          Number of bytes used for the value. `0` in case of an error.
+ */
+LWUTIL_API uint8_t
+lwutil_ld_u64_varint(const void* ptr, size_t ptr_len, uint64_t* val_out) {
+    uint64_t val = 0;
+    size_t cnt;
+
+    if (LWUTIL_IS_NULL(ptr) || ptr_len == 0 || LWUTIL_IS_NULL(val_out)) {
+        LWUTIL_STATS_ADD(LWUTIL_STATS_LD_U64_VARINT, 0, 1);
+        return 0;
+    }
+    cnt = prv_ld_varint((const uint8_t*)ptr, ptr_len, 10U, &val);
+    *val_out = cnt > 0 ? val : 0;
+    LWUTIL_STATS_ADD(LWUTIL_STATS_LD_U64_VARINT, cnt, cnt == 0);
+    return (uint8_t)cnt;
+}
+
+/**
+ * \brief           Store `64-bit` integer into variable length byte sequence array.
+ * 
+ * 64-bit integer can be stored with anything between `1` and `10` bytes.
+ * 
+ * \param           val: Value to encode into byte sequence
+ * \param           ptr: Array to write output result
+ * \param           ptr_len: Length of an input array
+ * \return          Number of bytes written (stored). `0` in case of an error.
+ */
+LWUTIL_API uint8_t
+lwutil_st_u64_varint(uint64_t val, void* ptr, size_t ptr_len) {
+    uint8_t* p_data = (uint8_t*)ptr;
+    size_t cnt = 0;
+
+    if (LWUTIL_IS_NULL(ptr) || ptr_len == 0) {
+        LWUTIL_STATS_ADD(LWUTIL_STATS_ST_U64_VARINT, 0, 1);
+        return 0;
+    }
+    do {
+        *p_data++ = (uint8_t)((val & 0x7FU) | (val > 0x7FU ? 0x80U : 0x00U));
+        val >>= 7U;
+        ++cnt;
+    } while (--ptr_len > 0 && val > 0);
+
+    /* Memory check */
+    if (val > 0) {
+        cnt = 0;
+    }
+    LWUTIL_STATS_ADD(LWUTIL_STATS_ST_U64_VARINT, cnt, cnt == 0);
+    return (uint8_t)cnt;
+}
 
 /**
- * \brief           Makes ascii char array from `unsigned 8-bit` value
- * \param[in]       hex: Hexadecimal data to be converted
- * \param[out]      ascii: Minimum `3-bytes` long array to write value to
+ * \brief           Load signed `32-bit` zigzag-encoded variable length integer from the byte stream
+ * \param           ptr: Array pointer to load data from
+ * \param           ptr_len: Input array length
+ * \param           val_out: Pointer to variable to write result value
+ * \return          Number of bytes used for the value. `0` in case of an error.
  */
-void
-lwutil_u8_to_2asciis(uint8_t hex, char* ascii) {
-    for (uint8_t idx = 2U; idx != 0; --idx) {
-        uint8_t aux = (uint8_t)(hex >> (4U * (idx - 1U))) & 0x0FU;
+LWUTIL_API uint8_t
+lwutil_ld_s32_varint(const void* ptr, size_t ptr_len, int32_t* val_out) {
+    uint32_t val;
+    uint8_t cnt;
 
-        aux = (aux <= 9U) ? (aux + 0x30U) : (aux + 0x57U);
-        ascii[2U - idx] = (char)aux;
+    if (LWUTIL_IS_NULL(val_out)) {
+        return 0;
     }
-    ascii[2U] = '\0';
+    cnt = lwutil_ld_u32_varint(ptr, ptr_len, &val);
+    *val_out = cnt > 0 ? lwutil_zigzag_dec_s32(val) : 0;
+    return cnt;
 }
 
 /**
- * \brief           Makes ascii char array from `unsigned 16-bit` value
- * \param[in]       hex: Hexadecimal data to be converted
- * \param[out]      ascii: Minimum `5-bytes` long array to write value to
+ * \brief           Store signed `32-bit` integer into zigzag-encoded variable length byte sequence array.
+ * 
+ * Zigzag encoding maps small negative and positive numbers to small unsigned numbers,
+ * so that `-1` is stored with `1` byte only.
+ * 
+ * \param           val: Value to encode into byte sequence
+ * \param           ptr: Array to write output result
+ * \param           ptr_len: Length of an input array
+ * \return          Number of bytes written (stored). `0` in case of an error.
  */
-void
-lwutil_u16_to_4asciis(uint16_t hex, char* ascii) {
-    for (uint8_t idx = 4U; idx != 0; --idx) {
-        uint8_t aux = (uint8_t)(hex >> (4U * (idx - 1U))) & 0x0FU;
+LWUTIL_API uint8_t
+lwutil_st_s32_varint(int32_t val, void* ptr, size_t ptr_len) {
+    return lwutil_st_u32_varint(lwutil_zigzag_enc_s32(val), ptr, ptr_len);
+}
+
+/**
+ * \brief           Load signed `64-bit` zigzag-encoded variable length integer from the byte stream
+ * \param           ptr: Array pointer to load data from
+ * \param           ptr_len: Input array length
+ * \param           val_out: Pointer to variable to write result value
+ * \return          Number of bytes used for the value. `0` in case of an error.
+ */
+LWUTIL_API uint8_t
+lwutil_ld_s64_varint(const void* ptr, size_t ptr_len, int64_t* val_out) {
+    uint64_t val;
+    uint8_t cnt;
 
-        aux = (aux <= 9U) ? (aux + 0x30U) : (aux + 0x57U);
-        ascii[4U - idx] = (char)aux;
+    if (LWUTIL_IS_NULL(val_out)) {
+        return 0;
     }
-    ascii[4] = '\0';
+    cnt = lwutil_ld_u64_varint(ptr, ptr_len, &val);
+    *val_out = cnt > 0 ? lwutil_zigzag_dec_s64(val) : 0;
+    return cnt;
 }
 
 /**
- * \brief           Makes ascii char array from `unsigned 32-bit` value
- * \param[in]       hex: Hexadecimal data to be converted
- * \param[out]      ascii: Minimum `9-bytes` long array to write value to
+ * \brief           Store signed `64-bit` integer into zigzag-encoded variable length byte sequence array.
+ * \param           val: Value to encode into byte sequence
+ * \param           ptr: Array to write output result
+ * \param           ptr_len: Length of an input array
+ * \return          Number of bytes written (stored). `0` in case of an error.
  */
-void
-lwutil_u32_to_8asciis(uint32_t hex, char* ascii) {
-    for (uint8_t idx = 8U; idx != 0; --idx) {
-        uint8_t aux = (uint8_t)(hex >> (4U * (idx - 1U))) & 0x0FU;
+LWUTIL_API uint8_t
+lwutil_st_s64_varint(int64_t val, void* ptr, size_t ptr_len) {
+    return lwutil_st_u64_varint(lwutil_zigzag_enc_s64(val), ptr, ptr_len);
+}
+
+/**
+ * \brief           Get number of bytes required to store `32-bit` value as variable length integer
+ * 
+ * Length is calculated from the position of the most significant set bit, without a loop.
+ * 
+ * \param           val: Value to get length for
+ * \return          Number of bytes, between `1` and `5`
+ */
+LWUTIL_API uint8_t
+lwutil_u32_varint_len(uint32_t val) {
+    return (uint8_t)((prv_msb64((uint64_t)val | 0x01U) * 9U + 73U) / 64U);
+}
+
+/**
+ * \brief           Get number of bytes required to store `64-bit` value as variable length integer
+ * \param           val: Value to get length for
+ * \return          Number of bytes, between `1` and `10`
+ */
+LWUTIL_API uint8_t
+lwutil_u64_varint_len(uint64_t val) {
+    return (uint8_t)((prv_msb64(val | 0x01U) * 9U + 73U) / 64U);
+}
+
+/**
+ * \brief           Load array of variable length integers from the byte stream.
+ * 
+ * Values are decoded in sequence, byte-identical to calling \ref lwutil_ld_u32_varint for each of them,
+ * but input parameters are checked only once.
+ * When SSE4.1 or AVX2 instruction set is supported by the CPU, values are decoded in blocks
+ * with masked-VByte shuffle look-up table and vector instructions.
+ * 
+ * \param[in]       ptr: Array pointer to load data from
+ * \param[in]       ptr_len: Input array length
+ * \param[out]      vals_out: Array to write `count` decoded values to
+ * \param[in]       count: Number of values to decode
+ * \return          Number of bytes consumed from the input array.
+ *                      `0` in case of an error or if input array does not hold `count` complete values.
+ */
+LWUTIL_API size_t
+lwutil_ld_u32_varint_array(const void* ptr, size_t ptr_len, uint32_t* vals_out, size_t count) {
+    const prv_simd_kernels_t* simd = prv_simd();
+    const size_t width = simd->varint_run_width;
+    const uint8_t* p_data = (const uint8_t*)ptr;
+    const uint8_t* p_end;
+    uint64_t val;
+    size_t idx = 0, len;
+    PRV_STATS_VARINT_HIST(hist);
 
-        aux = (aux <= 9U) ? (aux + 0x30U) : (aux + 0x57U);
-        ascii[8U - idx] = (char)aux;
+    if (LWUTIL_IS_NULL(ptr) || LWUTIL_IS_NULL(vals_out) || ptr_len == 0) {
+        LWUTIL_STATS_ADD(LWUTIL_STATS_LD_U32_VARINT_ARRAY, 0, 1);
+        return 0;
     }
-    ascii[8] = '\0';
+    p_end = p_data + ptr_len;
+    while (idx < count) {
+        if (width > 0 && (count - idx) >= width && (size_t)(p_end - p_data) >= width) {
+            size_t cnt = simd->ld_varint_block(p_data, &vals_out[idx], &len);
+
+            if (cnt > 0) {
+                PRV_STATS_VARINT_HIST_SCAN(hist, p_data, len);
+                p_data += len;
+                idx += cnt;
+                continue;
+            }
+        }
+        len = prv_ld_varint(p_data, (size_t)(p_end - p_data), 5U, &val);
+        if (len == 0) {
+            LWUTIL_STATS_ADD(LWUTIL_STATS_LD_U32_VARINT_ARRAY, 0, 1);
+            return 0;
+        }
+        PRV_STATS_VARINT_HIST_ADD(hist, len, 1U);
+        vals_out[idx] = (uint32_t)val;
+        p_data += len;
+        ++idx;
+    }
+    PRV_STATS_VARINT_HIST_FLUSH(hist);
+    LWUTIL_STATS_ADD(LWUTIL_STATS_LD_U32_VARINT_ARRAY, p_data - (const uint8_t*)ptr, 0);
+    return (size_t)(p_data - (const uint8_t*)ptr);
 }
 
 /**
- * \brief           Load variable length integer from the byte stream to the variable.
+ * \brief           Store array of integers into variable length byte sequence array.
  * 
- * Variable length integers (short varints) are stored with continuation bit (bit 7, 0x80),
- * which tells us if there is a next byte to be used as part of the number sequence.
+ * Output is byte-identical to calling \ref lwutil_st_u32_varint for each value,
+ * but input parameters are checked only once and length is checked only near the end of the output array.
+ * When SSE4.1 or AVX2 instruction set is supported by the CPU, runs of values lower than `128`
+ * are encoded with vector instructions.
  * 
- * 32-bit integer can be stored with anything between `1` and `5` bytes.
+ * \note            Output array bytes after the returned length may be modified
+ * 
+ * \param[in]       vals: Array of values to encode
+ * \param[in]       count: Number of values in `vals` array
+ * \param[out]      ptr: Array to write output result
+ * \param[in]       ptr_len: Length of an output array
+ * \return          Number of bytes written (stored).
+ *                      `0` in case of an error or if output array is too short for all values.
+ */
+LWUTIL_API size_t
+lwutil_st_u32_varint_array(const uint32_t* vals, size_t count, void* ptr, size_t ptr_len) {
+    const prv_simd_kernels_t* simd = prv_simd();
+    const size_t width = simd->varint_run_width;
+    uint8_t* p_data = (uint8_t*)ptr;
+    uint8_t* p_end;
+    size_t idx = 0, len;
+
+    if (LWUTIL_IS_NULL(vals) || LWUTIL_IS_NULL(ptr) || ptr_len == 0) {
+        LWUTIL_STATS_ADD(LWUTIL_STATS_ST_U32_VARINT_ARRAY, 0, 1);
+        return 0;
+    }
+    p_end = p_data + ptr_len;
+    while (idx < count) {
+        uint32_t val = vals[idx];
+
+        if (val < 0x80U && width > 0 && (count - idx) >= width && (size_t)(p_end - p_data) >= width) {
+            len = simd->st_varint_run(&vals[idx], p_data);
+            p_data += len;
+            idx += len;
+            continue;
+        }
+        if ((size_t)(p_end - p_data) >= 5U) {
+            for (; val > 0x7FU; val >>= 7U) {
+                *p_data++ = (uint8_t)((val & 0x7FU) | 0x80U);
+            }
+            *p_data++ = (uint8_t)val;
+        } else {
+            len = p_data < p_end ? lwutil_st_u32_varint(val, p_data, (size_t)(p_end - p_data)) : 0;
+            if (len == 0) {
+                LWUTIL_STATS_ADD(LWUTIL_STATS_ST_U32_VARINT_ARRAY, 0, 1);
+                return 0;
+            }
+            p_data += len;
+        }
+        ++idx;
+    }
+    LWUTIL_STATS_ADD(LWUTIL_STATS_ST_U32_VARINT_ARRAY, p_data - (uint8_t*)ptr, 0);
+    return (size_t)(p_data - (uint8_t*)ptr);
+}
+
+/**
+ * \brief           Output of the streaming decoder
+ */
+typedef struct {
+    uint32_t* vals32;        /*!< Output array for `32-bit` values or `NULL` */
+    uint64_t* vals64;        /*!< Output array for `64-bit` values or `NULL` */
+    size_t vals_max;         /*!< Size of output array. `0` when callback is used */
+    size_t cnt;              /*!< Number of output values */
+    lwutil_varint_dec_fn fn; /*!< Callback function, used when there is no output array */
+    void* arg;               /*!< Custom callback argument */
+#if LWUTIL_CFG_STATS
+    size_t varint_len[LWUTIL_STATS_VARINT_LEN_MAX]; /*!< Decoded values by length, for instrumentation */
+#endif /* LWUTIL_CFG_STATS */
+} prv_varint_sink_t;
+
+/**
+ * \brief           Write decoded value to the output
+ * \param[in]       sink: Decoder output
+ * \param[in]       val: Decoded value
+ * \param[in]       len: Encoded length of the value in units of bytes
+ */
+static inline void
+prv_varint_sink_put(prv_varint_sink_t* sink, uint64_t val, size_t len) {
+    LWUTIL_UNUSED(len);
+    PRV_STATS_VARINT_HIST_ADD(sink->varint_len, len, 1U);
+    if (sink->vals32 != NULL) {
+        sink->vals32[sink->cnt] = (uint32_t)val;
+    } else if (sink->vals64 != NULL) {
+        sink->vals64[sink->cnt] = val;
+    } else {
+        sink->fn(val, sink->arg);
+    }
+    ++sink->cnt;
+}
+
+/**
+ * \brief           Process chunk of data with streaming decoder
+ * 
+ * Complete values within the chunk are decoded directly from the input data.
+ * Only the value split between chunks is accumulated byte by byte in the decoder object.
+ * 
+ * \param[in]       dec: Decoder object
+ * \param[in]       data: Input data chunk
+ * \param[in]       len: Length of input data chunk
+ * \param[in]       max_bytes: Maximum varint length. `5` for `32-bit` and `10` for `64-bit` integers
+ * \param[in]       sink: Decoder output
+ * \return          Number of consumed bytes
+ */
+static size_t
+prv_varint_dec(lwutil_varint_dec_t* dec, const uint8_t* data, size_t len, size_t max_bytes, prv_varint_sink_t* sink) {
+    const uint8_t* p = data;
+    const uint8_t* p_end = data + len;
+    uint64_t val;
+    size_t n;
+
+    while (p < p_end && !dec->err && (sink->vals_max == 0 || sink->cnt < sink->vals_max)) {
+        if (dec->cnt == 0) {
+            n = prv_ld_varint(p, (size_t)(p_end - p), max_bytes, &val);
+            if (n > 0) {
+                prv_varint_sink_put(sink, val, n);
+                p += n;
+                continue;
+            } else if ((size_t)(p_end - p) >= max_bytes) {
+                dec->err = 1;
+                break;
+            }
+        }
+
+        /* Value is split between chunks, continue byte by byte */
+        for (; p < p_end; ++p) {
+            if (dec->cnt >= max_bytes) {
+                dec->err = 1;
+                break;
+            }
+            dec->val |= ((uint64_t)(*p & 0x7FU)) << (7U * dec->cnt);
+            ++dec->cnt;
+            if (*p < 0x80U) {
+                prv_varint_sink_put(sink, dec->val, dec->cnt);
+                dec->val = 0;
+                dec->cnt = 0;
+                ++p;
+                break;
+            }
+        }
+    }
+    PRV_STATS_VARINT_HIST_FLUSH(sink->varint_len);
+    return (size_t)(p - data);
+}
+
+/**
+ * \brief           Initialize streaming varint decoder
+ * 
+ * Decoder accepts input data in chunks of any size and keeps partially decoded value between calls,
+ * so that data received over UART or socket can be decoded without intermediate reassembly buffer.
+ * 
+ * \param[in]       dec: Decoder object
+ */
+LWUTIL_API void
+lwutil_varint_dec_init(lwutil_varint_dec_t* dec) {
+    if (!LWUTIL_IS_NULL(dec)) {
+        memset(dec, 0x00, sizeof(*dec));
+    }
+}
+
+/**
+ * \brief           Check if decoder holds partially decoded value
+ * \param[in]       dec: Decoder object
+ * \return          `1` if value is waiting for more data, `0` otherwise
+ */
+LWUTIL_API uint8_t
+lwutil_varint_dec_is_pending(const lwutil_varint_dec_t* dec) {
+    return !LWUTIL_IS_NULL(dec) && dec->cnt > 0;
+}
+
+/**
+ * \brief           Decode chunk of data to `32-bit` values
+ * 
+ * Processing stops when the chunk is consumed, when the output array is full
+ * or when varint longer than `5` bytes is found. In the latter case, error flag is set
+ * and decoder must be initialized again.
+ * 
+ * \param[in]       dec: Decoder object
+ * \param[in]       data: Input data chunk
+ * \param[in]       len: Length of input data chunk
+ * \param[out]      vals_out: Array to write decoded values to
+ * \param[in]       vals_max: Size of `vals_out` array
+ * \param[out]      vals_cnt: Pointer to variable to write number of decoded values to. Can be set to `NULL`
+ * \return          Number of consumed bytes from the chunk.
+ *                      If lower than `len`, call function again with the remaining data
+ */
+LWUTIL_API size_t
+lwutil_varint_dec_u32(lwutil_varint_dec_t* dec, const void* data, size_t len, uint32_t* vals_out, size_t vals_max,
+                      size_t* vals_cnt) {
+    prv_varint_sink_t sink;
+    size_t consumed = 0;
+
+    memset(&sink, 0x00, sizeof(sink));
+    sink.vals32 = vals_out;
+    sink.vals_max = vals_max;
+    if (!LWUTIL_IS_NULL(dec) && !LWUTIL_IS_NULL(data) && !LWUTIL_IS_NULL(vals_out) && vals_max > 0) {
+        consumed = prv_varint_dec(dec, (const uint8_t*)data, len, 5U, &sink);
+    }
+    LWUTIL_SET_VALUE_IF_PTR_NOT_NULL(vals_cnt, sink.cnt);
+    return consumed;
+}
+
+/**
+ * \brief           Decode chunk of data to `64-bit` values
+ * 
+ * Processing stops when the chunk is consumed, when the output array is full
+ * or when varint longer than `10` bytes is found. In the latter case, error flag is set
+ * and decoder must be initialized again.
+ * 
+ * \param[in]       dec: Decoder object
+ * \param[in]       data: Input data chunk
+ * \param[in]       len: Length of input data chunk
+ * \param[out]      vals_out: Array to write decoded values to
+ * \param[in]       vals_max: Size of `vals_out` array
+ * \param[out]      vals_cnt: Pointer to variable to write number of decoded values to. Can be set to `NULL`
+ * \return          Number of consumed bytes from the chunk.
+ *                      If lower than `len`, call function again with the remaining data
+ */
+LWUTIL_API size_t
+lwutil_varint_dec_u64(lwutil_varint_dec_t* dec, const void* data, size_t len, uint64_t* vals_out, size_t vals_max,
+                      size_t* vals_cnt) {
+    prv_varint_sink_t sink;
+    size_t consumed = 0;
+
+    memset(&sink, 0x00, sizeof(sink));
+    sink.vals64 = vals_out;
+    sink.vals_max = vals_max;
+    if (!LWUTIL_IS_NULL(dec) && !LWUTIL_IS_NULL(data) && !LWUTIL_IS_NULL(vals_out) && vals_max > 0) {
+        consumed = prv_varint_dec(dec, (const uint8_t*)data, len, 10U, &sink);
+    }
+    LWUTIL_SET_VALUE_IF_PTR_NOT_NULL(vals_cnt, sink.cnt);
+    return consumed;
+}
+
+/**
+ * \brief           Decode chunk of data and report every `64-bit` value through callback
+ * \param[in]       dec: Decoder object
+ * \param[in]       data: Input data chunk
+ * \param[in]       len: Length of input data chunk
+ * \param[in]       fn: Callback function called for every decoded value
+ * \param[in]       arg: Custom user argument passed to callback function
+ * \return          Number of consumed bytes from the chunk.
+ *                      Lower than `len` only if varint longer than `10` bytes has been found
+ */
+LWUTIL_API size_t
+lwutil_varint_dec_cb(lwutil_varint_dec_t* dec, const void* data, size_t len, lwutil_varint_dec_fn fn, void* arg) {
+    prv_varint_sink_t sink;
+
+    if (LWUTIL_IS_NULL(dec) || LWUTIL_IS_NULL(data) || LWUTIL_IS_NULL(fn)) {
+        return 0;
+    }
+    memset(&sink, 0x00, sizeof(sink));
+    sink.fn = fn;
+    sink.arg = arg;
+    return prv_varint_dec(dec, (const uint8_t*)data, len, 10U, &sink);
+}
+
+/**
+ * \brief           Load prefix varint of up to `max_bytes` bytes
+ * 
+ * Length of the value is stored as number of trailing zero bits in the first byte,
+ * therefore the whole value is extracted with single unaligned load, shift and mask,
+ * when at least `8` bytes are available.
+ * 
+ * \param[in]       p: Array pointer to load data from
+ * \param[in]       ptr_len: Input array length, must be greater than `0`
+ * \param[in]       max_bytes: Maximum length. `5` for `32-bit` and `9` for `64-bit` integers
+ * \param[out]      val_out: Pointer to variable to write result value
+ * \return          Number of bytes used for the value. `0` in case of an error.
+ */
+static inline size_t
+prv_ld_pvarint(const uint8_t* p, size_t ptr_len, size_t max_bytes, uint64_t* val_out) {
+    uint64_t word;
+    size_t len = (size_t)prv_ctz32((uint32_t)p[0] | 0x100U) + 1U;
+
+    if (len > max_bytes || len > ptr_len) {
+        return 0;
+    }
+    if (len == 9U) {
+        *val_out = prv_ld_u64_le_unaligned(&p[1]);
+        return len;
+    }
+    if (ptr_len >= 8U) {
+        word = prv_ld_u64_le_unaligned(p);
+    } else {
+        word = 0;
+        for (size_t i = 0; i < len; ++i) {
+            word |= (uint64_t)p[i] << (8U * i);
+        }
+    }
+    *val_out = (word >> len) & (0xFFFFFFFFFFFFFFFFULL >> (64U - 7U * len));
+    return len;
+}
+
+/**
+ * \brief           Store prefix varint
+ * \param[in]       val: Value to store
+ * \param[out]      p: Array to write output result
+ * \param[in]       ptr_len: Length of output array
+ * \return          Number of bytes written (stored). `0` in case of an error.
+ */
+static inline size_t
+prv_st_pvarint(uint64_t val, uint8_t* p, size_t ptr_len) {
+    size_t len = val < (1ULL << 56U) ? lwutil_u64_varint_len(val) : 9U;
+    uint64_t word;
+
+    if (len > ptr_len) {
+        return 0;
+    }
+    if (len == 9U) {
+        p[0] = 0x00U;
+        lwutil_st_u64_le(val, &p[1]);
+        return len;
+    }
+    word = (val << len) | (1ULL << (len - 1U));
+    for (size_t i = 0; i < len; ++i) {
+        p[i] = (uint8_t)(word >> (8U * i));
+    }
+    return len;
+}
+
+/**
+ * \brief           Load `32-bit` prefix varint from the byte stream to the variable.
+ * 
+ * Prefix varint is an alternative variable length integer format to the continuation-bit format,
+ * used by \ref lwutil_ld_u32_varint. It uses the same number of bytes for `32-bit` values,
+ * but stores the total length in the first byte, as number of its trailing zero bits (`xxxxxxx1` for `1` byte,
+ * `xxxxxx10` for `2` bytes, ...), followed by the value in little-endian format.
+ * Decoder therefore does not need to check every byte to find the end of the value.
+ * 
+ * \note            Formats are not compatible with each other
  * 
  * \param           ptr: Array pointer to load data from
  * \param           ptr_len: Input array length
  * \param           val_out: Pointer to variable to write result value
- * \return          Number of bytes written (stored). `0` in case of an error.
+ * \return          Number of bytes used for the value. `0` in case of an error.
  */
-uint8_t
-lwutil_ld_u32_varint(const void* ptr, size_t ptr_len, uint32_t* val_out) {
-    size_t cnt = 0;
-    uint32_t val = 0;
-    const uint8_t* p_data = ptr;
-    uint8_t byt;
+LWUTIL_API uint8_t
+lwutil_ld_u32_pvarint(const void* ptr, size_t ptr_len, uint32_t* val_out) {
+    uint64_t val = 0;
+    size_t cnt;
 
-    if (ptr == NULL || ptr_len == 0 || val_out == NULL) {
+    if (LWUTIL_IS_NULL(ptr) || ptr_len == 0 || LWUTIL_IS_NULL(val_out)) {
         return 0;
     }
-    do {
-        byt = *p_data++;
-        val |= ((uint32_t)(byt & 0x7FU)) << (cnt * 7U);
-        ++cnt;
-    } while (--ptr_len > 0 && (byt & 0x80U) > 0);
-
-    /* Check memory length */
-    if ((byt & 0x80U) > 0) {
-        val = 0;
+    cnt = prv_ld_pvarint((const uint8_t*)ptr, ptr_len, 5U, &val);
+    if (val > 0xFFFFFFFFU) {
         cnt = 0;
     }
-    *val_out = val;
-    return cnt;
+    *val_out = cnt > 0 ? (uint32_t)val : 0;
+    return (uint8_t)cnt;
 }
 
 /**
- * \brief           Store an integer into variable length byte sequence array.
- * 
- * Variable length integers (short varints) are stored with continuation bit (bit 7, 0x80),
- * which tells us if there is a next byte to be used as part of the number sequence.
+ * \brief           Store `32-bit` integer into prefix varint byte sequence array.
  * 
  * 32-bit integer can be stored with anything between `1` and `5` bytes.
  * 
@@ -136,23 +3203,211 @@ lwutil_ld_u32_varint(const void* ptr, size_t ptr_len, uint32_t* val_out) {
  * \param           ptr_len: Length of an input array
  * \return          Number of bytes written (stored). `0` in case of an error.
  */
-uint8_t
-lwutil_st_u32_varint(uint32_t val, void* ptr, size_t ptr_len) {
-    uint8_t* p_data = ptr;
-    size_t cnt = 0;
+LWUTIL_API uint8_t
+lwutil_st_u32_pvarint(uint32_t val, void* ptr, size_t ptr_len) {
+    if (LWUTIL_IS_NULL(ptr) || ptr_len == 0) {
+        return 0;
+    }
+    return (uint8_t)prv_st_pvarint(val, (uint8_t*)ptr, ptr_len);
+}
+
+/**
+ * \brief           Load `64-bit` prefix varint from the byte stream to the variable.
+ * 
+ * Values up to `56` bits use the same number of bytes as with continuation-bit format.
+ * Larger values use `9` bytes: first byte set to `0`, followed by the value in little-endian format.
+ * 
+ * \param           ptr: Array pointer to load data from
+ * \param           ptr_len: Input array length
+ * \param           val_out: Pointer to variable to write result value
+ * \return          Number of bytes used for the value. `0` in case of an error.
+ */
+LWUTIL_API uint8_t
+lwutil_ld_u64_pvarint(const void* ptr, size_t ptr_len, uint64_t* val_out) {
+    uint64_t val = 0;
+    size_t cnt;
 
-    if (ptr == NULL || ptr_len == 0) {
+    if (LWUTIL_IS_NULL(ptr) || ptr_len == 0 || LWUTIL_IS_NULL(val_out)) {
         return 0;
     }
-    do {
-        *p_data++ = (val & 0x7FU) | (val > 0x7FU ? 0x80U : 0x00U);
-        val >>= 7U;
-        ++cnt;
-    } while (--ptr_len > 0 && val > 0);
+    cnt = prv_ld_pvarint((const uint8_t*)ptr, ptr_len, 9U, &val);
+    *val_out = cnt > 0 ? val : 0;
+    return (uint8_t)cnt;
+}
 
-    /* Memory check */
-    if (val > 0) {
-        cnt = 0;
+/**
+ * \brief           Store `64-bit` integer into prefix varint byte sequence array.
+ * 
+ * 64-bit integer can be stored with anything between `1` and `9` bytes.
+ * 
+ * \param           val: Value to encode into byte sequence
+ * \param           ptr: Array to write output result
+ * \param           ptr_len: Length of an input array
+ * \return          Number of bytes written (stored). `0` in case of an error.
+ */
+LWUTIL_API uint8_t
+lwutil_st_u64_pvarint(uint64_t val, void* ptr, size_t ptr_len) {
+    if (LWUTIL_IS_NULL(ptr) || ptr_len == 0) {
+        return 0;
     }
-    return cnt;
+    return (uint8_t)prv_st_pvarint(val, (uint8_t*)ptr, ptr_len);
+}
+
+/**
+ * \brief           Get number of bytes required to store `64-bit` value as prefix varint
+ * \param           val: Value to get length for
+ * \return          Number of bytes, between `1` and `9`
+ */
+LWUTIL_API uint8_t
+lwutil_u64_pvarint_len(uint64_t val) {
+    return val < (1ULL << 56U) ? lwutil_u64_varint_len(val) : 9U;
+}
+
+/**
+ * \brief           Load array of prefix varints
+ * \param[in]       ptr: Array pointer to load data from
+ * \param[in]       ptr_len: Input array length
+ * \param[out]      vals_out: Array to write `count` decoded values to
+ * \param[out]      vals64_out: Array to write `count` decoded values to, used when `vals_out` is `NULL`
+ * \param[in]       count: Number of values to decode
+ * \return          Number of bytes consumed from the input array. `0` in case of an error.
+ */
+static size_t
+prv_ld_pvarint_array(const void* ptr, size_t ptr_len, uint32_t* vals_out, uint64_t* vals64_out, size_t count) {
+    const uint8_t* p_data = (const uint8_t*)ptr;
+    const uint8_t* p_end = p_data + ptr_len;
+    uint64_t val;
+    size_t len;
+
+    for (size_t idx = 0; idx < count; ++idx) {
+        if (p_data >= p_end) {
+            return 0;
+        }
+        if (vals_out != NULL) {
+            len = prv_ld_pvarint(p_data, (size_t)(p_end - p_data), 5U, &val);
+            if (len == 0 || val > 0xFFFFFFFFU) {
+                return 0;
+            }
+            vals_out[idx] = (uint32_t)val;
+        } else {
+            len = prv_ld_pvarint(p_data, (size_t)(p_end - p_data), 9U, &vals64_out[idx]);
+            if (len == 0) {
+                return 0;
+            }
+        }
+        p_data += len;
+    }
+    return (size_t)(p_data - (const uint8_t*)ptr);
+}
+
+/**
+ * \brief           Store array of values as prefix varints
+ * 
+ * While at least `8` bytes are available in the output array,
+ * every value is written with single unaligned store.
+ * 
+ * \param[in]       vals: Array of values to encode, used when `vals64` is `NULL`
+ * \param[in]       vals64: Array of values to encode
+ * \param[in]       count: Number of values to encode
+ * \param[out]      ptr: Array to write output result
+ * \param[in]       ptr_len: Length of an output array
+ * \return          Number of bytes written (stored). `0` in case of an error.
+ */
+static size_t
+prv_st_pvarint_array(const uint32_t* vals, const uint64_t* vals64, size_t count, void* ptr, size_t ptr_len) {
+    uint8_t* p_data = (uint8_t*)ptr;
+    uint8_t* p_end = p_data + ptr_len;
+    size_t len;
+
+    for (size_t idx = 0; idx < count; ++idx) {
+        uint64_t val = vals64 != NULL ? vals64[idx] : vals[idx];
+
+#if defined(LWUTIL_HOST_LE)
+        if (val < (1ULL << 56U) && (size_t)(p_end - p_data) >= 8U) {
+            len = lwutil_u64_varint_len(val);
+            val = (val << len) | (1ULL << (len - 1U));
+            memcpy(p_data, &val, sizeof(val));
+            p_data += len;
+            continue;
+        }
+#endif /* defined(LWUTIL_HOST_LE) */
+        len = prv_st_pvarint(val, p_data, (size_t)(p_end - p_data));
+        if (len == 0) {
+            return 0;
+        }
+        p_data += len;
+    }
+    return (size_t)(p_data - (uint8_t*)ptr);
+}
+
+/**
+ * \brief           Load array of `32-bit` prefix varints from the byte stream
+ * \param[in]       ptr: Array pointer to load data from
+ * \param[in]       ptr_len: Input array length
+ * \param[out]      vals_out: Array to write `count` decoded values to
+ * \param[in]       count: Number of values to decode
+ * \return          Number of bytes consumed from the input array.
+ *                      `0` in case of an error or if input array does not hold `count` complete values.
+ */
+LWUTIL_API size_t
+lwutil_ld_u32_pvarint_array(const void* ptr, size_t ptr_len, uint32_t* vals_out, size_t count) {
+    if (LWUTIL_IS_NULL(ptr) || LWUTIL_IS_NULL(vals_out) || ptr_len == 0) {
+        return 0;
+    }
+    return prv_ld_pvarint_array(ptr, ptr_len, vals_out, NULL, count);
+}
+
+/**
+ * \brief           Store array of `32-bit` integers as prefix varints
+ * \note            Output array bytes after the returned length may be modified
+ * \param[in]       vals: Array of values to encode
+ * \param[in]       count: Number of values in `vals` array
+ * \param[out]      ptr: Array to write output result
+ * \param[in]       ptr_len: Length of an output array
+ * \return          Number of bytes written (stored).
+ *                      `0` in case of an error or if output array is too short for all values.
+ */
+LWUTIL_API size_t
+lwutil_st_u32_pvarint_array(const uint32_t* vals, size_t count, void* ptr, size_t ptr_len) {
+    if (LWUTIL_IS_NULL(vals) || LWUTIL_IS_NULL(ptr) || ptr_len == 0) {
+        return 0;
+    }
+    return prv_st_pvarint_array(vals, NULL, count, ptr, ptr_len);
+}
+
+/**
+ * \brief           Load array of `64-bit` prefix varints from the byte stream
+ * \param[in]       ptr: Array pointer to load data from
+ * \param[in]       ptr_len: Input array length
+ * \param[out]      vals_out: Array to write `count` decoded values to
+ * \param[in]       count: Number of values to decode
+ * \return          Number of bytes consumed from the input array.
+ *                      `0` in case of an error or if input array does not hold `count` complete values.
+ */
+LWUTIL_API size_t
+lwutil_ld_u64_pvarint_array(const void* ptr, size_t ptr_len, uint64_t* vals_out, size_t count) {
+    if (LWUTIL_IS_NULL(ptr) || LWUTIL_IS_NULL(vals_out) || ptr_len == 0) {
+        return 0;
+    }
+    return prv_ld_pvarint_array(ptr, ptr_len, NULL, vals_out, count);
+}
+
+/**
+ * \brief           Store array of `64-bit` integers as prefix varints
+ * \note            Output array bytes after the returned length may be modified
+ * \param[in]       vals: Array of values to encode
+ * \param[in]       count: Number of values in `vals` array
+ * \param[out]      ptr: Array to write output result
+ * \param[in]       ptr_len: Length of an output array
+ * \return          Number of bytes written (stored).
+ *                      `0` in case of an error or if output array is too short for all values.
+ */
+LWUTIL_API size_t
+lwutil_st_u64_pvarint_array(const uint64_t* vals, size_t count, void* ptr, size_t ptr_len) {
+    if (LWUTIL_IS_NULL(vals) || LWUTIL_IS_NULL(ptr) || ptr_len == 0) {
+        return 0;
+    }
+    return prv_st_pvarint_array(NULL, vals, count, ptr, ptr_len);
 }
+
+#endif /* !LWUTIL_CFG_HEADER_ONLY || defined(LWUTIL_HEADER_ONLY_IMPL) */
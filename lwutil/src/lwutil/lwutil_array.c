@@ -0,0 +1,1142 @@
+/**
+ * \file            lwutil_array.c
+ * \brief           Array reductions and element-wise kernels
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwUTIL - Lightweight utility library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v1.3.0
+ */
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lwutil/lwutil_array.h"
+#include "lwutil/lwutil_private.h"
+
+/*
+ * In header-only mode, implementation is included by the lwutil_array.h header,
+ * and is compiled into every translation unit as static inline functions.
+ */
+#if !LWUTIL_CFG_HEADER_ONLY || defined(LWUTIL_HEADER_ONLY_IMPL)
+
+#if LWUTIL_SIMD_MAX >= 2
+
+/**
+ * \brief           Update minimum and maximum with SSE4.1 instructions
+ * \param[in]       arr: Input array
+ * \param[in]       count: Number of elements. Only multiple of `16` elements is processed
+ * \param[in,out]   min_io: Minimum value, updated with processed elements
+ * \param[in,out]   max_io: Maximum value, updated with processed elements
+ * \return          Number of processed elements
+ */
+LWUTIL_TARGET("sse4.1")
+static size_t
+prv_array_minmax_u8_sse41(const uint8_t* arr, size_t count, uint8_t* min_io, uint8_t* max_io) {
+    __m128i vmin = _mm_set1_epi8((char)*min_io), vmax = _mm_set1_epi8((char)*max_io);
+    uint8_t tmp_min[16], tmp_max[16];
+    size_t idx = 0;
+
+    for (; (count - idx) >= 16U; idx += 16U) {
+        __m128i v = _mm_loadu_si128((const __m128i*)&arr[idx]);
+
+        vmin = _mm_min_epu8(v, vmin);
+        vmax = _mm_max_epu8(v, vmax);
+    }
+    _mm_storeu_si128((__m128i*)tmp_min, vmin);
+    _mm_storeu_si128((__m128i*)tmp_max, vmax);
+    for (size_t i = 0; i < 16U; ++i) {
+        *min_io = tmp_min[i] < *min_io ? tmp_min[i] : *min_io;
+        *max_io = tmp_max[i] > *max_io ? tmp_max[i] : *max_io;
+    }
+    return idx;
+}
+
+/**
+ * \brief           Clamp elements with SSE4.1 instructions
+ * \param[in]       in: Input array
+ * \param[out]      out: Output array. May be equal to `in`
+ * \param[in]       count: Number of elements. Only multiple of `16` elements is processed
+ * \param[in]       lo: Minimum value
+ * \param[in]       hi: Maximum value
+ * \return          Number of processed elements
+ */
+LWUTIL_TARGET("sse4.1")
+static size_t
+prv_array_clamp_u8_sse41(const uint8_t* in, uint8_t* out, size_t count, uint8_t lo, uint8_t hi) {
+    const __m128i vlo = _mm_set1_epi8((char)lo), vhi = _mm_set1_epi8((char)hi);
+    size_t idx = 0;
+
+    for (; (count - idx) >= 16U; idx += 16U) {
+        __m128i v = _mm_loadu_si128((const __m128i*)&in[idx]);
+
+        _mm_storeu_si128((__m128i*)&out[idx], _mm_min_epu8(_mm_max_epu8(v, vlo), vhi));
+    }
+    return idx;
+}
+
+/**
+ * \brief           Update minimum and maximum with SSE4.1 instructions
+ * \param[in]       arr: Input array
+ * \param[in]       count: Number of elements. Only multiple of `8` elements is processed
+ * \param[in,out]   min_io: Minimum value, updated with processed elements
+ * \param[in,out]   max_io: Maximum value, updated with processed elements
+ * \return          Number of processed elements
+ */
+LWUTIL_TARGET("sse4.1")
+static size_t
+prv_array_minmax_s16_sse41(const int16_t* arr, size_t count, int16_t* min_io, int16_t* max_io) {
+    __m128i vmin = _mm_set1_epi16(*min_io), vmax = _mm_set1_epi16(*max_io);
+    int16_t tmp_min[8], tmp_max[8];
+    size_t idx = 0;
+
+    for (; (count - idx) >= 8U; idx += 8U) {
+        __m128i v = _mm_loadu_si128((const __m128i*)&arr[idx]);
+
+        vmin = _mm_min_epi16(v, vmin);
+        vmax = _mm_max_epi16(v, vmax);
+    }
+    _mm_storeu_si128((__m128i*)tmp_min, vmin);
+    _mm_storeu_si128((__m128i*)tmp_max, vmax);
+    for (size_t i = 0; i < 8U; ++i) {
+        *min_io = tmp_min[i] < *min_io ? tmp_min[i] : *min_io;
+        *max_io = tmp_max[i] > *max_io ? tmp_max[i] : *max_io;
+    }
+    return idx;
+}
+
+/**
+ * \brief           Clamp elements with SSE4.1 instructions
+ * \param[in]       in: Input array
+ * \param[out]      out: Output array. May be equal to `in`
+ * \param[in]       count: Number of elements. Only multiple of `8` elements is processed
+ * \param[in]       lo: Minimum value
+ * \param[in]       hi: Maximum value
+ * \return          Number of processed elements
+ */
+LWUTIL_TARGET("sse4.1")
+static size_t
+prv_array_clamp_s16_sse41(const int16_t* in, int16_t* out, size_t count, int16_t lo, int16_t hi) {
+    const __m128i vlo = _mm_set1_epi16(lo), vhi = _mm_set1_epi16(hi);
+    size_t idx = 0;
+
+    for (; (count - idx) >= 8U; idx += 8U) {
+        __m128i v = _mm_loadu_si128((const __m128i*)&in[idx]);
+
+        _mm_storeu_si128((__m128i*)&out[idx], _mm_min_epi16(_mm_max_epi16(v, vlo), vhi));
+    }
+    return idx;
+}
+
+/**
+ * \brief           Update minimum and maximum with SSE4.1 instructions
+ * \param[in]       arr: Input array
+ * \param[in]       count: Number of elements. Only multiple of `4` elements is processed
+ * \param[in,out]   min_io: Minimum value, updated with processed elements
+ * \param[in,out]   max_io: Maximum value, updated with processed elements
+ * \return          Number of processed elements
+ */
+LWUTIL_TARGET("sse4.1")
+static size_t
+prv_array_minmax_s32_sse41(const int32_t* arr, size_t count, int32_t* min_io, int32_t* max_io) {
+    __m128i vmin = _mm_set1_epi32(*min_io), vmax = _mm_set1_epi32(*max_io);
+    int32_t tmp_min[4], tmp_max[4];
+    size_t idx = 0;
+
+    for (; (count - idx) >= 4U; idx += 4U) {
+        __m128i v = _mm_loadu_si128((const __m128i*)&arr[idx]);
+
+        vmin = _mm_min_epi32(v, vmin);
+        vmax = _mm_max_epi32(v, vmax);
+    }
+    _mm_storeu_si128((__m128i*)tmp_min, vmin);
+    _mm_storeu_si128((__m128i*)tmp_max, vmax);
+    for (size_t i = 0; i < 4U; ++i) {
+        *min_io = tmp_min[i] < *min_io ? tmp_min[i] : *min_io;
+        *max_io = tmp_max[i] > *max_io ? tmp_max[i] : *max_io;
+    }
+    return idx;
+}
+
+/**
+ * \brief           Clamp elements with SSE4.1 instructions
+ * \param[in]       in: Input array
+ * \param[out]      out: Output array. May be equal to `in`
+ * \param[in]       count: Number of elements. Only multiple of `4` elements is processed
+ * \param[in]       lo: Minimum value
+ * \param[in]       hi: Maximum value
+ * \return          Number of processed elements
+ */
+LWUTIL_TARGET("sse4.1")
+static size_t
+prv_array_clamp_s32_sse41(const int32_t* in, int32_t* out, size_t count, int32_t lo, int32_t hi) {
+    const __m128i vlo = _mm_set1_epi32(lo), vhi = _mm_set1_epi32(hi);
+    size_t idx = 0;
+
+    for (; (count - idx) >= 4U; idx += 4U) {
+        __m128i v = _mm_loadu_si128((const __m128i*)&in[idx]);
+
+        _mm_storeu_si128((__m128i*)&out[idx], _mm_min_epi32(_mm_max_epi32(v, vlo), vhi));
+    }
+    return idx;
+}
+
+/**
+ * \brief           Update minimum and maximum with SSE4.1 instructions
+ * \param[in]       arr: Input array
+ * \param[in]       count: Number of elements. Only multiple of `4` elements is processed
+ * \param[in,out]   min_io: Minimum value, updated with processed elements
+ * \param[in,out]   max_io: Maximum value, updated with processed elements
+ * \return          Number of processed elements
+ */
+LWUTIL_TARGET("sse4.1")
+static size_t
+prv_array_minmax_f32_sse41(const float* arr, size_t count, float* min_io, float* max_io) {
+    __m128 vmin = _mm_set1_ps(*min_io), vmax = _mm_set1_ps(*max_io);
+    float tmp_min[4], tmp_max[4];
+    size_t idx = 0;
+
+    for (; (count - idx) >= 4U; idx += 4U) {
+        __m128 v = _mm_loadu_ps(&arr[idx]);
+
+        vmin = _mm_min_ps(v, vmin);
+        vmax = _mm_max_ps(v, vmax);
+    }
+    _mm_storeu_ps(tmp_min, vmin);
+    _mm_storeu_ps(tmp_max, vmax);
+    for (size_t i = 0; i < 4U; ++i) {
+        *min_io = tmp_min[i] < *min_io ? tmp_min[i] : *min_io;
+        *max_io = tmp_max[i] > *max_io ? tmp_max[i] : *max_io;
+    }
+    return idx;
+}
+
+/**
+ * \brief           Clamp elements with SSE4.1 instructions
+ * \param[in]       in: Input array
+ * \param[out]      out: Output array. May be equal to `in`
+ * \param[in]       count: Number of elements. Only multiple of `4` elements is processed
+ * \param[in]       lo: Minimum value
+ * \param[in]       hi: Maximum value
+ * \return          Number of processed elements
+ */
+LWUTIL_TARGET("sse4.1")
+static size_t
+prv_array_clamp_f32_sse41(const float* in, float* out, size_t count, float lo, float hi) {
+    const __m128 vlo = _mm_set1_ps(lo), vhi = _mm_set1_ps(hi);
+    size_t idx = 0;
+
+    for (; (count - idx) >= 4U; idx += 4U) {
+        _mm_storeu_ps(&out[idx], _mm_min_ps(_mm_max_ps(_mm_loadu_ps(&in[idx]), vlo), vhi));
+    }
+    return idx;
+}
+
+/**
+ * \brief           Calculate absolute values with SSE4.1 instructions
+ * \param[in]       in: Input array
+ * \param[out]      out: Output array. May be equal to `in`
+ * \param[in]       count: Number of elements. Only multiple of `8` elements is processed
+ * \param[in]       limit: Maximum output value
+ * \return          Number of processed elements
+ */
+LWUTIL_TARGET("sse4.1")
+static size_t
+prv_array_abs_s16_sse41(const int16_t* in, uint16_t* out, size_t count, uint16_t limit) {
+    const __m128i vlimit = _mm_set1_epi16((short)limit);
+    size_t idx = 0;
+
+    for (; (count - idx) >= 8U; idx += 8U) {
+        __m128i v = _mm_loadu_si128((const __m128i*)&in[idx]);
+
+        _mm_storeu_si128((__m128i*)&out[idx], _mm_min_epu16(_mm_abs_epi16(v), vlimit));
+    }
+    return idx;
+}
+
+/**
+ * \brief           Calculate absolute values with SSE4.1 instructions
+ * \param[in]       in: Input array
+ * \param[out]      out: Output array. May be equal to `in`
+ * \param[in]       count: Number of elements. Only multiple of `4` elements is processed
+ * \param[in]       limit: Maximum output value
+ * \return          Number of processed elements
+ */
+LWUTIL_TARGET("sse4.1")
+static size_t
+prv_array_abs_s32_sse41(const int32_t* in, uint32_t* out, size_t count, uint32_t limit) {
+    const __m128i vlimit = _mm_set1_epi32((int)limit);
+    size_t idx = 0;
+
+    for (; (count - idx) >= 4U; idx += 4U) {
+        __m128i v = _mm_loadu_si128((const __m128i*)&in[idx]);
+
+        _mm_storeu_si128((__m128i*)&out[idx], _mm_min_epu32(_mm_abs_epi32(v), vlimit));
+    }
+    return idx;
+}
+
+/**
+ * \brief           Calculate absolute values of floating-point elements with SSE4.1 instructions
+ * \param[in]       in: Input array
+ * \param[out]      out: Output array. May be equal to `in`
+ * \param[in]       count: Number of elements. Only multiple of `4` elements is processed
+ * \return          Number of processed elements
+ */
+LWUTIL_TARGET("sse4.1")
+static size_t
+prv_array_abs_f32_sse41(const float* in, float* out, size_t count) {
+    const __m128 mask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    size_t idx = 0;
+
+    for (; (count - idx) >= 4U; idx += 4U) {
+        _mm_storeu_ps(&out[idx], _mm_and_ps(_mm_loadu_ps(&in[idx]), mask));
+    }
+    return idx;
+}
+
+#endif /* LWUTIL_SIMD_MAX >= 2 */
+
+#if LWUTIL_SIMD_MAX >= 3
+
+/**
+ * \brief           Update minimum and maximum with AVX2 instructions
+ * \param[in]       arr: Input array
+ * \param[in]       count: Number of elements. Only multiple of `32` elements is processed
+ * \param[in,out]   min_io: Minimum value, updated with processed elements
+ * \param[in,out]   max_io: Maximum value, updated with processed elements
+ * \return          Number of processed elements
+ */
+LWUTIL_TARGET("avx2")
+static size_t
+prv_array_minmax_u8_avx2(const uint8_t* arr, size_t count, uint8_t* min_io, uint8_t* max_io) {
+    __m256i vmin = _mm256_set1_epi8((char)*min_io), vmax = _mm256_set1_epi8((char)*max_io);
+    uint8_t tmp_min[32], tmp_max[32];
+    size_t idx = 0;
+
+    for (; (count - idx) >= 32U; idx += 32U) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)&arr[idx]);
+
+        vmin = _mm256_min_epu8(v, vmin);
+        vmax = _mm256_max_epu8(v, vmax);
+    }
+    _mm256_storeu_si256((__m256i*)tmp_min, vmin);
+    _mm256_storeu_si256((__m256i*)tmp_max, vmax);
+    for (size_t i = 0; i < 32U; ++i) {
+        *min_io = tmp_min[i] < *min_io ? tmp_min[i] : *min_io;
+        *max_io = tmp_max[i] > *max_io ? tmp_max[i] : *max_io;
+    }
+    return idx;
+}
+
+/**
+ * \brief           Clamp elements with AVX2 instructions
+ * \param[in]       in: Input array
+ * \param[out]      out: Output array. May be equal to `in`
+ * \param[in]       count: Number of elements. Only multiple of `32` elements is processed
+ * \param[in]       lo: Minimum value
+ * \param[in]       hi: Maximum value
+ * \return          Number of processed elements
+ */
+LWUTIL_TARGET("avx2")
+static size_t
+prv_array_clamp_u8_avx2(const uint8_t* in, uint8_t* out, size_t count, uint8_t lo, uint8_t hi) {
+    const __m256i vlo = _mm256_set1_epi8((char)lo), vhi = _mm256_set1_epi8((char)hi);
+    size_t idx = 0;
+
+    for (; (count - idx) >= 32U; idx += 32U) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)&in[idx]);
+
+        _mm256_storeu_si256((__m256i*)&out[idx], _mm256_min_epu8(_mm256_max_epu8(v, vlo), vhi));
+    }
+    return idx;
+}
+
+/**
+ * \brief           Update minimum and maximum with AVX2 instructions
+ * \param[in]       arr: Input array
+ * \param[in]       count: Number of elements. Only multiple of `16` elements is processed
+ * \param[in,out]   min_io: Minimum value, updated with processed elements
+ * \param[in,out]   max_io: Maximum value, updated with processed elements
+ * \return          Number of processed elements
+ */
+LWUTIL_TARGET("avx2")
+static size_t
+prv_array_minmax_s16_avx2(const int16_t* arr, size_t count, int16_t* min_io, int16_t* max_io) {
+    __m256i vmin = _mm256_set1_epi16(*min_io), vmax = _mm256_set1_epi16(*max_io);
+    int16_t tmp_min[16], tmp_max[16];
+    size_t idx = 0;
+
+    for (; (count - idx) >= 16U; idx += 16U) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)&arr[idx]);
+
+        vmin = _mm256_min_epi16(v, vmin);
+        vmax = _mm256_max_epi16(v, vmax);
+    }
+    _mm256_storeu_si256((__m256i*)tmp_min, vmin);
+    _mm256_storeu_si256((__m256i*)tmp_max, vmax);
+    for (size_t i = 0; i < 16U; ++i) {
+        *min_io = tmp_min[i] < *min_io ? tmp_min[i] : *min_io;
+        *max_io = tmp_max[i] > *max_io ? tmp_max[i] : *max_io;
+    }
+    return idx;
+}
+
+/**
+ * \brief           Clamp elements with AVX2 instructions
+ * \param[in]       in: Input array
+ * \param[out]      out: Output array. May be equal to `in`
+ * \param[in]       count: Number of elements. Only multiple of `16` elements is processed
+ * \param[in]       lo: Minimum value
+ * \param[in]       hi: Maximum value
+ * \return          Number of processed elements
+ */
+LWUTIL_TARGET("avx2")
+static size_t
+prv_array_clamp_s16_avx2(const int16_t* in, int16_t* out, size_t count, int16_t lo, int16_t hi) {
+    const __m256i vlo = _mm256_set1_epi16(lo), vhi = _mm256_set1_epi16(hi);
+    size_t idx = 0;
+
+    for (; (count - idx) >= 16U; idx += 16U) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)&in[idx]);
+
+        _mm256_storeu_si256((__m256i*)&out[idx], _mm256_min_epi16(_mm256_max_epi16(v, vlo), vhi));
+    }
+    return idx;
+}
+
+/**
+ * \brief           Update minimum and maximum with AVX2 instructions
+ * \param[in]       arr: Input array
+ * \param[in]       count: Number of elements. Only multiple of `8` elements is processed
+ * \param[in,out]   min_io: Minimum value, updated with processed elements
+ * \param[in,out]   max_io: Maximum value, updated with processed elements
+ * \return          Number of processed elements
+ */
+LWUTIL_TARGET("avx2")
+static size_t
+prv_array_minmax_s32_avx2(const int32_t* arr, size_t count, int32_t* min_io, int32_t* max_io) {
+    __m256i vmin = _mm256_set1_epi32(*min_io), vmax = _mm256_set1_epi32(*max_io);
+    int32_t tmp_min[8], tmp_max[8];
+    size_t idx = 0;
+
+    for (; (count - idx) >= 8U; idx += 8U) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)&arr[idx]);
+
+        vmin = _mm256_min_epi32(v, vmin);
+        vmax = _mm256_max_epi32(v, vmax);
+    }
+    _mm256_storeu_si256((__m256i*)tmp_min, vmin);
+    _mm256_storeu_si256((__m256i*)tmp_max, vmax);
+    for (size_t i = 0; i < 8U; ++i) {
+        *min_io = tmp_min[i] < *min_io ? tmp_min[i] : *min_io;
+        *max_io = tmp_max[i] > *max_io ? tmp_max[i] : *max_io;
+    }
+    return idx;
+}
+
+/**
+ * \brief           Clamp elements with AVX2 instructions
+ * \param[in]       in: Input array
+ * \param[out]      out: Output array. May be equal to `in`
+ * \param[in]       count: Number of elements. Only multiple of `8` elements is processed
+ * \param[in]       lo: Minimum value
+ * \param[in]       hi: Maximum value
+ * \return          Number of processed elements
+ */
+LWUTIL_TARGET("avx2")
+static size_t
+prv_array_clamp_s32_avx2(const int32_t* in, int32_t* out, size_t count, int32_t lo, int32_t hi) {
+    const __m256i vlo = _mm256_set1_epi32(lo), vhi = _mm256_set1_epi32(hi);
+    size_t idx = 0;
+
+    for (; (count - idx) >= 8U; idx += 8U) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)&in[idx]);
+
+        _mm256_storeu_si256((__m256i*)&out[idx], _mm256_min_epi32(_mm256_max_epi32(v, vlo), vhi));
+    }
+    return idx;
+}
+
+/**
+ * \brief           Update minimum and maximum with AVX2 instructions
+ * \param[in]       arr: Input array
+ * \param[in]       count: Number of elements. Only multiple of `8` elements is processed
+ * \param[in,out]   min_io: Minimum value, updated with processed elements
+ * \param[in,out]   max_io: Maximum value, updated with processed elements
+ * \return          Number of processed elements
+ */
+LWUTIL_TARGET("avx2")
+static size_t
+prv_array_minmax_f32_avx2(const float* arr, size_t count, float* min_io, float* max_io) {
+    __m256 vmin = _mm256_set1_ps(*min_io), vmax = _mm256_set1_ps(*max_io);
+    float tmp_min[8], tmp_max[8];
+    size_t idx = 0;
+
+    for (; (count - idx) >= 8U; idx += 8U) {
+        __m256 v = _mm256_loadu_ps(&arr[idx]);
+
+        vmin = _mm256_min_ps(v, vmin);
+        vmax = _mm256_max_ps(v, vmax);
+    }
+    _mm256_storeu_ps(tmp_min, vmin);
+    _mm256_storeu_ps(tmp_max, vmax);
+    for (size_t i = 0; i < 8U; ++i) {
+        *min_io = tmp_min[i] < *min_io ? tmp_min[i] : *min_io;
+        *max_io = tmp_max[i] > *max_io ? tmp_max[i] : *max_io;
+    }
+    return idx;
+}
+
+/**
+ * \brief           Clamp elements with AVX2 instructions
+ * \param[in]       in: Input array
+ * \param[out]      out: Output array. May be equal to `in`
+ * \param[in]       count: Number of elements. Only multiple of `8` elements is processed
+ * \param[in]       lo: Minimum value
+ * \param[in]       hi: Maximum value
+ * \return          Number of processed elements
+ */
+LWUTIL_TARGET("avx2")
+static size_t
+prv_array_clamp_f32_avx2(const float* in, float* out, size_t count, float lo, float hi) {
+    const __m256 vlo = _mm256_set1_ps(lo), vhi = _mm256_set1_ps(hi);
+    size_t idx = 0;
+
+    for (; (count - idx) >= 8U; idx += 8U) {
+        _mm256_storeu_ps(&out[idx], _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(&in[idx]), vlo), vhi));
+    }
+    return idx;
+}
+
+/**
+ * \brief           Calculate absolute values with AVX2 instructions
+ * \param[in]       in: Input array
+ * \param[out]      out: Output array. May be equal to `in`
+ * \param[in]       count: Number of elements. Only multiple of `16` elements is processed
+ * \param[in]       limit: Maximum output value
+ * \return          Number of processed elements
+ */
+LWUTIL_TARGET("avx2")
+static size_t
+prv_array_abs_s16_avx2(const int16_t* in, uint16_t* out, size_t count, uint16_t limit) {
+    const __m256i vlimit = _mm256_set1_epi16((short)limit);
+    size_t idx = 0;
+
+    for (; (count - idx) >= 16U; idx += 16U) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)&in[idx]);
+
+        _mm256_storeu_si256((__m256i*)&out[idx], _mm256_min_epu16(_mm256_abs_epi16(v), vlimit));
+    }
+    return idx;
+}
+
+/**
+ * \brief           Calculate absolute values with AVX2 instructions
+ * \param[in]       in: Input array
+ * \param[out]      out: Output array. May be equal to `in`
+ * \param[in]       count: Number of elements. Only multiple of `8` elements is processed
+ * \param[in]       limit: Maximum output value
+ * \return          Number of processed elements
+ */
+LWUTIL_TARGET("avx2")
+static size_t
+prv_array_abs_s32_avx2(const int32_t* in, uint32_t* out, size_t count, uint32_t limit) {
+    const __m256i vlimit = _mm256_set1_epi32((int)limit);
+    size_t idx = 0;
+
+    for (; (count - idx) >= 8U; idx += 8U) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)&in[idx]);
+
+        _mm256_storeu_si256((__m256i*)&out[idx], _mm256_min_epu32(_mm256_abs_epi32(v), vlimit));
+    }
+    return idx;
+}
+
+/**
+ * \brief           Calculate absolute values of floating-point elements with AVX2 instructions
+ * \param[in]       in: Input array
+ * \param[out]      out: Output array. May be equal to `in`
+ * \param[in]       count: Number of elements. Only multiple of `8` elements is processed
+ * \return          Number of processed elements
+ */
+LWUTIL_TARGET("avx2")
+static size_t
+prv_array_abs_f32_avx2(const float* in, float* out, size_t count) {
+    const __m256 mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+    size_t idx = 0;
+
+    for (; (count - idx) >= 8U; idx += 8U) {
+        _mm256_storeu_ps(&out[idx], _mm256_and_ps(_mm256_loadu_ps(&in[idx]), mask));
+    }
+    return idx;
+}
+
+#endif /* LWUTIL_SIMD_MAX >= 3 */
+
+/**
+ * \brief           Set of array kernels for one SIMD level
+ *
+ * `NULL` kernel means scalar code is used.
+ */
+typedef struct {
+    size_t (*minmax_u8)(const uint8_t* arr, size_t count, uint8_t* min_io, uint8_t* max_io);
+    size_t (*minmax_s16)(const int16_t* arr, size_t count, int16_t* min_io, int16_t* max_io);
+    size_t (*minmax_s32)(const int32_t* arr, size_t count, int32_t* min_io, int32_t* max_io);
+    size_t (*minmax_f32)(const float* arr, size_t count, float* min_io, float* max_io);
+    size_t (*clamp_u8)(const uint8_t* in, uint8_t* out, size_t count, uint8_t lo, uint8_t hi);
+    size_t (*clamp_s16)(const int16_t* in, int16_t* out, size_t count, int16_t lo, int16_t hi);
+    size_t (*clamp_s32)(const int32_t* in, int32_t* out, size_t count, int32_t lo, int32_t hi);
+    size_t (*clamp_f32)(const float* in, float* out, size_t count, float lo, float hi);
+    size_t (*abs_s16)(const int16_t* in, uint16_t* out, size_t count, uint16_t limit);
+    size_t (*abs_s32)(const int32_t* in, uint32_t* out, size_t count, uint32_t limit);
+    size_t (*abs_f32)(const float* in, float* out, size_t count);
+} prv_array_kernels_t;
+
+/* Kernels for every compiled SIMD level, indexed by level */
+static const prv_array_kernels_t prv_array_kernels[] = {
+    {NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL},
+#if LWUTIL_SIMD_MAX >= 1
+    {NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL},
+#endif /* LWUTIL_SIMD_MAX >= 1 */
+#if LWUTIL_SIMD_MAX >= 2
+    {prv_array_minmax_u8_sse41, prv_array_minmax_s16_sse41, prv_array_minmax_s32_sse41, prv_array_minmax_f32_sse41,
+     prv_array_clamp_u8_sse41, prv_array_clamp_s16_sse41, prv_array_clamp_s32_sse41, prv_array_clamp_f32_sse41,
+     prv_array_abs_s16_sse41, prv_array_abs_s32_sse41, prv_array_abs_f32_sse41},
+#endif /* LWUTIL_SIMD_MAX >= 2 */
+#if LWUTIL_SIMD_MAX >= 3
+    {prv_array_minmax_u8_avx2, prv_array_minmax_s16_avx2, prv_array_minmax_s32_avx2, prv_array_minmax_f32_avx2,
+     prv_array_clamp_u8_avx2, prv_array_clamp_s16_avx2, prv_array_clamp_s32_avx2, prv_array_clamp_f32_avx2,
+     prv_array_abs_s16_avx2, prv_array_abs_s32_avx2, prv_array_abs_f32_avx2},
+#endif /* LWUTIL_SIMD_MAX >= 3 */
+};
+
+/**
+ * \brief           Get array kernels for active SIMD level
+ * \return          Active kernels
+ */
+static inline const prv_array_kernels_t*
+prv_array_kernels_get(void) {
+    return &prv_array_kernels[lwutil_simd_get_level()];
+}
+
+/**
+ * \brief           Get minimum and maximum value of the array
+ * \param[in]       arr: Input array
+ * \param[in]       count: Number of elements in the array
+ * \param[out]      min_out: Pointer to output minimum value. Can be set to `NULL`
+ * \param[out]      max_out: Pointer to output maximum value. Can be set to `NULL`
+ * \return          `1` on success, `0` otherwise or if array is empty
+ */
+LWUTIL_API uint8_t
+lwutil_minmax_u8_array(const uint8_t* arr, size_t count, uint8_t* min_out, uint8_t* max_out) {
+    const prv_array_kernels_t* kernels;
+    uint8_t mn, mx;
+    size_t idx = 0;
+
+    if (LWUTIL_IS_NULL(arr) || count == 0) {
+        return 0;
+    }
+    mn = mx = arr[0];
+    kernels = prv_array_kernels_get();
+    if (kernels->minmax_u8 != NULL) {
+        idx = kernels->minmax_u8(arr, count, &mn, &mx);
+    }
+    for (; idx < count; ++idx) {
+        mn = arr[idx] < mn ? arr[idx] : mn;
+        mx = arr[idx] > mx ? arr[idx] : mx;
+    }
+    LWUTIL_SET_VALUE_IF_PTR_NOT_NULL(min_out, mn);
+    LWUTIL_SET_VALUE_IF_PTR_NOT_NULL(max_out, mx);
+    return 1;
+}
+
+/**
+ * \brief           Get minimum value of the array
+ * \param[in]       arr: Input array
+ * \param[in]       count: Number of elements in the array
+ * \param[out]      min_out: Pointer to output minimum value
+ * \return          `1` on success, `0` otherwise or if array is empty
+ */
+LWUTIL_API uint8_t
+lwutil_min_u8_array(const uint8_t* arr, size_t count, uint8_t* min_out) {
+    return lwutil_minmax_u8_array(arr, count, min_out, NULL);
+}
+
+/**
+ * \brief           Get maximum value of the array
+ * \param[in]       arr: Input array
+ * \param[in]       count: Number of elements in the array
+ * \param[out]      max_out: Pointer to output maximum value
+ * \return          `1` on success, `0` otherwise or if array is empty
+ */
+LWUTIL_API uint8_t
+lwutil_max_u8_array(const uint8_t* arr, size_t count, uint8_t* max_out) {
+    return lwutil_minmax_u8_array(arr, count, NULL, max_out);
+}
+
+/**
+ * \brief           Get minimum and maximum value of the array
+ * \param[in]       arr: Input array
+ * \param[in]       count: Number of elements in the array
+ * \param[out]      min_out: Pointer to output minimum value. Can be set to `NULL`
+ * \param[out]      max_out: Pointer to output maximum value. Can be set to `NULL`
+ * \return          `1` on success, `0` otherwise or if array is empty
+ */
+LWUTIL_API uint8_t
+lwutil_minmax_s16_array(const int16_t* arr, size_t count, int16_t* min_out, int16_t* max_out) {
+    const prv_array_kernels_t* kernels;
+    int16_t mn, mx;
+    size_t idx = 0;
+
+    if (LWUTIL_IS_NULL(arr) || count == 0) {
+        return 0;
+    }
+    mn = mx = arr[0];
+    kernels = prv_array_kernels_get();
+    if (kernels->minmax_s16 != NULL) {
+        idx = kernels->minmax_s16(arr, count, &mn, &mx);
+    }
+    for (; idx < count; ++idx) {
+        mn = arr[idx] < mn ? arr[idx] : mn;
+        mx = arr[idx] > mx ? arr[idx] : mx;
+    }
+    LWUTIL_SET_VALUE_IF_PTR_NOT_NULL(min_out, mn);
+    LWUTIL_SET_VALUE_IF_PTR_NOT_NULL(max_out, mx);
+    return 1;
+}
+
+/**
+ * \brief           Get minimum value of the array
+ * \param[in]       arr: Input array
+ * \param[in]       count: Number of elements in the array
+ * \param[out]      min_out: Pointer to output minimum value
+ * \return          `1` on success, `0` otherwise or if array is empty
+ */
+LWUTIL_API uint8_t
+lwutil_min_s16_array(const int16_t* arr, size_t count, int16_t* min_out) {
+    return lwutil_minmax_s16_array(arr, count, min_out, NULL);
+}
+
+/**
+ * \brief           Get maximum value of the array
+ * \param[in]       arr: Input array
+ * \param[in]       count: Number of elements in the array
+ * \param[out]      max_out: Pointer to output maximum value
+ * \return          `1` on success, `0` otherwise or if array is empty
+ */
+LWUTIL_API uint8_t
+lwutil_max_s16_array(const int16_t* arr, size_t count, int16_t* max_out) {
+    return lwutil_minmax_s16_array(arr, count, NULL, max_out);
+}
+
+/**
+ * \brief           Get minimum and maximum value of the array
+ * \param[in]       arr: Input array
+ * \param[in]       count: Number of elements in the array
+ * \param[out]      min_out: Pointer to output minimum value. Can be set to `NULL`
+ * \param[out]      max_out: Pointer to output maximum value. Can be set to `NULL`
+ * \return          `1` on success, `0` otherwise or if array is empty
+ */
+LWUTIL_API uint8_t
+lwutil_minmax_s32_array(const int32_t* arr, size_t count, int32_t* min_out, int32_t* max_out) {
+    const prv_array_kernels_t* kernels;
+    int32_t mn, mx;
+    size_t idx = 0;
+
+    if (LWUTIL_IS_NULL(arr) || count == 0) {
+        return 0;
+    }
+    mn = mx = arr[0];
+    kernels = prv_array_kernels_get();
+    if (kernels->minmax_s32 != NULL) {
+        idx = kernels->minmax_s32(arr, count, &mn, &mx);
+    }
+    for (; idx < count; ++idx) {
+        mn = arr[idx] < mn ? arr[idx] : mn;
+        mx = arr[idx] > mx ? arr[idx] : mx;
+    }
+    LWUTIL_SET_VALUE_IF_PTR_NOT_NULL(min_out, mn);
+    LWUTIL_SET_VALUE_IF_PTR_NOT_NULL(max_out, mx);
+    return 1;
+}
+
+/**
+ * \brief           Get minimum value of the array
+ * \param[in]       arr: Input array
+ * \param[in]       count: Number of elements in the array
+ * \param[out]      min_out: Pointer to output minimum value
+ * \return          `1` on success, `0` otherwise or if array is empty
+ */
+LWUTIL_API uint8_t
+lwutil_min_s32_array(const int32_t* arr, size_t count, int32_t* min_out) {
+    return lwutil_minmax_s32_array(arr, count, min_out, NULL);
+}
+
+/**
+ * \brief           Get maximum value of the array
+ * \param[in]       arr: Input array
+ * \param[in]       count: Number of elements in the array
+ * \param[out]      max_out: Pointer to output maximum value
+ * \return          `1` on success, `0` otherwise or if array is empty
+ */
+LWUTIL_API uint8_t
+lwutil_max_s32_array(const int32_t* arr, size_t count, int32_t* max_out) {
+    return lwutil_minmax_s32_array(arr, count, NULL, max_out);
+}
+
+/**
+ * \brief           Get minimum and maximum value of the array
+ *
+ * Not-a-number elements are ignored. If all elements are not-a-number,
+ * minimum is positive and maximum negative infinity.
+ *
+ * \param[in]       arr: Input array
+ * \param[in]       count: Number of elements in the array
+ * \param[out]      min_out: Pointer to output minimum value. Can be set to `NULL`
+ * \param[out]      max_out: Pointer to output maximum value. Can be set to `NULL`
+ * \return          `1` on success, `0` otherwise or if array is empty
+ */
+LWUTIL_API uint8_t
+lwutil_minmax_f32_array(const float* arr, size_t count, float* min_out, float* max_out) {
+    const prv_array_kernels_t* kernels;
+    float mn, mx;
+    size_t idx = 0;
+
+    if (LWUTIL_IS_NULL(arr) || count == 0) {
+        return 0;
+    }
+    /* Start with infinities, so that not-a-number elements are ignored */
+    mn = INFINITY;
+    mx = -INFINITY;
+    kernels = prv_array_kernels_get();
+    if (kernels->minmax_f32 != NULL) {
+        idx = kernels->minmax_f32(arr, count, &mn, &mx);
+    }
+    for (; idx < count; ++idx) {
+        mn = arr[idx] < mn ? arr[idx] : mn;
+        mx = arr[idx] > mx ? arr[idx] : mx;
+    }
+    LWUTIL_SET_VALUE_IF_PTR_NOT_NULL(min_out, mn);
+    LWUTIL_SET_VALUE_IF_PTR_NOT_NULL(max_out, mx);
+    return 1;
+}
+
+/**
+ * \brief           Get minimum value of the array
+ * \param[in]       arr: Input array
+ * \param[in]       count: Number of elements in the array
+ * \param[out]      min_out: Pointer to output minimum value
+ * \return          `1` on success, `0` otherwise or if array is empty
+ */
+LWUTIL_API uint8_t
+lwutil_min_f32_array(const float* arr, size_t count, float* min_out) {
+    return lwutil_minmax_f32_array(arr, count, min_out, NULL);
+}
+
+/**
+ * \brief           Get maximum value of the array
+ * \param[in]       arr: Input array
+ * \param[in]       count: Number of elements in the array
+ * \param[out]      max_out: Pointer to output maximum value
+ * \return          `1` on success, `0` otherwise or if array is empty
+ */
+LWUTIL_API uint8_t
+lwutil_max_f32_array(const float* arr, size_t count, float* max_out) {
+    return lwutil_minmax_f32_array(arr, count, NULL, max_out);
+}
+
+/**
+ * \brief           Constrain every element of the array within a range
+ *
+ * Result is the same as of \ref LWUTIL_CONSTRAIN macro, `hi` is used when `lo` is higher than `hi`.
+ *
+ * \param[in]       in: Input array
+ * \param[out]      out: Output array. May be equal to `in` for in-place processing
+ * \param[in]       count: Number of elements in the array
+ * \param[in]       lo: Minimum allowed value
+ * \param[in]       hi: Maximum allowed value
+ */
+LWUTIL_API void
+lwutil_clamp_u8_array(const uint8_t* in, uint8_t* out, size_t count, uint8_t lo, uint8_t hi) {
+    const prv_array_kernels_t* kernels;
+    size_t idx = 0;
+
+    if (LWUTIL_IS_NULL(in) || LWUTIL_IS_NULL(out)) {
+        return;
+    }
+    kernels = prv_array_kernels_get();
+    if (kernels->clamp_u8 != NULL) {
+        idx = kernels->clamp_u8(in, out, count, lo, hi);
+    }
+    for (; idx < count; ++idx) {
+        uint8_t val = in[idx] > lo ? in[idx] : lo;
+
+        out[idx] = val < hi ? val : hi;
+    }
+}
+
+/**
+ * \brief           Constrain every element of the array within a range
+ *
+ * Result is the same as of \ref LWUTIL_CONSTRAIN macro, `hi` is used when `lo` is higher than `hi`.
+ *
+ * \param[in]       in: Input array
+ * \param[out]      out: Output array. May be equal to `in` for in-place processing
+ * \param[in]       count: Number of elements in the array
+ * \param[in]       lo: Minimum allowed value
+ * \param[in]       hi: Maximum allowed value
+ */
+LWUTIL_API void
+lwutil_clamp_s16_array(const int16_t* in, int16_t* out, size_t count, int16_t lo, int16_t hi) {
+    const prv_array_kernels_t* kernels;
+    size_t idx = 0;
+
+    if (LWUTIL_IS_NULL(in) || LWUTIL_IS_NULL(out)) {
+        return;
+    }
+    kernels = prv_array_kernels_get();
+    if (kernels->clamp_s16 != NULL) {
+        idx = kernels->clamp_s16(in, out, count, lo, hi);
+    }
+    for (; idx < count; ++idx) {
+        int16_t val = in[idx] > lo ? in[idx] : lo;
+
+        out[idx] = val < hi ? val : hi;
+    }
+}
+
+/**
+ * \brief           Constrain every element of the array within a range
+ *
+ * Result is the same as of \ref LWUTIL_CONSTRAIN macro, `hi` is used when `lo` is higher than `hi`.
+ *
+ * \param[in]       in: Input array
+ * \param[out]      out: Output array. May be equal to `in` for in-place processing
+ * \param[in]       count: Number of elements in the array
+ * \param[in]       lo: Minimum allowed value
+ * \param[in]       hi: Maximum allowed value
+ */
+LWUTIL_API void
+lwutil_clamp_s32_array(const int32_t* in, int32_t* out, size_t count, int32_t lo, int32_t hi) {
+    const prv_array_kernels_t* kernels;
+    size_t idx = 0;
+
+    if (LWUTIL_IS_NULL(in) || LWUTIL_IS_NULL(out)) {
+        return;
+    }
+    kernels = prv_array_kernels_get();
+    if (kernels->clamp_s32 != NULL) {
+        idx = kernels->clamp_s32(in, out, count, lo, hi);
+    }
+    for (; idx < count; ++idx) {
+        int32_t val = in[idx] > lo ? in[idx] : lo;
+
+        out[idx] = val < hi ? val : hi;
+    }
+}
+
+/**
+ * \brief           Constrain every element of the array within a range
+ *
+ * Result is the same as of \ref LWUTIL_CONSTRAIN macro, `hi` is used when `lo` is higher than `hi`.
+ *
+ * Not-a-number elements are set to `lo`.
+ *
+ * \param[in]       in: Input array
+ * \param[out]      out: Output array. May be equal to `in` for in-place processing
+ * \param[in]       count: Number of elements in the array
+ * \param[in]       lo: Minimum allowed value
+ * \param[in]       hi: Maximum allowed value
+ */
+LWUTIL_API void
+lwutil_clamp_f32_array(const float* in, float* out, size_t count, float lo, float hi) {
+    const prv_array_kernels_t* kernels;
+    size_t idx = 0;
+
+    if (LWUTIL_IS_NULL(in) || LWUTIL_IS_NULL(out)) {
+        return;
+    }
+    kernels = prv_array_kernels_get();
+    if (kernels->clamp_f32 != NULL) {
+        idx = kernels->clamp_f32(in, out, count, lo, hi);
+    }
+    for (; idx < count; ++idx) {
+        float val = in[idx] > lo ? in[idx] : lo;
+
+        out[idx] = val < hi ? val : hi;
+    }
+}
+
+/**
+ * \brief           Calculate absolute value of every element of the array
+ *
+ * Output is unsigned, so that absolute value of the minimum `16-bit` value is exact.
+ *
+ * \param[in]       in: Input array
+ * \param[out]      out: Output array. May point to the same memory as `in` for in-place processing
+ * \param[in]       count: Number of elements in the array
+ */
+LWUTIL_API void
+lwutil_abs_s16_array(const int16_t* in, uint16_t* out, size_t count) {
+    const prv_array_kernels_t* kernels;
+    size_t idx = 0;
+
+    if (LWUTIL_IS_NULL(in) || LWUTIL_IS_NULL(out)) {
+        return;
+    }
+    kernels = prv_array_kernels_get();
+    if (kernels->abs_s16 != NULL) {
+        idx = kernels->abs_s16(in, out, count, (uint16_t)~(uint16_t)0);
+    }
+    for (; idx < count; ++idx) {
+        uint16_t val = (uint16_t)in[idx];
+
+        out[idx] = in[idx] < 0 ? (uint16_t)(0U - val) : val;
+    }
+}
+
+/**
+ * \brief           Calculate saturated absolute value of every element of the array
+ *
+ * Absolute value of the minimum `16-bit` value does not fit the signed type
+ * and is saturated to the maximum value.
+ *
+ * \param[in]       in: Input array
+ * \param[out]      out: Output array. May be equal to `in` for in-place processing
+ * \param[in]       count: Number of elements in the array
+ */
+LWUTIL_API void
+lwutil_abs_sat_s16_array(const int16_t* in, int16_t* out, size_t count) {
+    const prv_array_kernels_t* kernels;
+    size_t idx = 0;
+
+    if (LWUTIL_IS_NULL(in) || LWUTIL_IS_NULL(out)) {
+        return;
+    }
+    kernels = prv_array_kernels_get();
+    if (kernels->abs_s16 != NULL) {
+        idx = kernels->abs_s16(in, (uint16_t*)out, count, 0x7FFFU);
+    }
+    for (; idx < count; ++idx) {
+        uint16_t val = (uint16_t)in[idx];
+
+        val = in[idx] < 0 ? (uint16_t)(0U - val) : val;
+        out[idx] = (int16_t)(val > 0x7FFFU ? 0x7FFFU : val);
+    }
+}
+
+/**
+ * \brief           Calculate absolute value of every element of the array
+ *
+ * Output is unsigned, so that absolute value of the minimum `32-bit` value is exact.
+ *
+ * \param[in]       in: Input array
+ * \param[out]      out: Output array. May point to the same memory as `in` for in-place processing
+ * \param[in]       count: Number of elements in the array
+ */
+LWUTIL_API void
+lwutil_abs_s32_array(const int32_t* in, uint32_t* out, size_t count) {
+    const prv_array_kernels_t* kernels;
+    size_t idx = 0;
+
+    if (LWUTIL_IS_NULL(in) || LWUTIL_IS_NULL(out)) {
+        return;
+    }
+    kernels = prv_array_kernels_get();
+    if (kernels->abs_s32 != NULL) {
+        idx = kernels->abs_s32(in, out, count, (uint32_t)~(uint32_t)0);
+    }
+    for (; idx < count; ++idx) {
+        uint32_t val = (uint32_t)in[idx];
+
+        out[idx] = in[idx] < 0 ? (uint32_t)(0U - val) : val;
+    }
+}
+
+/**
+ * \brief           Calculate saturated absolute value of every element of the array
+ *
+ * Absolute value of the minimum `32-bit` value does not fit the signed type
+ * and is saturated to the maximum value.
+ *
+ * \param[in]       in: Input array
+ * \param[out]      out: Output array. May be equal to `in` for in-place processing
+ * \param[in]       count: Number of elements in the array
+ */
+LWUTIL_API void
+lwutil_abs_sat_s32_array(const int32_t* in, int32_t* out, size_t count) {
+    const prv_array_kernels_t* kernels;
+    size_t idx = 0;
+
+    if (LWUTIL_IS_NULL(in) || LWUTIL_IS_NULL(out)) {
+        return;
+    }
+    kernels = prv_array_kernels_get();
+    if (kernels->abs_s32 != NULL) {
+        idx = kernels->abs_s32(in, (uint32_t*)out, count, 0x7FFFFFFFUL);
+    }
+    for (; idx < count; ++idx) {
+        uint32_t val = (uint32_t)in[idx];
+
+        val = in[idx] < 0 ? (uint32_t)(0U - val) : val;
+        out[idx] = (int32_t)(val > 0x7FFFFFFFUL ? 0x7FFFFFFFUL : val);
+    }
+}
+
+/**
+ * \brief           Calculate absolute value of every floating-point element of the array
+ *
+ * Sign bit is cleared, not-a-number elements keep their payload.
+ *
+ * \param[in]       in: Input array
+ * \param[out]      out: Output array. May be equal to `in` for in-place processing
+ * \param[in]       count: Number of elements in the array
+ */
+LWUTIL_API void
+lwutil_abs_f32_array(const float* in, float* out, size_t count) {
+    const prv_array_kernels_t* kernels;
+    size_t idx = 0;
+
+    if (LWUTIL_IS_NULL(in) || LWUTIL_IS_NULL(out)) {
+        return;
+    }
+    kernels = prv_array_kernels_get();
+    if (kernels->abs_f32 != NULL) {
+        idx = kernels->abs_f32(in, out, count);
+    }
+    for (; idx < count; ++idx) {
+        uint32_t val;
+
+        memcpy(&val, &in[idx], sizeof(val));
+        val &= 0x7FFFFFFFUL;
+        memcpy(&out[idx], &val, sizeof(val));
+    }
+}
+
+#endif /* !LWUTIL_CFG_HEADER_ONLY || defined(LWUTIL_HEADER_ONLY_IMPL) */
@@ -0,0 +1,431 @@
+/**
+ * \file            lwutil_base64.c
+ * \brief           Base64 encoder and decoder
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwUTIL - Lightweight utility library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v1.3.0
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "lwutil/lwutil_base64.h"
+#include "lwutil/lwutil_private.h"
+
+/*
+ * In header-only mode, implementation is included by the lwutil_base64.h header,
+ * and is compiled into every translation unit as static inline functions.
+ */
+#if !LWUTIL_CFG_HEADER_ONLY || defined(LWUTIL_HEADER_ONLY_IMPL)
+
+/* Encoding alphabets, indexed by \ref lwutil_base64_alphabet_t */
+static const char prv_base64_enc[2][65] = {
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/",
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_",
+};
+
+/* Decoding tables with 6-bit value of every character, `0xFF` for characters outside of the alphabet */
+static const uint8_t prv_base64_dec_std[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF, 0xFF, 0x3F,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+static const uint8_t prv_base64_dec_url[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+#if LWUTIL_SIMD_MAX >= 3
+
+/**
+ * \brief           Encode blocks of `24` bytes to `32` characters with AVX2 instructions
+ *
+ * Every `3` bytes are spread to `4` bytes of `6-bit` indexes with shuffle and `16-bit` multiplications.
+ * Indexes are then converted to characters by adding offset of their range, selected with byte shuffle.
+ * Algorithm is described in "Faster Base64 Encoding and Decoding Using AVX2 Instructions" by W. Mula and D. Lemire.
+ *
+ * \param[in]       p: Input data
+ * \param[in]       len: Length of input data in units of bytes
+ * \param[out]      out: Output characters, minimum `len / 3 * 4` bytes long
+ * \param[in]       alphabet: Alphabet to use
+ * \return          Number of processed bytes, multiple of `24`
+ */
+LWUTIL_TARGET("avx2")
+static size_t
+prv_base64_encode_avx2(const uint8_t* p, size_t len, char* out, lwutil_base64_alphabet_t alphabet) {
+    const __m256i shuf = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10, 1, 0, 2, 1, 4, 3, 5, 4, 7,
+                                          6, 8, 7, 10, 9, 11, 10);
+    const char c62 = prv_base64_enc[alphabet][62], c63 = prv_base64_enc[alphabet][63];
+    const __m256i offsets = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        (char)(c62 - 62), (char)(c63 - 63), 'A', 0, 0));
+    size_t idx = 0;
+
+    /* Upper lane is loaded from 12 bytes ahead, 28 bytes are read per block */
+    for (; (len - idx) >= 28U; idx += 24U, out += 32U) {
+        __m256i in, t0, t1, res;
+
+        in = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)&p[idx])),
+                                     _mm_loadu_si128((const __m128i*)&p[idx + 12U]), 1);
+        in = _mm256_shuffle_epi8(in, shuf);
+        t0 = _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+        t1 = _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+        in = _mm256_or_si256(t0, t1);
+
+        /* Range index: 13 for 0-25, 0 for 26-51, 1 to 10 for 52-61, 11 and 12 for 62 and 63 */
+        res = _mm256_subs_epu8(in, _mm256_set1_epi8(51));
+        res = _mm256_or_si256(
+            res, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), in), _mm256_set1_epi8(13)));
+        _mm256_storeu_si256((__m256i*)out, _mm256_add_epi8(_mm256_shuffle_epi8(offsets, res), in));
+    }
+    return idx;
+}
+
+/**
+ * \brief           Decode blocks of `32` characters to `24` bytes with AVX2 instructions
+ *
+ * Characters are validated with two `16`-entry tables of bit masks, indexed by low and high nibble,
+ * which have no common bit only for characters of the alphabet.
+ * Values are then restored by adding offset of their range, selected by high nibble,
+ * and `6-bit` values are joined with multiply-add instructions.
+ *
+ * \param[in]       in: Input characters
+ * \param[in]       len: Number of input characters, without padding and incomplete group
+ * \param[out]      out: Output data, minimum `len / 4 * 3` bytes long
+ * \param[in]       alphabet: Alphabet to use
+ * \return          Number of processed characters, multiple of `32`.
+ *                      Processing stops before the block with invalid character
+ */
+LWUTIL_TARGET("avx2")
+static size_t
+prv_base64_decode_avx2(const char* in, size_t len, uint8_t* out, lwutil_base64_alphabet_t alphabet) {
+    const __m256i mask_2f = _mm256_set1_epi8(0x2F);
+    __m256i lut_lo, lut_hi, lut_roll, special, special_add;
+    size_t idx = 0;
+
+    if (alphabet == LWUTIL_BASE64_URL) {
+        lut_lo = _mm256_broadcastsi128_si256(_mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                                           0x13, 0x3B, 0x3B, 0x3A, 0x3B, 0x33));
+        lut_hi = _mm256_broadcastsi128_si256(_mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x20, 0x10, 0x10,
+                                                           0x10, 0x10, 0x10, 0x10, 0x10, 0x10));
+        lut_roll = _mm256_broadcastsi128_si256(_mm_setr_epi8(0, 0, 17, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, -32, 0, 0));
+
+        /* Character `_` shares high nibble with `P` to `Z`, its offset is at index 13 */
+        special = _mm256_set1_epi8(0x5F);
+        special_add = _mm256_set1_epi8(8);
+    } else {
+        lut_lo = _mm256_broadcastsi128_si256(_mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                                           0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A));
+        lut_hi = _mm256_broadcastsi128_si256(_mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10,
+                                                           0x10, 0x10, 0x10, 0x10, 0x10, 0x10));
+        lut_roll = _mm256_broadcastsi128_si256(_mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0));
+
+        /* Character `/` shares high nibble with `+`, its offset is at index 1 */
+        special = mask_2f;
+        special_add = _mm256_set1_epi8(-1);
+    }
+
+    /* Block writes 32 bytes, at least 48 characters keep the store within the output */
+    for (; (len - idx) >= 48U; idx += 32U, out += 24U) {
+        __m256i str = _mm256_loadu_si256((const __m256i*)&in[idx]), hi, lo;
+
+        /* Bit 5 of the high nibble is ignored by the shuffle, bit 7 must be cleared */
+        hi = _mm256_and_si256(_mm256_srli_epi32(str, 4), mask_2f);
+        lo = _mm256_and_si256(str, mask_2f);
+        if (!_mm256_testz_si256(_mm256_shuffle_epi8(lut_lo, lo), _mm256_shuffle_epi8(lut_hi, hi))) {
+            break;
+        }
+        hi = _mm256_add_epi8(hi, _mm256_and_si256(_mm256_cmpeq_epi8(str, special), special_add));
+        str = _mm256_add_epi8(str, _mm256_shuffle_epi8(lut_roll, hi));
+
+        /* Join 4 x 6 bits to 24 bits in every 32-bit element and pack 24 bytes to the bottom */
+        str = _mm256_maddubs_epi16(str, _mm256_set1_epi32(0x01400140));
+        str = _mm256_madd_epi16(str, _mm256_set1_epi32(0x00011000));
+        str = _mm256_shuffle_epi8(str, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1, 2, 1,
+                                                        0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+        str = _mm256_permutevar8x32_epi32(str, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+        _mm256_storeu_si256((__m256i*)out, str);
+    }
+    return idx;
+}
+
+#endif /* LWUTIL_SIMD_MAX >= 3 */
+
+/**
+ * \brief           Set of Base64 kernels for one SIMD level
+ *
+ * `NULL` kernel means look-up tables are used.
+ */
+typedef struct {
+    size_t (*encode)(const uint8_t* p, size_t len, char* out, lwutil_base64_alphabet_t alphabet);
+    size_t (*decode)(const char* in, size_t len, uint8_t* out, lwutil_base64_alphabet_t alphabet);
+} prv_base64_kernels_t;
+
+/* Kernels for every compiled SIMD level, indexed by level */
+static const prv_base64_kernels_t prv_base64_kernels[] = {
+    {NULL, NULL},
+#if LWUTIL_SIMD_MAX >= 1
+    {NULL, NULL},
+#endif /* LWUTIL_SIMD_MAX >= 1 */
+#if LWUTIL_SIMD_MAX >= 2
+    {NULL, NULL},
+#endif /* LWUTIL_SIMD_MAX >= 2 */
+#if LWUTIL_SIMD_MAX >= 3
+    {prv_base64_encode_avx2, prv_base64_decode_avx2},
+#endif /* LWUTIL_SIMD_MAX >= 3 */
+};
+
+/**
+ * \brief           Get Base64 kernels for active SIMD level
+ * \return          Active kernels
+ */
+static inline const prv_base64_kernels_t*
+prv_base64_kernels_get(void) {
+    return &prv_base64_kernels[lwutil_simd_get_level()];
+}
+
+/**
+ * \brief           Get number of Base64 characters without padding
+ * \param[in]       b64: Base64 characters
+ * \param[in]       b64_len: Number of characters in `b64`
+ * \param[in]       pad: Set to `1` if input is padded, `0` otherwise
+ * \return          Number of characters without padding.
+ *                      `(size_t)-1` if length is not valid for Base64 encoding
+ */
+static size_t
+prv_base64_body_len(const char* b64, size_t b64_len, uint8_t pad) {
+    if (pad) {
+        if ((b64_len % 4U) != 0) {
+            return (size_t)-1;
+        }
+        if (b64_len > 0 && b64[b64_len - 1U] == '=') {
+            --b64_len;
+            if (b64[b64_len - 1U] == '=') {
+                --b64_len;
+            }
+        }
+    }
+    return (b64_len % 4U) == 1U ? (size_t)-1 : b64_len;
+}
+
+/**
+ * \brief           Get length of Base64 encoded data
+ * \param[in]       len: Length of input data in units of bytes
+ * \param[in]       pad: Set to `1` to include padding, `0` otherwise
+ * \return          Number of characters, without NULL termination
+ */
+LWUTIL_API size_t
+lwutil_base64_encoded_len(size_t len, uint8_t pad) {
+    static const uint8_t rem_len[3] = {0, 2, 3};
+
+    return (len / 3U) * 4U + (pad ? ((len % 3U) != 0 ? 4U : 0) : rem_len[len % 3U]);
+}
+
+/**
+ * \brief           Get length of Base64 decoded data
+ *
+ * Length is calculated from number of characters and padding only, characters are not validated.
+ * For valid input, it is equal to the length returned by \ref lwutil_base64_decode.
+ *
+ * \param[in]       b64: Base64 characters. It does not need to be NULL-terminated
+ * \param[in]       b64_len: Number of characters in `b64`
+ * \param[in]       pad: Set to `1` if input is padded, `0` otherwise
+ * \return          Number of decoded bytes. `0` in case of an error or invalid length
+ */
+LWUTIL_API size_t
+lwutil_base64_decoded_len(const char* b64, size_t b64_len, uint8_t pad) {
+    size_t body;
+
+    if (LWUTIL_IS_NULL(b64)) {
+        return 0;
+    }
+    body = prv_base64_body_len(b64, b64_len, pad);
+    if (body == (size_t)-1) {
+        return 0;
+    }
+    return (body / 4U) * 3U + ((body % 4U) != 0 ? (body % 4U) - 1U : 0);
+}
+
+/**
+ * \brief           Encode byte array to Base64 characters
+ *
+ * Output is not NULL-terminated.
+ * Use \ref lwutil_base64_encoded_len to get the output length.
+ *
+ * \param[in]       buf: Input data to encode
+ * \param[in]       len: Number of bytes in `buf`
+ * \param[out]      out: Output array, long at least \ref lwutil_base64_encoded_len characters
+ * \param[in]       alphabet: Alphabet to use
+ * \param[in]       pad: Set to `1` to complete the last group with `=` characters, `0` otherwise
+ * \return          Number of characters written to `out`. `0` in case of an error
+ */
+LWUTIL_API size_t
+lwutil_base64_encode(const void* buf, size_t len, char* out, lwutil_base64_alphabet_t alphabet, uint8_t pad) {
+    const uint8_t* p = (const uint8_t*)buf;
+    const prv_base64_kernels_t* kernels;
+    const char* enc;
+    size_t idx = 0, o;
+
+    if (LWUTIL_IS_NULL(buf) || LWUTIL_IS_NULL(out) || (size_t)alphabet >= LWUTIL_ASZ(prv_base64_enc)) {
+        LWUTIL_STATS_ADD(LWUTIL_STATS_BASE64_ENCODE, 0, 1);
+        return 0;
+    }
+    enc = prv_base64_enc[alphabet];
+    kernels = prv_base64_kernels_get();
+    if (kernels->encode != NULL) {
+        idx = kernels->encode(p, len, out, alphabet);
+    }
+    for (o = (idx / 3U) * 4U; (len - idx) >= 3U; idx += 3U, o += 4U) {
+        uint32_t v = (uint32_t)p[idx] << 16U | (uint32_t)p[idx + 1U] << 8U | p[idx + 2U];
+
+        out[o] = enc[v >> 18U];
+        out[o + 1U] = enc[(v >> 12U) & 0x3FU];
+        out[o + 2U] = enc[(v >> 6U) & 0x3FU];
+        out[o + 3U] = enc[v & 0x3FU];
+    }
+    if (idx < len) {
+        uint32_t v = (uint32_t)p[idx] << 16U | ((idx + 1U) < len ? (uint32_t)p[idx + 1U] << 8U : 0);
+
+        out[o++] = enc[v >> 18U];
+        out[o++] = enc[(v >> 12U) & 0x3FU];
+        if ((idx + 1U) < len) {
+            out[o++] = enc[(v >> 6U) & 0x3FU];
+        } else if (pad) {
+            out[o++] = '=';
+        }
+        if (pad) {
+            out[o++] = '=';
+        }
+    }
+    LWUTIL_STATS_ADD(LWUTIL_STATS_BASE64_ENCODE, len, 0);
+    return o;
+}
+
+/**
+ * \brief           Decode Base64 characters to byte array
+ *
+ * Input is fully validated, see \ref LWUTIL_BASE64 for the rules.
+ * Content of the output array is undefined in case of an error.
+ *
+ * \param[in]       b64: Input characters. It does not need to be NULL-terminated
+ * \param[in]       b64_len: Number of characters in `b64`
+ * \param[out]      out: Output array, long at least \ref lwutil_base64_decoded_len bytes
+ * \param[in]       alphabet: Alphabet to use
+ * \param[in]       pad: Set to `1` if input must be padded, `0` if it must not have padding
+ * \return          Number of bytes written to `out`.
+ *                      `0` in case of an error, invalid length, padding or character
+ */
+LWUTIL_API size_t
+lwutil_base64_decode(const char* b64, size_t b64_len, void* out, lwutil_base64_alphabet_t alphabet, uint8_t pad) {
+    const uint8_t* dec;
+    const prv_base64_kernels_t* kernels;
+    uint8_t* p = (uint8_t*)out;
+    size_t body, full, idx = 0, o;
+    uint32_t err = 0, v;
+
+    if (LWUTIL_IS_NULL(b64) || LWUTIL_IS_NULL(out) || (size_t)alphabet >= LWUTIL_ASZ(prv_base64_enc)) {
+        LWUTIL_STATS_ADD(LWUTIL_STATS_BASE64_DECODE, 0, 1);
+        return 0;
+    }
+    body = prv_base64_body_len(b64, b64_len, pad);
+    if (body == (size_t)-1) {
+        LWUTIL_STATS_ADD(LWUTIL_STATS_BASE64_DECODE, 0, 1);
+        return 0;
+    }
+    dec = alphabet == LWUTIL_BASE64_URL ? prv_base64_dec_url : prv_base64_dec_std;
+    full = body & ~(size_t)3U;
+    kernels = prv_base64_kernels_get();
+    if (kernels->decode != NULL) {
+        idx = kernels->decode(b64, full, p, alphabet);
+    }
+
+    /* Invalid characters have top bits set, checked once at the end */
+    for (o = (idx / 4U) * 3U; idx < full; idx += 4U, o += 3U) {
+        uint32_t a = dec[(uint8_t)b64[idx]], b = dec[(uint8_t)b64[idx + 1U]];
+        uint32_t c = dec[(uint8_t)b64[idx + 2U]], d = dec[(uint8_t)b64[idx + 3U]];
+
+        err |= a | b | c | d;
+        v = a << 18U | b << 12U | c << 6U | d;
+        p[o] = (uint8_t)(v >> 16U);
+        p[o + 1U] = (uint8_t)(v >> 8U);
+        p[o + 2U] = (uint8_t)v;
+    }
+
+    /* Last incomplete group, unused bits must be zero */
+    if (idx < body) {
+        uint32_t a = dec[(uint8_t)b64[idx]], b = dec[(uint8_t)b64[idx + 1U]];
+        uint32_t c = (idx + 2U) < body ? dec[(uint8_t)b64[idx + 2U]] : 0;
+
+        err |= a | b | c;
+        v = a << 18U | b << 12U | c << 6U;
+        p[o++] = (uint8_t)(v >> 16U);
+        if ((idx + 2U) < body) {
+            p[o++] = (uint8_t)(v >> 8U);
+        }
+        if ((v & ((idx + 2U) < body ? 0xFFU : 0xFFFFU)) != 0) {
+            LWUTIL_STATS_ADD(LWUTIL_STATS_BASE64_DECODE, 0, 1);
+            return 0;
+        }
+    }
+    if ((err & 0xC0U) != 0) {
+        LWUTIL_STATS_ADD(LWUTIL_STATS_BASE64_DECODE, 0, 1);
+        return 0;
+    }
+    LWUTIL_STATS_ADD(LWUTIL_STATS_BASE64_DECODE, o, 0);
+    return o;
+}
+
+#endif /* !LWUTIL_CFG_HEADER_ONLY || defined(LWUTIL_HEADER_ONLY_IMPL) */
@@ -0,0 +1,677 @@
+/**
+ * \file            lwutil_bitmap.c
+ * \brief           Multi-word bitmap
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwUTIL - Lightweight utility library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v1.3.0
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lwutil/lwutil_bitmap.h"
+#include "lwutil/lwutil_private.h"
+
+/*
+ * In header-only mode, implementation is included by the lwutil_bitmap.h header,
+ * and is compiled into every translation unit as static inline functions.
+ */
+#if !LWUTIL_CFG_HEADER_ONLY || defined(LWUTIL_HEADER_ONLY_IMPL)
+
+/* Operations between bitmaps */
+#define PRV_BITMAP_OP_AND    0
+#define PRV_BITMAP_OP_OR     1
+#define PRV_BITMAP_OP_ANDNOT 2
+#define PRV_BITMAP_OP_XOR    3
+
+#if LWUTIL_SIMD_MAX >= 1
+
+/**
+ * \brief           Count set bits of words with SSSE3 instructions
+ * \param[in]       words: Array of words
+ * \param[in]       count: Number of words. Only multiple of `2` words is processed
+ * \param[in,out]   cnt: Number of set bits, incremented by the bits of processed words
+ * \return          Number of processed words
+ */
+LWUTIL_TARGET("ssse3")
+static size_t
+prv_bitmap_popcount_ssse3(const uint64_t* words, size_t count, size_t* cnt) {
+    const __m128i lut = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m128i low = _mm_set1_epi8(0x0F);
+    __m128i acc = _mm_setzero_si128();
+    uint64_t sum[2];
+    size_t idx = 0;
+
+    for (; (count - idx) >= 2U; idx += 2U) {
+        __m128i x = _mm_loadu_si128((const __m128i*)&words[idx]);
+        __m128i bits = _mm_add_epi8(_mm_shuffle_epi8(lut, _mm_and_si128(x, low)),
+                                    _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(x, 4), low)));
+
+        /* Sum bytes to 64-bit lanes */
+        acc = _mm_add_epi64(acc, _mm_sad_epu8(bits, _mm_setzero_si128()));
+    }
+    _mm_storeu_si128((__m128i*)sum, acc);
+    *cnt += (size_t)(sum[0] + sum[1]);
+    return idx;
+}
+
+#endif /* LWUTIL_SIMD_MAX >= 1 */
+
+#if LWUTIL_SIMD_MAX >= 2
+
+/**
+ * \brief           Skip words equal to `inv` with SSE4.1 instructions
+ * \param[in]       words: Array of words
+ * \param[in]       count: Number of words
+ * \param[in]       inv: Word value to skip
+ * \return          Index of the block of `8` words with first different word,
+ *                      or number of skipped words, multiple of `8`
+ */
+LWUTIL_TARGET("sse4.1")
+static size_t
+prv_bitmap_scan_sse41(const uint64_t* words, size_t count, uint64_t inv) {
+    const __m128i vinv = _mm_set1_epi64x((long long)inv);
+    size_t idx = 0;
+
+    for (; (count - idx) >= 8U; idx += 8U) {
+        const __m128i* p = (const __m128i*)&words[idx];
+        __m128i diff = _mm_or_si128(_mm_or_si128(_mm_xor_si128(_mm_loadu_si128(&p[0]), vinv),
+                                                 _mm_xor_si128(_mm_loadu_si128(&p[1]), vinv)),
+                                    _mm_or_si128(_mm_xor_si128(_mm_loadu_si128(&p[2]), vinv),
+                                                 _mm_xor_si128(_mm_loadu_si128(&p[3]), vinv)));
+
+        if (!_mm_testz_si128(diff, diff)) {
+            break;
+        }
+    }
+    return idx;
+}
+
+#endif /* LWUTIL_SIMD_MAX >= 2 */
+
+#if LWUTIL_SIMD_MAX >= 3
+
+/**
+ * \brief           Count set bits of words with AVX2 instructions
+ * \param[in]       words: Array of words
+ * \param[in]       count: Number of words. Only multiple of `4` words is processed
+ * \param[in,out]   cnt: Number of set bits, incremented by the bits of processed words
+ * \return          Number of processed words
+ */
+LWUTIL_TARGET("avx2")
+static size_t
+prv_bitmap_popcount_avx2(const uint64_t* words, size_t count, size_t* cnt) {
+    const __m256i lut = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, /* Low lane */
+                                         0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4  /* High lane */);
+    const __m256i low = _mm256_set1_epi8(0x0F);
+    __m256i acc = _mm256_setzero_si256();
+    uint64_t sum[2];
+    size_t idx = 0;
+
+    for (; (count - idx) >= 4U; idx += 4U) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)&words[idx]);
+        __m256i bits = _mm256_add_epi8(_mm256_shuffle_epi8(lut, _mm256_and_si256(x, low)),
+                                       _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(x, 4), low)));
+
+        /* Sum bytes to 64-bit lanes */
+        acc = _mm256_add_epi64(acc, _mm256_sad_epu8(bits, _mm256_setzero_si256()));
+    }
+    _mm_storeu_si128((__m128i*)sum, _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1)));
+    *cnt += (size_t)(sum[0] + sum[1]);
+    return idx;
+}
+
+/**
+ * \brief           Skip words equal to `inv` with AVX2 instructions
+ * \param[in]       words: Array of words
+ * \param[in]       count: Number of words
+ * \param[in]       inv: Word value to skip
+ * \return          Index of the block of `16` words with first different word,
+ *                      or number of skipped words, multiple of `16`
+ */
+LWUTIL_TARGET("avx2")
+static size_t
+prv_bitmap_scan_avx2(const uint64_t* words, size_t count, uint64_t inv) {
+    const __m256i vinv = _mm256_set1_epi64x((long long)inv);
+    size_t idx = 0;
+
+    for (; (count - idx) >= 16U; idx += 16U) {
+        const __m256i* p = (const __m256i*)&words[idx];
+        __m256i diff = _mm256_or_si256(_mm256_or_si256(_mm256_xor_si256(_mm256_loadu_si256(&p[0]), vinv),
+                                                       _mm256_xor_si256(_mm256_loadu_si256(&p[1]), vinv)),
+                                       _mm256_or_si256(_mm256_xor_si256(_mm256_loadu_si256(&p[2]), vinv),
+                                                       _mm256_xor_si256(_mm256_loadu_si256(&p[3]), vinv)));
+
+        if (!_mm256_testz_si256(diff, diff)) {
+            break;
+        }
+    }
+    return idx;
+}
+
+/**
+ * \brief           Combine two arrays of words with AVX2 instructions
+ * \param[out]      dst: Output words. May be equal to `a` or `b`
+ * \param[in]       a: First input words
+ * \param[in]       b: Second input words
+ * \param[in]       count: Number of words. Only multiple of `4` words is processed
+ * \param[in]       op: Operation, one of `PRV_BITMAP_OP_*` values
+ * \return          Number of processed words
+ */
+LWUTIL_TARGET("avx2")
+static size_t
+prv_bitmap_op_avx2(uint64_t* dst, const uint64_t* a, const uint64_t* b, size_t count, uint8_t op) {
+    size_t idx = 0;
+
+    for (; (count - idx) >= 4U; idx += 4U) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)&a[idx]);
+        __m256i y = _mm256_loadu_si256((const __m256i*)&b[idx]);
+
+        switch (op) {
+            case PRV_BITMAP_OP_AND: x = _mm256_and_si256(x, y); break;
+            case PRV_BITMAP_OP_OR: x = _mm256_or_si256(x, y); break;
+            case PRV_BITMAP_OP_ANDNOT: x = _mm256_andnot_si256(y, x); break;
+            default: x = _mm256_xor_si256(x, y); break;
+        }
+        _mm256_storeu_si256((__m256i*)&dst[idx], x);
+    }
+    return idx;
+}
+
+#endif /* LWUTIL_SIMD_MAX >= 3 */
+
+/**
+ * \brief           Set of bitmap kernels for one SIMD level
+ *
+ * `NULL` kernel means scalar code is used.
+ */
+typedef struct {
+    size_t (*popcount)(const uint64_t* words, size_t count, size_t* cnt);
+    size_t (*scan)(const uint64_t* words, size_t count, uint64_t inv);
+    size_t (*op)(uint64_t* dst, const uint64_t* a, const uint64_t* b, size_t count, uint8_t op);
+} prv_bitmap_kernels_t;
+
+/* Kernels for every compiled SIMD level, indexed by level */
+static const prv_bitmap_kernels_t prv_bitmap_kernels[] = {
+    {NULL, NULL, NULL},
+#if LWUTIL_SIMD_MAX >= 1
+    {prv_bitmap_popcount_ssse3, NULL, NULL},
+#endif /* LWUTIL_SIMD_MAX >= 1 */
+#if LWUTIL_SIMD_MAX >= 2
+    {prv_bitmap_popcount_ssse3, prv_bitmap_scan_sse41, NULL},
+#endif /* LWUTIL_SIMD_MAX >= 2 */
+#if LWUTIL_SIMD_MAX >= 3
+    {prv_bitmap_popcount_avx2, prv_bitmap_scan_avx2, prv_bitmap_op_avx2},
+#endif /* LWUTIL_SIMD_MAX >= 3 */
+};
+
+/**
+ * \brief           Get bitmap kernels for active SIMD level
+ * \return          Active kernels
+ */
+static inline const prv_bitmap_kernels_t*
+prv_bitmap_kernels_get(void) {
+    return &prv_bitmap_kernels[lwutil_simd_get_level()];
+}
+
+/**
+ * \brief           Find first word not equal to `inv`
+ * \param[in]       words: Array of words
+ * \param[in]       count: Number of words
+ * \param[in]       inv: Word value to skip
+ * \return          Index of first different word, or `count` if all words are equal to `inv`
+ */
+static size_t
+prv_bitmap_scan(const uint64_t* words, size_t count, uint64_t inv) {
+    const prv_bitmap_kernels_t* kernels = prv_bitmap_kernels_get();
+    size_t idx = 0;
+
+    if (kernels->scan != NULL) {
+        idx = kernels->scan(words, count, inv);
+    }
+    for (; idx < count && words[idx] == inv; ++idx) {}
+    return idx;
+}
+
+/**
+ * \brief           Check that bit range is within the bitmap
+ * \param[in]       bm: Bitmap
+ * \param[in]       start: First bit of the range
+ * \param[in]       count: Number of bits in the range
+ * \return          `1` if range is valid, `0` otherwise
+ */
+static inline uint8_t
+prv_bitmap_range_valid(const lwutil_bitmap_t* bm, size_t start, size_t count) {
+    return !LWUTIL_IS_NULL(bm) && start <= bm->size && count <= (bm->size - start);
+}
+
+/**
+ * \brief           Set or clear bit range
+ * \param[in]       bm: Bitmap
+ * \param[in]       start: First bit of the range
+ * \param[in]       count: Number of bits in the range
+ * \param[in]       set: Set to `1` to set bits, `0` to clear them
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+prv_bitmap_fill_range(lwutil_bitmap_t* bm, size_t start, size_t count, uint8_t set) {
+    uint64_t mask, last_mask, fill = set ? ~UINT64_C(0) : 0;
+    size_t idx, last;
+
+    if (!prv_bitmap_range_valid(bm, start, count)) {
+        return 0;
+    }
+    if (count == 0) {
+        return 1;
+    }
+    idx = start / 64U;
+    last = (start + count - 1U) / 64U;
+    mask = ~UINT64_C(0) << (start % 64U);
+    last_mask = ~UINT64_C(0) >> (63U - (start + count - 1U) % 64U);
+    if (idx == last) {
+        mask &= last_mask;
+    } else {
+        bm->words[idx] = (bm->words[idx] & ~mask) | (fill & mask);
+        for (++idx; idx < last; ++idx) {
+            bm->words[idx] = fill;
+        }
+        mask = last_mask;
+    }
+    bm->words[idx] = (bm->words[idx] & ~mask) | (fill & mask);
+    return 1;
+}
+
+/**
+ * \brief           Check bit range against the word value
+ * \param[in]       bm: Bitmap
+ * \param[in]       start: First bit of the range
+ * \param[in]       count: Number of bits in the range
+ * \param[in]       inv: `0` to check if any bit is set, all ones to check if any bit is cleared
+ * \return          `1` if any bit of the range differs from `inv`, `0` otherwise
+ */
+static uint8_t
+prv_bitmap_range_differs(const lwutil_bitmap_t* bm, size_t start, size_t count, uint64_t inv) {
+    uint64_t mask, last_mask;
+    size_t idx, last;
+
+    idx = start / 64U;
+    last = (start + count - 1U) / 64U;
+    mask = ~UINT64_C(0) << (start % 64U);
+    last_mask = ~UINT64_C(0) >> (63U - (start + count - 1U) % 64U);
+    if (idx == last) {
+        return ((bm->words[idx] ^ inv) & mask & last_mask) != 0;
+    }
+    if (((bm->words[idx] ^ inv) & mask) != 0 || ((bm->words[last] ^ inv) & last_mask) != 0) {
+        return 1;
+    }
+    ++idx;
+    return prv_bitmap_scan(&bm->words[idx], last - idx, inv) != (last - idx);
+}
+
+/**
+ * \brief           Find first bit different from the word value
+ * \param[in]       bm: Bitmap
+ * \param[in]       start: Bit to start search at
+ * \param[in]       inv: `0` to find set bit, all ones to find cleared bit
+ * \return          Bit index or \ref LWUTIL_BITMAP_NONE if not found
+ */
+static size_t
+prv_bitmap_find(const lwutil_bitmap_t* bm, size_t start, uint64_t inv) {
+    size_t idx, words, bit;
+    uint64_t val;
+
+    if (LWUTIL_IS_NULL(bm) || start >= bm->size) {
+        return LWUTIL_BITMAP_NONE;
+    }
+    words = LWUTIL_BITMAP_WORDS(bm->size);
+    idx = start / 64U;
+    val = (bm->words[idx] ^ inv) & (~UINT64_C(0) << (start % 64U));
+    if (val == 0) {
+        ++idx;
+        idx += prv_bitmap_scan(&bm->words[idx], words - idx, inv);
+        if (idx == words) {
+            return LWUTIL_BITMAP_NONE;
+        }
+        val = bm->words[idx] ^ inv;
+    }
+
+    /* Unused bits of the last word are cleared, and are found when searching for cleared bit */
+    bit = idx * 64U + prv_ctz64(val);
+    return bit < bm->size ? bit : LWUTIL_BITMAP_NONE;
+}
+
+/**
+ * \brief           Combine two bitmaps word by word
+ * \param[out]      dst: Output bitmap
+ * \param[in]       a: First input bitmap
+ * \param[in]       b: Second input bitmap
+ * \param[in]       op: Operation, one of `PRV_BITMAP_OP_*` values
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+prv_bitmap_op(lwutil_bitmap_t* dst, const lwutil_bitmap_t* a, const lwutil_bitmap_t* b, uint8_t op) {
+    const prv_bitmap_kernels_t* kernels;
+    uint64_t* d;
+    const uint64_t *x, *y;
+    size_t idx = 0, count;
+
+    if (LWUTIL_IS_NULL(dst) || LWUTIL_IS_NULL(a) || LWUTIL_IS_NULL(b) || dst->size != a->size
+        || dst->size != b->size) {
+        return 0;
+    }
+    d = dst->words;
+    x = a->words;
+    y = b->words;
+    count = LWUTIL_BITMAP_WORDS(dst->size);
+    kernels = prv_bitmap_kernels_get();
+    if (kernels->op != NULL) {
+        idx = kernels->op(d, x, y, count, op);
+    }
+    switch (op) {
+        case PRV_BITMAP_OP_AND:
+            for (; idx < count; ++idx) {
+                d[idx] = x[idx] & y[idx];
+            }
+            break;
+        case PRV_BITMAP_OP_OR:
+            for (; idx < count; ++idx) {
+                d[idx] = x[idx] | y[idx];
+            }
+            break;
+        case PRV_BITMAP_OP_ANDNOT:
+            for (; idx < count; ++idx) {
+                d[idx] = x[idx] & ~y[idx];
+            }
+            break;
+        default:
+            for (; idx < count; ++idx) {
+                d[idx] = x[idx] ^ y[idx];
+            }
+            break;
+    }
+    return 1;
+}
+
+/**
+ * \brief           Initialize bitmap and clear all bits
+ * \param[in]       bm: Bitmap to initialize
+ * \param[in]       words: Array of at least `LWUTIL_BITMAP_WORDS(size)` words
+ * \param[in]       size: Number of bits in the bitmap
+ * \return          `1` on success, `0` otherwise
+ */
+LWUTIL_API uint8_t
+lwutil_bitmap_init(lwutil_bitmap_t* bm, uint64_t* words, size_t size) {
+    if (LWUTIL_IS_NULL(bm) || (LWUTIL_IS_NULL(words) && size > 0)) {
+        return 0;
+    }
+    bm->words = words;
+    bm->size = size;
+    if (size > 0) {
+        memset(words, 0x00, LWUTIL_BITMAP_WORDS(size) * sizeof(*words));
+    }
+    return 1;
+}
+
+/**
+ * \brief           Set range of bits
+ * \param[in]       bm: Bitmap
+ * \param[in]       start: First bit of the range
+ * \param[in]       count: Number of bits in the range
+ * \return          `1` on success, `0` if range exceeds the bitmap
+ */
+LWUTIL_API uint8_t
+lwutil_bitmap_set_range(lwutil_bitmap_t* bm, size_t start, size_t count) {
+    return prv_bitmap_fill_range(bm, start, count, 1);
+}
+
+/**
+ * \brief           Clear range of bits
+ * \param[in]       bm: Bitmap
+ * \param[in]       start: First bit of the range
+ * \param[in]       count: Number of bits in the range
+ * \return          `1` on success, `0` if range exceeds the bitmap
+ */
+LWUTIL_API uint8_t
+lwutil_bitmap_clear_range(lwutil_bitmap_t* bm, size_t start, size_t count) {
+    return prv_bitmap_fill_range(bm, start, count, 0);
+}
+
+/**
+ * \brief           Check if all bits of the range are set
+ * \param[in]       bm: Bitmap
+ * \param[in]       start: First bit of the range
+ * \param[in]       count: Number of bits in the range
+ * \return          `1` if all bits are set or range is empty, `0` otherwise or if range exceeds the bitmap
+ */
+LWUTIL_API uint8_t
+lwutil_bitmap_is_set_all_range(const lwutil_bitmap_t* bm, size_t start, size_t count) {
+    if (!prv_bitmap_range_valid(bm, start, count)) {
+        return 0;
+    }
+    return count == 0 || !prv_bitmap_range_differs(bm, start, count, ~UINT64_C(0));
+}
+
+/**
+ * \brief           Check if any bit of the range is set
+ * \param[in]       bm: Bitmap
+ * \param[in]       start: First bit of the range
+ * \param[in]       count: Number of bits in the range
+ * \return          `1` if at least one bit is set, `0` otherwise or if range exceeds the bitmap
+ */
+LWUTIL_API uint8_t
+lwutil_bitmap_is_set_any_range(const lwutil_bitmap_t* bm, size_t start, size_t count) {
+    if (!prv_bitmap_range_valid(bm, start, count)) {
+        return 0;
+    }
+    return count > 0 && prv_bitmap_range_differs(bm, start, count, 0);
+}
+
+/**
+ * \brief           Find first set bit, starting at `start` bit
+ * \param[in]       bm: Bitmap
+ * \param[in]       start: Bit to start search at
+ * \return          Index of first set bit or \ref LWUTIL_BITMAP_NONE if not found
+ */
+LWUTIL_API size_t
+lwutil_bitmap_find_first_set(const lwutil_bitmap_t* bm, size_t start) {
+    return prv_bitmap_find(bm, start, 0);
+}
+
+/**
+ * \brief           Find first cleared bit, starting at `start` bit
+ * \param[in]       bm: Bitmap
+ * \param[in]       start: Bit to start search at
+ * \return          Index of first cleared bit or \ref LWUTIL_BITMAP_NONE if not found
+ */
+LWUTIL_API size_t
+lwutil_bitmap_find_first_zero(const lwutil_bitmap_t* bm, size_t start) {
+    return prv_bitmap_find(bm, start, ~UINT64_C(0));
+}
+
+/**
+ * \brief           Count set bits in the bitmap
+ * \param[in]       bm: Bitmap
+ * \return          Number of set bits
+ */
+LWUTIL_API size_t
+lwutil_bitmap_popcount(const lwutil_bitmap_t* bm) {
+    const prv_bitmap_kernels_t* kernels;
+    size_t idx = 0, count, cnt = 0;
+
+    if (LWUTIL_IS_NULL(bm)) {
+        return 0;
+    }
+    count = LWUTIL_BITMAP_WORDS(bm->size);
+    kernels = prv_bitmap_kernels_get();
+    if (kernels->popcount != NULL) {
+        idx = kernels->popcount(bm->words, count, &cnt);
+    }
+    for (; idx < count; ++idx) {
+        cnt += prv_popcount64(bm->words[idx]);
+    }
+    return cnt;
+}
+
+/**
+ * \brief           Calculate `dst = a & b`
+ * \param[out]      dst: Output bitmap. May be equal to `a` or `b`
+ * \param[in]       a: First input bitmap
+ * \param[in]       b: Second input bitmap
+ * \return          `1` on success, `0` otherwise or if bitmaps differ in size
+ */
+LWUTIL_API uint8_t
+lwutil_bitmap_and(lwutil_bitmap_t* dst, const lwutil_bitmap_t* a, const lwutil_bitmap_t* b) {
+    return prv_bitmap_op(dst, a, b, PRV_BITMAP_OP_AND);
+}
+
+/**
+ * \brief           Calculate `dst = a | b`
+ * \param[out]      dst: Output bitmap. May be equal to `a` or `b`
+ * \param[in]       a: First input bitmap
+ * \param[in]       b: Second input bitmap
+ * \return          `1` on success, `0` otherwise or if bitmaps differ in size
+ */
+LWUTIL_API uint8_t
+lwutil_bitmap_or(lwutil_bitmap_t* dst, const lwutil_bitmap_t* a, const lwutil_bitmap_t* b) {
+    return prv_bitmap_op(dst, a, b, PRV_BITMAP_OP_OR);
+}
+
+/**
+ * \brief           Calculate `dst = a & ~b`
+ * \param[out]      dst: Output bitmap. May be equal to `a` or `b`
+ * \param[in]       a: First input bitmap
+ * \param[in]       b: Second input bitmap, with bits to clear
+ * \return          `1` on success, `0` otherwise or if bitmaps differ in size
+ */
+LWUTIL_API uint8_t
+lwutil_bitmap_andnot(lwutil_bitmap_t* dst, const lwutil_bitmap_t* a, const lwutil_bitmap_t* b) {
+    return prv_bitmap_op(dst, a, b, PRV_BITMAP_OP_ANDNOT);
+}
+
+/**
+ * \brief           Calculate `dst = a ^ b`
+ * \param[out]      dst: Output bitmap. May be equal to `a` or `b`
+ * \param[in]       a: First input bitmap
+ * \param[in]       b: Second input bitmap
+ * \return          `1` on success, `0` otherwise or if bitmaps differ in size
+ */
+LWUTIL_API uint8_t
+lwutil_bitmap_xor(lwutil_bitmap_t* dst, const lwutil_bitmap_t* a, const lwutil_bitmap_t* b) {
+    return prv_bitmap_op(dst, a, b, PRV_BITMAP_OP_XOR);
+}
+
+/**
+ * \brief           Initialize iterator over set bits
+ * \note            Bitmap may only be modified at bits already returned by the iterator
+ * \param[out]      it: Iterator to initialize
+ * \param[in]       bm: Bitmap to iterate
+ * \param[in]       start: First bit to check
+ */
+LWUTIL_API void
+lwutil_bitmap_iter_init(lwutil_bitmap_iter_t* it, const lwutil_bitmap_t* bm, size_t start) {
+    if (LWUTIL_IS_NULL(it)) {
+        return;
+    }
+    it->words = NULL;
+    it->count = 0;
+    it->pos = 0;
+    it->cur = 0;
+    if (LWUTIL_IS_NULL(bm) || start >= bm->size) {
+        return;
+    }
+    it->words = bm->words;
+    it->count = LWUTIL_BITMAP_WORDS(bm->size);
+    it->pos = start / 64U + 1U;
+    it->cur = bm->words[start / 64U] & (~UINT64_C(0) << (start % 64U));
+}
+
+/**
+ * \brief           Load next non-zero word to the iterator
+ * \param[in]       it: Iterator with no remaining bits in current word
+ * \return          `1` if word was loaded, `0` if there are no more set bits
+ */
+static inline uint8_t
+prv_bitmap_iter_load(lwutil_bitmap_iter_t* it) {
+    size_t end = (it->count - it->pos) > 4U ? (it->pos + 4U) : it->count;
+
+    /* Check few words directly, longer runs of empty words are skipped with scan */
+    for (; it->pos < end && it->words[it->pos] == 0; ++it->pos) {}
+    if (it->pos == end && end < it->count) {
+        it->pos += prv_bitmap_scan(&it->words[it->pos], it->count - it->pos, 0);
+    }
+    if (it->pos >= it->count) {
+        return 0;
+    }
+    it->cur = it->words[it->pos++];
+    return 1;
+}
+
+/**
+ * \brief           Get next set bit
+ * \param[in]       it: Iterator
+ * \param[out]      idx: Pointer to output bit index
+ * \return          `1` if bit was found, `0` if there are no more set bits
+ */
+LWUTIL_API uint8_t
+lwutil_bitmap_iter_next(lwutil_bitmap_iter_t* it, size_t* idx) {
+    if (LWUTIL_IS_NULL(it) || LWUTIL_IS_NULL(idx) || (it->cur == 0 && !prv_bitmap_iter_load(it))) {
+        return 0;
+    }
+    *idx = (it->pos - 1U) * 64U + prv_ctz64(it->cur);
+    it->cur &= it->cur - 1U;
+    return 1;
+}
+
+/**
+ * \brief           Get next set bits, up to `max_count` bits
+ * \param[in]       it: Iterator
+ * \param[out]      idx: Array of at least `max_count` elements for output bit indexes
+ * \param[in]       max_count: Maximum number of bits to return
+ * \return          Number of bits written to `idx`, lower than `max_count` only when there are no more set bits
+ */
+LWUTIL_API size_t
+lwutil_bitmap_iter_next_batch(lwutil_bitmap_iter_t* it, size_t* idx, size_t max_count) {
+    size_t cnt = 0;
+
+    if (LWUTIL_IS_NULL(it) || LWUTIL_IS_NULL(idx)) {
+        return 0;
+    }
+    while (cnt < max_count && (it->cur != 0 || prv_bitmap_iter_load(it))) {
+        size_t base = (it->pos - 1U) * 64U;
+        uint64_t cur = it->cur;
+
+        for (; cur != 0 && cnt < max_count; cur &= cur - 1U) {
+            idx[cnt++] = base + prv_ctz64(cur);
+        }
+        it->cur = cur;
+    }
+    return cnt;
+}
+
+#endif /* !LWUTIL_CFG_HEADER_ONLY || defined(LWUTIL_HEADER_ONLY_IMPL) */
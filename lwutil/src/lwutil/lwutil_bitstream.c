@@ -0,0 +1,310 @@
+/**
+ * \file            lwutil_bitstream.c
+ * \brief           Bit-stream reader and writer
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwUTIL - Lightweight utility library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v1.3.0
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lwutil/lwutil_bitstream.h"
+#include "lwutil/lwutil_private.h"
+
+/*
+ * In header-only mode, implementation is included by the lwutil_bitstream.h header,
+ * and is compiled into every translation unit as static inline functions.
+ */
+#if !LWUTIL_CFG_HEADER_ONLY || defined(LWUTIL_HEADER_ONLY_IMPL)
+
+/**
+ * \brief           Initialize bit-stream reader
+ * \param[out]      rd: Bit-stream reader to initialize
+ * \param[in]       data: Array to read from
+ * \param[in]       size: Size of array in units of bytes
+ * \param[in]       order: Order of bits in the stream
+ * \return          `1` on success, `0` otherwise
+ */
+LWUTIL_API uint8_t
+lwutil_bitreader_init(lwutil_bitreader_t* rd, const void* data, size_t size, lwutil_bitorder_t order) {
+    if (LWUTIL_IS_NULL(rd) || (LWUTIL_IS_NULL(data) && size > 0)) {
+        return 0;
+    }
+    rd->data = (const uint8_t*)data;
+    rd->size = size;
+    rd->pos = 0;
+    rd->acc = 0;
+    rd->cnt = 0;
+    rd->err = 0;
+    rd->order = order;
+    return 1;
+}
+
+/**
+ * \brief           Read field of up to `64` bits
+ * \param[in]       rd: Bit-stream reader
+ * \param[in]       n: Number of bits to read, from `0` to `64`
+ * \return          Value of the field. `0` on error
+ */
+LWUTIL_API uint64_t
+lwutil_bitreader_get_bits64(lwutil_bitreader_t* rd, uint8_t n) {
+    uint64_t val;
+
+    if (LWUTIL_IS_NULL(rd) || n > 64U) {
+        return 0;
+    }
+    if (n <= 32U) {
+        return lwutil_bitreader_get_bits(rd, n);
+    }
+    if (rd->order == LWUTIL_BITORDER_MSB_FIRST) {
+        val = (uint64_t)lwutil_bitreader_get_bits(rd, n - 32U) << 32U;
+        val |= lwutil_bitreader_get_bits(rd, 32U);
+    } else {
+        val = lwutil_bitreader_get_bits(rd, 32U);
+        val |= (uint64_t)lwutil_bitreader_get_bits(rd, n - 32U) << 32U;
+    }
+    return lwutil_bitreader_ok(rd) ? val : 0;
+}
+
+/**
+ * \brief           Skip `n` bits
+ * \param[in]       rd: Bit-stream reader
+ * \param[in]       n: Number of bits to skip
+ * \return          `1` on success, `0` when less than `n` bits remain
+ */
+LWUTIL_API uint8_t
+lwutil_bitreader_skip_bits(lwutil_bitreader_t* rd, size_t n) {
+    size_t bytes;
+
+    if (LWUTIL_IS_NULL(rd)) {
+        return 0;
+    }
+    if (n <= rd->cnt) {
+        return lwutil_bitreader_consume_bits(rd, (uint8_t)n);
+    }
+
+    /* Drop the accumulator and move directly to the byte with the next bit */
+    n -= rd->cnt;
+    bytes = n / 8U;
+    if (rd->err || bytes > (rd->size - rd->pos)) {
+        return lwutil_bitreader_consume_bits(rd, 64U);
+    }
+    rd->pos += bytes;
+    rd->acc = 0;
+    rd->cnt = 0;
+    lwutil_bitreader_get_bits(rd, (uint8_t)(n % 8U));
+    return lwutil_bitreader_ok(rd);
+}
+
+/**
+ * \brief           Skip bits up to the next byte boundary
+ * \param[in]       rd: Bit-stream reader
+ * \return          `1` on success, `0` otherwise
+ */
+LWUTIL_API uint8_t
+lwutil_bitreader_align(lwutil_bitreader_t* rd) {
+    if (LWUTIL_IS_NULL(rd)) {
+        return 0;
+    }
+    return lwutil_bitreader_consume_bits(rd, rd->cnt & 0x07U);
+}
+
+/**
+ * \brief           Read array of fields with the same bit width
+ * \param[in]       rd: Bit-stream reader
+ * \param[out]      vals_out: Output array of at least `count` elements
+ * \param[in]       count: Number of fields to read
+ * \param[in]       n: Bit width of every field, from `0` to `32`
+ * \return          Number of read fields. Lower than `count` when stream ended, and error flag is set
+ */
+LWUTIL_API size_t
+lwutil_bitreader_unpack(lwutil_bitreader_t* rd, uint32_t* vals_out, size_t count, uint8_t n) {
+    size_t idx = 0;
+
+    if (LWUTIL_IS_NULL(rd) || LWUTIL_IS_NULL(vals_out) || n > 32U) {
+        return 0;
+    }
+    if (n == 0) {
+        memset(vals_out, 0x00, count * sizeof(*vals_out));
+        return count;
+    }
+    if ((rd->size - rd->pos) >= 8U) {
+        size_t bit = rd->pos * 8U - rd->cnt;
+        size_t fast = ((rd->size - 8U) * 8U + 7U - bit) / n + 1U;
+
+        /*
+         * Extract every field with its own unaligned load, at the byte of its first bit,
+         * so that fields do not depend on each other. Load covers up to 7 + 32 bits.
+         * Fast loop stops before the load would exceed the array.
+         */
+        fast = fast < count ? fast : count;
+        if (rd->order == LWUTIL_BITORDER_MSB_FIRST) {
+            for (; idx < fast; ++idx, bit += n) {
+                vals_out[idx] = (uint32_t)((lwutil_ld_u64_be(&rd->data[bit / 8U]) << (bit % 8U)) >> (64U - n));
+            }
+        } else {
+            uint64_t mask = (UINT64_C(1) << n) - 1U;
+
+            for (; idx < fast; ++idx, bit += n) {
+                vals_out[idx] = (uint32_t)((lwutil_ld_u64_le(&rd->data[bit / 8U]) >> (bit % 8U)) & mask);
+            }
+        }
+
+        /* Continue with the accumulator, at the current bit */
+        rd->pos = bit / 8U;
+        rd->acc = 0;
+        rd->cnt = 0;
+        lwutil_bitreader_get_bits(rd, (uint8_t)(bit % 8U));
+    }
+    while (idx < count) {
+        size_t fields;
+        uint64_t acc;
+
+        /* Extract all complete fields from single refill of the accumulator */
+        lwutil_bitreader_refill(rd);
+        fields = rd->cnt / n;
+        if (fields == 0) {
+            lwutil_bitreader_consume_bits(rd, 64U);
+            break;
+        }
+        if (fields > (count - idx)) {
+            fields = count - idx;
+        }
+        acc = rd->acc;
+        rd->cnt -= (uint8_t)(fields * n);
+        if (rd->order == LWUTIL_BITORDER_MSB_FIRST) {
+            for (size_t i = 0; i < fields; ++i, acc <<= n) {
+                vals_out[idx++] = (uint32_t)(acc >> (64U - n));
+            }
+        } else {
+            uint64_t mask = (UINT64_C(1) << n) - 1U;
+
+            for (size_t i = 0; i < fields; ++i, acc >>= n) {
+                vals_out[idx++] = (uint32_t)(acc & mask);
+            }
+        }
+        rd->acc = acc;
+    }
+    return idx;
+}
+
+/**
+ * \brief           Initialize bit-stream writer
+ * \param[out]      wr: Bit-stream writer to initialize
+ * \param[in]       data: Array to write to
+ * \param[in]       size: Size of array in units of bytes
+ * \param[in]       order: Order of bits in the stream
+ * \return          `1` on success, `0` otherwise
+ */
+LWUTIL_API uint8_t
+lwutil_bitwriter_init(lwutil_bitwriter_t* wr, void* data, size_t size, lwutil_bitorder_t order) {
+    if (LWUTIL_IS_NULL(wr) || (LWUTIL_IS_NULL(data) && size > 0)) {
+        return 0;
+    }
+    wr->data = (uint8_t*)data;
+    wr->size = size;
+    wr->pos = 0;
+    wr->acc = 0;
+    wr->cnt = 0;
+    wr->err = 0;
+    wr->order = order;
+    return 1;
+}
+
+/**
+ * \brief           Write field of up to `64` bits
+ * \param[in]       wr: Bit-stream writer
+ * \param[in]       val: Value to write. Bits above `n` bits are ignored
+ * \param[in]       n: Number of bits to write, from `0` to `64`
+ */
+LWUTIL_API void
+lwutil_bitwriter_put_bits64(lwutil_bitwriter_t* wr, uint64_t val, uint8_t n) {
+    if (LWUTIL_IS_NULL(wr) || n > 64U) {
+        return;
+    }
+    if (n <= 32U) {
+        lwutil_bitwriter_put_bits(wr, (uint32_t)val, n);
+    } else if (wr->order == LWUTIL_BITORDER_MSB_FIRST) {
+        lwutil_bitwriter_put_bits(wr, (uint32_t)(val >> 32U), n - 32U);
+        lwutil_bitwriter_put_bits(wr, (uint32_t)val, 32U);
+    } else {
+        lwutil_bitwriter_put_bits(wr, (uint32_t)val, 32U);
+        lwutil_bitwriter_put_bits(wr, (uint32_t)(val >> 32U), n - 32U);
+    }
+}
+
+/**
+ * \brief           Write array of fields with the same bit width
+ * \param[in]       wr: Bit-stream writer
+ * \param[in]       vals: Array of values to write. Bits above `n` bits are ignored
+ * \param[in]       count: Number of values
+ * \param[in]       n: Bit width of every field, from `0` to `32`
+ * \return          `1` on success, `0` otherwise
+ */
+LWUTIL_API uint8_t
+lwutil_bitwriter_pack(lwutil_bitwriter_t* wr, const uint32_t* vals, size_t count, uint8_t n) {
+    if (LWUTIL_IS_NULL(wr) || LWUTIL_IS_NULL(vals) || n > 32U) {
+        return 0;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        lwutil_bitwriter_put_bits(wr, vals[i], n);
+    }
+    return lwutil_bitwriter_ok(wr);
+}
+
+/**
+ * \brief           Write remaining bits, with last byte padded with `0` bits
+ *
+ * Writer can be used after the call, next field starts at the byte boundary.
+ *
+ * \param[in]       wr: Bit-stream writer
+ * \return          Number of bytes written to the array. `0` on error
+ */
+LWUTIL_API size_t
+lwutil_bitwriter_flush(lwutil_bitwriter_t* wr) {
+    if (LWUTIL_IS_NULL(wr)) {
+        return 0;
+    }
+    for (; wr->cnt > 0; wr->cnt = wr->cnt > 8U ? (uint8_t)(wr->cnt - 8U) : 0U) {
+        if (wr->pos < wr->size) {
+            wr->data[wr->pos++] = (uint8_t)(wr->order == LWUTIL_BITORDER_MSB_FIRST ? (wr->acc >> 56U) : wr->acc);
+        } else {
+            wr->err = 1;
+        }
+        if (wr->order == LWUTIL_BITORDER_MSB_FIRST) {
+            wr->acc <<= 8U;
+        } else {
+            wr->acc >>= 8U;
+        }
+    }
+    return lwutil_bitwriter_ok(wr) ? wr->pos : 0;
+}
+
+#endif /* !LWUTIL_CFG_HEADER_ONLY || defined(LWUTIL_HEADER_ONLY_IMPL) */
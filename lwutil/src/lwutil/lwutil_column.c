@@ -0,0 +1,740 @@
+/**
+ * \file            lwutil_column.c
+ * \brief           Integer column codec
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwUTIL - Lightweight utility library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v1.3.0
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lwutil/lwutil_column.h"
+#include "lwutil/lwutil_private.h"
+
+/*
+ * In header-only mode, implementation is included by the lwutil_column.h header,
+ * and is compiled into every translation unit as static inline functions.
+ */
+#if !LWUTIL_CFG_HEADER_ONLY || defined(LWUTIL_HEADER_ONLY_IMPL)
+
+#define PRV_COLUMN_ROWS  (LWUTIL_COLUMN_BLOCK / 4U) /* Number of rows of 4 values in full block */
+#define PRV_COLUMN_FLAGS ((uint32_t)LWUTIL_COLUMN_DELTA | (uint32_t)LWUTIL_COLUMN_ZIGZAG)
+#define PRV_COLUMN_U64   0x8000U /* Descriptor bit for 64-bit values */
+
+/**
+ * \brief           Decoded block header
+ */
+typedef struct {
+    size_t cnt;      /*!< Number of values */
+    size_t len;      /*!< Length of header and packed values in units of bytes */
+    size_t hdr_len;  /*!< Length of header in units of bytes */
+    uint64_t ref;    /*!< Reference value */
+    uint64_t prev;   /*!< Value before the first one */
+    uint32_t width;  /*!< Bit width of packed values */
+    uint8_t flags;   /*!< Transform flags */
+    uint8_t is64;    /*!< Set to `1` for `64-bit` values */
+} prv_column_block_t;
+
+/**
+ * \brief           Get length of packed values
+ * \param[in]       cnt: Number of values
+ * \param[in]       width: Bit width
+ * \return          Length in units of bytes, multiple of `16`
+ */
+static size_t
+prv_column_payload_len(size_t cnt, uint32_t width) {
+    return 16U * (((cnt + 3U) / 4U * width + 31U) / 32U);
+}
+
+/**
+ * \brief           Pack values to `4` interleaved lanes
+ * \param[in]       in: Values, `4 * rows` of them, each lower than `2^width`
+ * \param[out]      out: Output array, `16` bytes for every `32` bits of lane
+ * \param[in]       rows: Number of rows of `4` values
+ * \param[in]       width: Bit width, from `1` to `64`
+ */
+static void
+prv_column_pack(const uint64_t* in, uint8_t* out, size_t rows, uint32_t width) {
+    memset(out, 0x00, prv_column_payload_len(rows * 4U, width));
+    for (size_t lane = 0; lane < 4U; ++lane) {
+        for (size_t row = 0; row < rows; ++row) {
+            uint64_t val = in[row * 4U + lane];
+            size_t bit = row * width;
+
+            for (uint32_t got = 0, s = (uint32_t)(bit % 32U), w = (uint32_t)(bit / 32U); got < width;
+                 got += 32U - s, s = 0, ++w) {
+                uint8_t* p = &out[(w * 4U + lane) * 4U];
+
+                lwutil_st_u32_le(lwutil_ld_u32_le(p) | (uint32_t)((val >> got) << s), p);
+            }
+        }
+    }
+}
+
+/**
+ * \brief           Unpack values from `4` interleaved lanes
+ * \param[in]       in: Packed values
+ * \param[out]      out: Output values, `4 * rows` of them
+ * \param[in]       rows: Number of rows of `4` values
+ * \param[in]       width: Bit width, from `1` to `64`
+ */
+static void
+prv_column_unpack(const uint8_t* in, uint64_t* out, size_t rows, uint32_t width) {
+    uint64_t mask = width >= 64U ? UINT64_MAX : ((UINT64_C(1) << width) - 1U);
+
+    for (size_t lane = 0; lane < 4U; ++lane) {
+        for (size_t row = 0; row < rows; ++row) {
+            uint64_t val = 0;
+            size_t bit = row * width;
+
+            for (uint32_t got = 0, s = (uint32_t)(bit % 32U), w = (uint32_t)(bit / 32U); got < width;
+                 got += 32U - s, s = 0, ++w) {
+                val |= (uint64_t)(lwutil_ld_u32_le(&in[(w * 4U + lane) * 4U]) >> s) << got;
+            }
+            out[row * 4U + lane] = val & mask;
+        }
+    }
+}
+
+/**
+ * \brief           Apply inverse transforms to decoded `32-bit` values
+ * \param[in,out]   vals: Values, reduced by reference value
+ * \param[in]       cnt: Number of values
+ * \param[in]       ref: Reference value
+ * \param[in]       prev: Value before the first one
+ * \param[in]       flags: Transform flags
+ */
+static void
+prv_column_finish_u32(uint32_t* vals, size_t cnt, uint32_t ref, uint32_t prev, uint8_t flags) {
+    for (size_t i = 0; i < cnt; ++i) {
+        uint32_t val = vals[i] + ref;
+
+        if (flags & LWUTIL_COLUMN_ZIGZAG) {
+            val = (val >> 1U) ^ (0U - (val & 0x01U));
+        }
+        if (flags & LWUTIL_COLUMN_DELTA) {
+            val += prev;
+            prev = val;
+        }
+        vals[i] = val;
+    }
+}
+
+/**
+ * \brief           Apply inverse transforms to decoded `64-bit` values
+ * \param[in,out]   vals: Values, reduced by reference value
+ * \param[in]       cnt: Number of values
+ * \param[in]       ref: Reference value
+ * \param[in]       prev: Value before the first one
+ * \param[in]       flags: Transform flags
+ */
+static void
+prv_column_finish_u64(uint64_t* vals, size_t cnt, uint64_t ref, uint64_t prev, uint8_t flags) {
+    for (size_t i = 0; i < cnt; ++i) {
+        uint64_t val = vals[i] + ref;
+
+        if (flags & LWUTIL_COLUMN_ZIGZAG) {
+            val = (val >> 1U) ^ (0U - (val & 0x01U));
+        }
+        if (flags & LWUTIL_COLUMN_DELTA) {
+            val += prev;
+            prev = val;
+        }
+        vals[i] = val;
+    }
+}
+
+#if LWUTIL_SIMD_MAX >= 1
+
+/* Pack row `i` of 4 values into the accumulator, store it when `32-bit` word is complete */
+#define PRV_COLUMN_PACK_ROW(i)                                                                                         \
+    do {                                                                                                               \
+        const uint32_t bit = (i) * w, s = bit % 32U;                                                                   \
+        const __m128i v = _mm_loadu_si128(&in[(i)]);                                                                   \
+        acc = _mm_or_si128(acc, _mm_sll_epi32(v, _mm_cvtsi32_si128((int)s)));                                          \
+        if (s + w >= 32U) {                                                                                            \
+            _mm_storeu_si128(&out[bit / 32U], acc);                                                                    \
+            acc = s + w > 32U ? _mm_srl_epi32(v, _mm_cvtsi32_si128((int)(32U - s))) : _mm_setzero_si128();             \
+        }                                                                                                              \
+    } while (0)
+
+/* Unpack row `i` of 4 values, from one or two `32-bit` words */
+#define PRV_COLUMN_UNPACK_ROW(i)                                                                                       \
+    do {                                                                                                               \
+        const uint32_t bit = (i) * w, s = bit % 32U;                                                                   \
+        __m128i v = _mm_srl_epi32(_mm_loadu_si128(&in[bit / 32U]), _mm_cvtsi32_si128((int)s));                         \
+        if (s + w > 32U) {                                                                                             \
+            const __m128i hi = _mm_loadu_si128(&in[bit / 32U + 1U]);                                                   \
+            v = _mm_or_si128(v, _mm_sll_epi32(hi, _mm_cvtsi32_si128((int)(32U - s))));                                 \
+        }                                                                                                              \
+        _mm_storeu_si128(&out[(i)], _mm_and_si128(v, mask));                                                           \
+    } while (0)
+
+/* All 32 rows of full block */
+#define PRV_COLUMN_ROWS_32(row)                                                                                        \
+    row(0);                                                                                                            \
+    row(1);                                                                                                            \
+    row(2);                                                                                                            \
+    row(3);                                                                                                            \
+    row(4);                                                                                                            \
+    row(5);                                                                                                            \
+    row(6);                                                                                                            \
+    row(7);                                                                                                            \
+    row(8);                                                                                                            \
+    row(9);                                                                                                            \
+    row(10);                                                                                                           \
+    row(11);                                                                                                           \
+    row(12);                                                                                                           \
+    row(13);                                                                                                           \
+    row(14);                                                                                                           \
+    row(15);                                                                                                           \
+    row(16);                                                                                                           \
+    row(17);                                                                                                           \
+    row(18);                                                                                                           \
+    row(19);                                                                                                           \
+    row(20);                                                                                                           \
+    row(21);                                                                                                           \
+    row(22);                                                                                                           \
+    row(23);                                                                                                           \
+    row(24);                                                                                                           \
+    row(25);                                                                                                           \
+    row(26);                                                                                                           \
+    row(27);                                                                                                           \
+    row(28);                                                                                                           \
+    row(29);                                                                                                           \
+    row(30);                                                                                                           \
+    row(31)
+
+/* Call `fn` with constant width, so that every shift count and branch is resolved at compile time */
+#define PRV_COLUMN_SWITCH(width, fn)                                                                                   \
+    switch (width) {                                                                                                   \
+        case 1: fn(in, out, 1U); break;                                                                                \
+        case 2: fn(in, out, 2U); break;                                                                                \
+        case 3: fn(in, out, 3U); break;                                                                                \
+        case 4: fn(in, out, 4U); break;                                                                                \
+        case 5: fn(in, out, 5U); break;                                                                                \
+        case 6: fn(in, out, 6U); break;                                                                                \
+        case 7: fn(in, out, 7U); break;                                                                                \
+        case 8: fn(in, out, 8U); break;                                                                                \
+        case 9: fn(in, out, 9U); break;                                                                                \
+        case 10: fn(in, out, 10U); break;                                                                              \
+        case 11: fn(in, out, 11U); break;                                                                              \
+        case 12: fn(in, out, 12U); break;                                                                              \
+        case 13: fn(in, out, 13U); break;                                                                              \
+        case 14: fn(in, out, 14U); break;                                                                              \
+        case 15: fn(in, out, 15U); break;                                                                              \
+        case 16: fn(in, out, 16U); break;                                                                              \
+        case 17: fn(in, out, 17U); break;                                                                              \
+        case 18: fn(in, out, 18U); break;                                                                              \
+        case 19: fn(in, out, 19U); break;                                                                              \
+        case 20: fn(in, out, 20U); break;                                                                              \
+        case 21: fn(in, out, 21U); break;                                                                              \
+        case 22: fn(in, out, 22U); break;                                                                              \
+        case 23: fn(in, out, 23U); break;                                                                              \
+        case 24: fn(in, out, 24U); break;                                                                              \
+        case 25: fn(in, out, 25U); break;                                                                              \
+        case 26: fn(in, out, 26U); break;                                                                              \
+        case 27: fn(in, out, 27U); break;                                                                              \
+        case 28: fn(in, out, 28U); break;                                                                              \
+        case 29: fn(in, out, 29U); break;                                                                              \
+        case 30: fn(in, out, 30U); break;                                                                              \
+        case 31: fn(in, out, 31U); break;                                                                              \
+        default: fn(in, out, 32U); break;                                                                              \
+    }
+
+/**
+ * \brief           Pack full block of values with constant width
+ * \param[in]       in: `32` rows of `4` values
+ * \param[out]      out: `width` words of `128-bit`
+ * \param[in]       w: Bit width, from `1` to `32`
+ */
+LWUTIL_TARGET("ssse3")
+static LWUTIL_FORCE_INLINE void
+prv_column_pack_w_sse(const __m128i* in, __m128i* out, const uint32_t w) {
+    __m128i acc = _mm_setzero_si128();
+
+    PRV_COLUMN_ROWS_32(PRV_COLUMN_PACK_ROW);
+}
+
+/**
+ * \brief           Unpack full block of values with constant width
+ * \param[in]       in: `width` words of `128-bit`
+ * \param[out]      out: `32` rows of `4` values
+ * \param[in]       w: Bit width, from `1` to `32`
+ */
+LWUTIL_TARGET("ssse3")
+static LWUTIL_FORCE_INLINE void
+prv_column_unpack_w_sse(const __m128i* in, __m128i* out, const uint32_t w) {
+    const __m128i mask = _mm_set1_epi32((int)(w >= 32U ? UINT32_MAX : ((1UL << w) - 1U)));
+
+    PRV_COLUMN_ROWS_32(PRV_COLUMN_UNPACK_ROW);
+}
+
+/**
+ * \brief           Pack full block of `32-bit` values with SSSE3 instructions
+ * \param[in]       vals: Values, \ref LWUTIL_COLUMN_BLOCK of them
+ * \param[out]      p: Output array, `16 * width` bytes long
+ * \param[in]       width: Bit width, from `1` to `32`
+ */
+LWUTIL_TARGET("ssse3")
+static void
+prv_column_pack_sse(const uint32_t* vals, uint8_t* p, uint32_t width) {
+    const __m128i* in = (const __m128i*)vals;
+    __m128i* out = (__m128i*)p;
+
+    PRV_COLUMN_SWITCH(width, prv_column_pack_w_sse);
+}
+
+/**
+ * \brief           Unpack full block of `32-bit` values with SSSE3 instructions
+ * \param[in]       p: Packed values, `16 * width` bytes
+ * \param[out]      vals: Output values, \ref LWUTIL_COLUMN_BLOCK of them
+ * \param[in]       width: Bit width, from `1` to `32`
+ */
+LWUTIL_TARGET("ssse3")
+static void
+prv_column_unpack_sse(const uint8_t* p, uint32_t* vals, uint32_t width) {
+    const __m128i* in = (const __m128i*)p;
+    __m128i* out = (__m128i*)vals;
+
+    PRV_COLUMN_SWITCH(width, prv_column_unpack_w_sse);
+}
+
+/**
+ * \brief           Apply inverse transforms to full block of `32-bit` values with constant flags
+ * \param[in,out]   v: `32` rows of `4` values, reduced by reference value
+ * \param[in]       ref: Reference value
+ * \param[in]       prev: Value before the first one
+ * \param[in]       flags: Transform flags
+ */
+LWUTIL_TARGET("ssse3")
+static LWUTIL_FORCE_INLINE void
+prv_column_finish_f_sse(__m128i* v, uint32_t ref, uint32_t prev, const uint8_t flags) {
+    const __m128i vref = _mm_set1_epi32((int)ref), one = _mm_set1_epi32(1);
+    __m128i carry = _mm_set1_epi32((int)prev);
+
+    for (size_t i = 0; i < PRV_COLUMN_ROWS; ++i) {
+        __m128i x = _mm_add_epi32(_mm_loadu_si128(&v[i]), vref);
+
+        if (flags & LWUTIL_COLUMN_ZIGZAG) {
+            x = _mm_xor_si128(_mm_srli_epi32(x, 1), _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(x, one)));
+        }
+        if (flags & LWUTIL_COLUMN_DELTA) {
+            x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+            x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+            x = _mm_add_epi32(x, carry);
+            carry = _mm_shuffle_epi32(x, 0xFF);
+        }
+        _mm_storeu_si128(&v[i], x);
+    }
+}
+
+/**
+ * \brief           Apply inverse transforms to full block of `32-bit` values with SSSE3 instructions
+ *
+ * Row of `4` consecutive values is summed with two shifted additions,
+ * and the last sum is carried to the next row.
+ *
+ * \param[in,out]   vals: Values, \ref LWUTIL_COLUMN_BLOCK of them, reduced by reference value
+ * \param[in]       ref: Reference value
+ * \param[in]       prev: Value before the first one
+ * \param[in]       flags: Transform flags
+ */
+LWUTIL_TARGET("ssse3")
+static void
+prv_column_finish_sse(uint32_t* vals, uint32_t ref, uint32_t prev, uint8_t flags) {
+    __m128i* v = (__m128i*)vals;
+
+    switch (flags) {
+        case 0: prv_column_finish_f_sse(v, ref, prev, 0); break;
+        case LWUTIL_COLUMN_DELTA: prv_column_finish_f_sse(v, ref, prev, LWUTIL_COLUMN_DELTA); break;
+        case LWUTIL_COLUMN_ZIGZAG: prv_column_finish_f_sse(v, ref, prev, LWUTIL_COLUMN_ZIGZAG); break;
+        default: prv_column_finish_f_sse(v, ref, prev, LWUTIL_COLUMN_DELTA | LWUTIL_COLUMN_ZIGZAG); break;
+    }
+}
+
+#endif /* LWUTIL_SIMD_MAX >= 1 */
+
+/**
+ * \brief           Set of column kernels for one SIMD level, for full blocks of `32-bit` values
+ *
+ * `NULL` kernel means generic code is used.
+ */
+typedef struct {
+    void (*pack)(const uint32_t* vals, uint8_t* p, uint32_t width);
+    void (*unpack)(const uint8_t* p, uint32_t* vals, uint32_t width);
+    void (*finish)(uint32_t* vals, uint32_t ref, uint32_t prev, uint8_t flags);
+} prv_column_kernels_t;
+
+/* Kernels for every compiled SIMD level, indexed by level. Layout is fixed to 128-bit rows */
+static const prv_column_kernels_t prv_column_kernels[] = {
+    {NULL, NULL, NULL},
+#if LWUTIL_SIMD_MAX >= 1
+    {prv_column_pack_sse, prv_column_unpack_sse, prv_column_finish_sse},
+#endif /* LWUTIL_SIMD_MAX >= 1 */
+#if LWUTIL_SIMD_MAX >= 2
+    {prv_column_pack_sse, prv_column_unpack_sse, prv_column_finish_sse},
+#endif /* LWUTIL_SIMD_MAX >= 2 */
+#if LWUTIL_SIMD_MAX >= 3
+    {prv_column_pack_sse, prv_column_unpack_sse, prv_column_finish_sse},
+#endif /* LWUTIL_SIMD_MAX >= 3 */
+};
+
+/**
+ * \brief           Get column kernels for active SIMD level
+ * \return          Active kernels
+ */
+static inline const prv_column_kernels_t*
+prv_column_kernels_get(void) {
+    return &prv_column_kernels[lwutil_simd_get_level()];
+}
+
+/**
+ * \brief           Encode single block
+ * \param[in,out]   t: Values of the block, \ref LWUTIL_COLUMN_BLOCK entries. Modified by the function
+ * \param[in]       cnt: Number of values, from `1` to \ref LWUTIL_COLUMN_BLOCK
+ * \param[in]       flags: Transform flags
+ * \param[in]       is64: Set to `1` for `64-bit` values
+ * \param[out]      out: Output array
+ * \param[in]       out_size: Size of output array
+ * \return          Number of bytes written, `0` if output array is too short
+ */
+static size_t
+prv_column_enc_block(uint64_t* t, size_t cnt, uint8_t flags, uint8_t is64, uint8_t* out, size_t out_size) {
+    const prv_column_kernels_t* kernels = prv_column_kernels_get();
+    const uint64_t mask = is64 ? UINT64_MAX : UINT32_MAX;
+    const uint32_t sign = is64 ? 63U : 31U;
+    uint64_t min = mask, max = 0, prev, start;
+    size_t rows = (cnt + 3U) / 4U, word = is64 ? 8U : 4U, hdr_len, payload_len;
+    uint32_t width;
+
+    /*
+     * Value before the first one is extrapolated from the first two,
+     * so that constant interval gives equal differences, including the first one
+     */
+    prev = start = cnt > 1U ? ((t[0] << 1U) - t[1]) & mask : t[0];
+
+    /* Forward transforms, with wrap-around at the value width */
+    for (size_t i = 0; i < cnt; ++i) {
+        uint64_t val = t[i];
+
+        if (flags & LWUTIL_COLUMN_DELTA) {
+            val = (val - prev) & mask;
+            prev = t[i];
+        }
+        if (flags & LWUTIL_COLUMN_ZIGZAG) {
+            val = ((val << 1U) ^ (0U - (val >> sign))) & mask;
+        }
+        t[i] = val;
+        min = val < min ? val : min;
+        max = val > max ? val : max;
+    }
+    width = max > min ? prv_msb64(max - min) + 1U : 0;
+    for (size_t i = 0; i < rows * 4U; ++i) {
+        t[i] = i < cnt ? t[i] - min : 0;
+    }
+
+    hdr_len = 4U + word * ((flags & LWUTIL_COLUMN_DELTA) ? 2U : 1U);
+    payload_len = prv_column_payload_len(cnt, width);
+    if (hdr_len + payload_len > out_size) {
+        return 0;
+    }
+    lwutil_st_u16_le((uint16_t)cnt, &out[0]);
+    lwutil_st_u16_le((uint16_t)(width | ((uint32_t)flags << 8U) | (is64 ? PRV_COLUMN_U64 : 0)), &out[2]);
+    if (is64) {
+        lwutil_st_u64_le(min, &out[4]);
+    } else {
+        lwutil_st_u32_le((uint32_t)min, &out[4]);
+    }
+    if (flags & LWUTIL_COLUMN_DELTA) {
+        if (is64) {
+            lwutil_st_u64_le(start, &out[4U + word]);
+        } else {
+            lwutil_st_u32_le((uint32_t)start, &out[4U + word]);
+        }
+    }
+
+    out += hdr_len;
+    if (width == 0) {
+        /* All values equal to reference value */
+    } else if (cnt == LWUTIL_COLUMN_BLOCK && width <= 32U && kernels->pack != NULL) {
+        uint32_t t32[LWUTIL_COLUMN_BLOCK];
+
+        for (size_t i = 0; i < LWUTIL_COLUMN_BLOCK; ++i) {
+            t32[i] = (uint32_t)t[i];
+        }
+        kernels->pack(t32, out, width);
+    } else {
+        prv_column_pack(t, out, rows, width);
+    }
+    return hdr_len + payload_len;
+}
+
+/**
+ * \brief           Parse and check block header
+ * \param[in]       p: Block data
+ * \param[in]       len: Length of remaining data
+ * \param[out]      blk: Decoded header
+ * \return          `1` if header is valid and complete block is available, `0` otherwise
+ */
+static uint8_t
+prv_column_parse(const uint8_t* p, size_t len, prv_column_block_t* blk) {
+    uint32_t desc;
+    size_t word;
+
+    if (len < 4U) {
+        return 0;
+    }
+    blk->cnt = lwutil_ld_u16_le(&p[0]);
+    desc = lwutil_ld_u16_le(&p[2]);
+    blk->width = desc & 0x7FU;
+    blk->flags = (uint8_t)((desc >> 8U) & 0x7FU);
+    blk->is64 = (desc & PRV_COLUMN_U64) != 0;
+    if (blk->cnt == 0 || blk->cnt > LWUTIL_COLUMN_BLOCK || (desc & 0x80U) != 0 || (blk->flags & ~PRV_COLUMN_FLAGS) != 0
+        || blk->width > (blk->is64 ? 64U : 32U)) {
+        return 0;
+    }
+    word = blk->is64 ? 8U : 4U;
+    blk->hdr_len = 4U + word * ((blk->flags & LWUTIL_COLUMN_DELTA) ? 2U : 1U);
+    blk->len = blk->hdr_len + prv_column_payload_len(blk->cnt, blk->width);
+    if (blk->len > len) {
+        return 0;
+    }
+    blk->ref = blk->is64 ? lwutil_ld_u64_le(&p[4]) : lwutil_ld_u32_le(&p[4]);
+    blk->prev = 0;
+    if (blk->flags & LWUTIL_COLUMN_DELTA) {
+        blk->prev = blk->is64 ? lwutil_ld_u64_le(&p[4U + word]) : lwutil_ld_u32_le(&p[4U + word]);
+    }
+    return 1;
+}
+
+/**
+ * \brief           Get maximal encoded length of `32-bit` values
+ * \param[in]       count: Number of values
+ * \return          Maximal length in units of bytes
+ */
+LWUTIL_API size_t
+lwutil_column_bound_u32(size_t count) {
+    return (count + LWUTIL_COLUMN_BLOCK - 1U) / LWUTIL_COLUMN_BLOCK * 12U + (count + 3U) / 4U * 16U;
+}
+
+/**
+ * \brief           Get maximal encoded length of `64-bit` values
+ * \param[in]       count: Number of values
+ * \return          Maximal length in units of bytes
+ */
+LWUTIL_API size_t
+lwutil_column_bound_u64(size_t count) {
+    return (count + LWUTIL_COLUMN_BLOCK - 1U) / LWUTIL_COLUMN_BLOCK * 20U + (count + 3U) / 4U * 32U;
+}
+
+/**
+ * \brief           Encode array of `32-bit` values
+ * \param[in]       vals: Values to encode
+ * \param[in]       count: Number of values
+ * \param[in]       flags: Transform flags, combination of \ref lwutil_column_flag_t values, or `0`
+ * \param[out]      out: Output array, \ref lwutil_column_bound_u32 bytes always suffice
+ * \param[in]       out_size: Size of output array in units of bytes
+ * \return          Number of bytes written. `0` in case of an error or if output array is too short
+ */
+LWUTIL_API size_t
+lwutil_column_enc_u32(const uint32_t* vals, size_t count, uint8_t flags, void* out, size_t out_size) {
+    uint64_t t[LWUTIL_COLUMN_BLOCK];
+    size_t pos = 0;
+
+    if (LWUTIL_IS_NULL(vals) || LWUTIL_IS_NULL(out) || (flags & ~PRV_COLUMN_FLAGS) != 0) {
+        return 0;
+    }
+    for (size_t idx = 0; idx < count;) {
+        size_t cnt = (count - idx) < LWUTIL_COLUMN_BLOCK ? (count - idx) : LWUTIL_COLUMN_BLOCK, len;
+
+        for (size_t i = 0; i < cnt; ++i) {
+            t[i] = vals[idx + i];
+        }
+        len = prv_column_enc_block(t, cnt, flags, 0, &((uint8_t*)out)[pos], out_size - pos);
+        if (len == 0) {
+            return 0;
+        }
+        pos += len;
+        idx += cnt;
+    }
+    return pos;
+}
+
+/**
+ * \brief           Encode array of `64-bit` values
+ * \param[in]       vals: Values to encode
+ * \param[in]       count: Number of values
+ * \param[in]       flags: Transform flags, combination of \ref lwutil_column_flag_t values, or `0`
+ * \param[out]      out: Output array, \ref lwutil_column_bound_u64 bytes always suffice
+ * \param[in]       out_size: Size of output array in units of bytes
+ * \return          Number of bytes written. `0` in case of an error or if output array is too short
+ */
+LWUTIL_API size_t
+lwutil_column_enc_u64(const uint64_t* vals, size_t count, uint8_t flags, void* out, size_t out_size) {
+    uint64_t t[LWUTIL_COLUMN_BLOCK];
+    size_t pos = 0;
+
+    if (LWUTIL_IS_NULL(vals) || LWUTIL_IS_NULL(out) || (flags & ~PRV_COLUMN_FLAGS) != 0) {
+        return 0;
+    }
+    for (size_t idx = 0; idx < count;) {
+        size_t cnt = (count - idx) < LWUTIL_COLUMN_BLOCK ? (count - idx) : LWUTIL_COLUMN_BLOCK, len;
+
+        memcpy(t, &vals[idx], cnt * sizeof(*t));
+        len = prv_column_enc_block(t, cnt, flags, 1, &((uint8_t*)out)[pos], out_size - pos);
+        if (len == 0) {
+            return 0;
+        }
+        pos += len;
+        idx += cnt;
+    }
+    return pos;
+}
+
+/**
+ * \brief           Get number of values in encoded data, from block headers
+ * \param[in]       data: Encoded data
+ * \param[in]       len: Length of encoded data in units of bytes
+ * \return          Number of values. `0` if data is empty or malformed
+ */
+LWUTIL_API size_t
+lwutil_column_count(const void* data, size_t len) {
+    const uint8_t* p = (const uint8_t*)data;
+    prv_column_block_t blk;
+    size_t count = 0;
+
+    if (LWUTIL_IS_NULL(data)) {
+        return 0;
+    }
+    for (size_t pos = 0; pos < len; pos += blk.len) {
+        if (!prv_column_parse(&p[pos], len - pos, &blk)) {
+            return 0;
+        }
+        count += blk.cnt;
+    }
+    return count;
+}
+
+/**
+ * \brief           Decode `32-bit` values
+ * \param[in]       data: Encoded data, complete blocks of `32-bit` values
+ * \param[in]       len: Length of encoded data in units of bytes
+ * \param[out]      vals_out: Output array for decoded values
+ * \param[in]       vals_max: Size of output array in units of values. Use \ref lwutil_column_count
+ * \return          Number of decoded values. `0` if data is empty or malformed, or output array is too short
+ */
+LWUTIL_API size_t
+lwutil_column_dec_u32(const void* data, size_t len, uint32_t* vals_out, size_t vals_max) {
+    const prv_column_kernels_t* kernels = prv_column_kernels_get();
+    const uint8_t* p = (const uint8_t*)data;
+    prv_column_block_t blk;
+    size_t count = 0;
+
+    if (LWUTIL_IS_NULL(data) || LWUTIL_IS_NULL(vals_out)) {
+        return 0;
+    }
+    for (size_t pos = 0; pos < len; pos += blk.len) {
+        uint32_t* out = &vals_out[count];
+
+        if (!prv_column_parse(&p[pos], len - pos, &blk) || blk.is64 || blk.cnt > (vals_max - count)) {
+            return 0;
+        }
+        if (blk.cnt == LWUTIL_COLUMN_BLOCK && kernels->unpack != NULL) {
+            if (blk.width > 0) {
+                kernels->unpack(&p[pos + blk.hdr_len], out, blk.width);
+            } else {
+                memset(out, 0x00, LWUTIL_COLUMN_BLOCK * sizeof(*out));
+            }
+            kernels->finish(out, (uint32_t)blk.ref, (uint32_t)blk.prev, blk.flags);
+        } else {
+            uint64_t t[LWUTIL_COLUMN_BLOCK];
+
+            if (blk.width > 0) {
+                prv_column_unpack(&p[pos + blk.hdr_len], t, (blk.cnt + 3U) / 4U, blk.width);
+            } else {
+                memset(t, 0x00, blk.cnt * sizeof(*t));
+            }
+            for (size_t i = 0; i < blk.cnt; ++i) {
+                out[i] = (uint32_t)t[i];
+            }
+            prv_column_finish_u32(out, blk.cnt, (uint32_t)blk.ref, (uint32_t)blk.prev, blk.flags);
+        }
+        count += blk.cnt;
+    }
+    return count;
+}
+
+/**
+ * \brief           Decode `64-bit` values
+ * \param[in]       data: Encoded data, complete blocks of `64-bit` values
+ * \param[in]       len: Length of encoded data in units of bytes
+ * \param[out]      vals_out: Output array for decoded values
+ * \param[in]       vals_max: Size of output array in units of values. Use \ref lwutil_column_count
+ * \return          Number of decoded values. `0` if data is empty or malformed, or output array is too short
+ */
+LWUTIL_API size_t
+lwutil_column_dec_u64(const void* data, size_t len, uint64_t* vals_out, size_t vals_max) {
+    const prv_column_kernels_t* kernels = prv_column_kernels_get();
+    const uint8_t* p = (const uint8_t*)data;
+    prv_column_block_t blk;
+    size_t count = 0;
+
+    if (LWUTIL_IS_NULL(data) || LWUTIL_IS_NULL(vals_out)) {
+        return 0;
+    }
+    for (size_t pos = 0; pos < len; pos += blk.len) {
+        uint64_t* out = &vals_out[count];
+
+        if (!prv_column_parse(&p[pos], len - pos, &blk) || !blk.is64 || blk.cnt > (vals_max - count)) {
+            return 0;
+        }
+        if (blk.width == 0) {
+            memset(out, 0x00, blk.cnt * sizeof(*out));
+        } else if (blk.cnt == LWUTIL_COLUMN_BLOCK && blk.width <= 32U && kernels->unpack != NULL) {
+            uint32_t t32[LWUTIL_COLUMN_BLOCK];
+
+            kernels->unpack(&p[pos + blk.hdr_len], t32, blk.width);
+            for (size_t i = 0; i < LWUTIL_COLUMN_BLOCK; ++i) {
+                out[i] = t32[i];
+            }
+        } else {
+            uint64_t t[LWUTIL_COLUMN_BLOCK];
+
+            prv_column_unpack(&p[pos + blk.hdr_len], t, (blk.cnt + 3U) / 4U, blk.width);
+            memcpy(out, t, blk.cnt * sizeof(*out));
+        }
+        prv_column_finish_u64(out, blk.cnt, blk.ref, blk.prev, blk.flags);
+        count += blk.cnt;
+    }
+    return count;
+}
+
+#endif /* !LWUTIL_CFG_HEADER_ONLY || defined(LWUTIL_HEADER_ONLY_IMPL) */
@@ -0,0 +1,281 @@
+/**
+ * \file            lwutil_interp.c
+ * \brief           Piecewise-linear interpolation table
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwUTIL - Lightweight utility library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v1.3.0
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lwutil/lwutil_interp.h"
+#include "lwutil/lwutil_private.h"
+
+/*
+ * In header-only mode, implementation is included by the lwutil_interp.h header,
+ * and is compiled into every translation unit as static inline functions.
+ */
+#if !LWUTIL_CFG_HEADER_ONLY || defined(LWUTIL_HEADER_ONLY_IMPL)
+
+/**
+ * \brief           Find segment with direct index calculation, for equally spaced breakpoints
+ *
+ * Index estimate from the reciprocal is either exact or one too low, and is corrected with single comparison.
+ *
+ * \param[in]       it: Interpolation table
+ * \param[in]       x: Input value
+ * \return          Segment to interpolate in
+ */
+static inline const lwutil_interp_seg_t*
+prv_interp_index(const lwutil_interp_t* it, int32_t x) {
+    uint64_t d = x > it->x_min ? (uint64_t)((int64_t)x - it->x_min) : 0U;
+    uint64_t idx = (d * it->step_inv) >> 32U;
+
+    idx += (d - idx * it->step) >= it->step;
+    return &it->segs[idx < it->seg_cnt ? idx : it->seg_cnt - 1U];
+}
+
+/**
+ * \brief           Find segment with branchless binary search
+ * \param[in]       it: Interpolation table
+ * \param[in]       x: Input value
+ * \return          Last segment starting at or before `x`, first segment if `x` is below the range
+ */
+static inline const lwutil_interp_seg_t*
+prv_interp_search(const lwutil_interp_t* it, int32_t x) {
+    const lwutil_interp_seg_t* base = it->segs;
+
+    for (size_t n = it->seg_cnt; n > 1U;) {
+        size_t half = n / 2U;
+
+        base = base[half].x <= x ? &base[half] : base;
+        n -= half;
+    }
+    return base;
+}
+
+/**
+ * \brief           Interpolate within the segment
+ * \param[in]       seg: Segment
+ * \param[in]       x: Input value
+ * \return          Interpolated value, rounded to nearest, before output is saturated
+ */
+static inline int64_t
+prv_interp_seg(const lwutil_interp_seg_t* seg, int32_t x) {
+    int64_t p = ((int64_t)x - seg->x) * seg->slope + (int64_t)((UINT64_C(1) << seg->shift) >> 1U);
+    uint64_t sign = 0U - (uint64_t)(p < 0);
+
+    /* Shift with rounding toward negative infinity, for consistent rounding of negative values */
+    return (int64_t)((((uint64_t)p ^ sign) >> seg->shift) ^ sign) + seg->y;
+}
+
+/**
+ * \brief           Interpolate single value
+ * \param[in]       it: Interpolation table
+ * \param[in]       x: Input value
+ * \param[in]       uniform: Set to `1` for equally spaced breakpoints. Constant, selected once per array
+ * \param[in]       constrain: Set to `1` to constrain input to the breakpoint range
+ * \return          Interpolated value, before output is saturated
+ */
+static inline int64_t
+prv_interp(const lwutil_interp_t* it, int32_t x, uint8_t uniform, uint8_t constrain) {
+    if (constrain) {
+        x = x < it->x_min ? it->x_min : (x > it->x_max ? it->x_max : x);
+    }
+    return prv_interp_seg(uniform ? prv_interp_index(it, x) : prv_interp_search(it, x), x);
+}
+
+/**
+ * \brief           Limit value to the range
+ * \param[in]       val: Value to limit
+ * \param[in]       lo: Minimum value
+ * \param[in]       hi: Maximum value
+ * \return          Limited value
+ */
+static inline int64_t
+prv_interp_limit(int64_t val, int64_t lo, int64_t hi) {
+    return val < lo ? lo : (val > hi ? hi : val);
+}
+
+/**
+ * \brief           Initialize interpolation table from breakpoints
+ *
+ * Breakpoints are only read during initialization. Segment array is referenced by the table
+ * and must stay valid for as long as the table is used.
+ *
+ * \param[out]      it: Interpolation table to initialize
+ * \param[out]      segs: Array of at least `count - 1` segments, filled by the function
+ * \param[in]       xs: Input values of breakpoints, in strictly increasing order
+ * \param[in]       ys: Output values of breakpoints
+ * \param[in]       count: Number of breakpoints. Must be at least `2`
+ * \return          `1` on success, `0` if there are less than `2` breakpoints, input values are not increasing,
+ *                      or any segment is `2^30` or more times steeper than `1`
+ */
+LWUTIL_API uint8_t
+lwutil_interp_init(lwutil_interp_t* it, lwutil_interp_seg_t* segs, const int32_t* xs, const int32_t* ys,
+                   size_t count) {
+    uint64_t step;
+
+    if (LWUTIL_IS_NULL(it) || LWUTIL_IS_NULL(segs) || LWUTIL_IS_NULL(xs) || LWUTIL_IS_NULL(ys) || count < 2U) {
+        return 0;
+    }
+    for (size_t i = 1; i < count; ++i) {
+        if (xs[i] <= xs[i - 1U]) {
+            return 0;
+        }
+    }
+
+    step = (uint64_t)((int64_t)xs[1] - xs[0]);
+    for (size_t i = 0; i < count - 1U; ++i) {
+        uint64_t dx = (uint64_t)((int64_t)xs[i + 1U] - xs[i]);
+        int64_t dy = (int64_t)ys[i + 1U] - ys[i];
+        uint64_t a = (uint64_t)(dy < 0 ? -dy : dy);
+        uint8_t shift = 0;
+
+        /* Use the longest shift, with slope still lower than 2^30, so that products fit 63 bits */
+        if ((a + dx / 2U) / dx >= (UINT64_C(1) << 30U)) {
+            return 0;
+        } else if (a > 0) {
+            for (; shift < 62U && a < (UINT64_C(1) << (62U - shift))
+                   && ((a << (shift + 1U)) + dx / 2U) / dx < (UINT64_C(1) << 30U);
+                 ++shift) {}
+        }
+        segs[i].x = xs[i];
+        segs[i].y = ys[i];
+        segs[i].slope = (int32_t)(((a << shift) + dx / 2U) / dx);
+        segs[i].slope = dy < 0 ? -segs[i].slope : segs[i].slope;
+        segs[i].shift = shift;
+        if (dx != step) {
+            step = 0;
+        }
+    }
+
+    memset(it, 0x00, sizeof(*it));
+    it->segs = segs;
+    it->seg_cnt = count - 1U;
+    it->x_min = xs[0];
+    it->x_max = xs[count - 1U];
+    it->step = (uint32_t)step;
+    it->step_inv = step > 0 ? (UINT64_C(1) << 32U) / step : 0;
+    return 1;
+}
+
+/**
+ * \brief           Interpolate single value
+ * \param[in]       it: Interpolation table
+ * \param[in]       x: Input value. Values outside the breakpoint range are extrapolated
+ * \return          Interpolated value, saturated to `32-bit` range. `0` in case of an error
+ */
+LWUTIL_API int32_t
+lwutil_interp_s32(const lwutil_interp_t* it, int32_t x) {
+    if (LWUTIL_IS_NULL(it)) {
+        return 0;
+    }
+    return (int32_t)prv_interp_limit(prv_interp(it, x, it->step > 0, 0), INT32_MIN, INT32_MAX);
+}
+
+/**
+ * \brief           Interpolate array of `16-bit` samples
+ * \param[in]       it: Interpolation table
+ * \param[in]       in: Input samples
+ * \param[out]      out: Output samples. May be equal to `in` for in-place interpolation
+ * \param[in]       count: Number of samples
+ * \param[in]       constrain: Set to `1` to constrain input to the breakpoint range, `0` to extrapolate.
+ *                      Output is always saturated to `16-bit` range
+ */
+LWUTIL_API void
+lwutil_interp_s16_array(const lwutil_interp_t* it, const int16_t* in, int16_t* out, size_t count,
+                        uint8_t constrain) {
+    lwutil_interp_t t;
+
+    if (LWUTIL_IS_NULL(it) || LWUTIL_IS_NULL(in) || LWUTIL_IS_NULL(out)) {
+        return;
+    }
+    /* Local copy, output stores cannot alias it */
+    t = *it;
+
+    /* Separate loops, to have search method and constrain flag constant in every loop */
+    if (t.step > 0 && constrain) {
+        for (size_t idx = 0; idx < count; ++idx) {
+            out[idx] = (int16_t)prv_interp_limit(prv_interp(&t, in[idx], 1, 1), INT16_MIN, INT16_MAX);
+        }
+    } else if (t.step > 0) {
+        for (size_t idx = 0; idx < count; ++idx) {
+            out[idx] = (int16_t)prv_interp_limit(prv_interp(&t, in[idx], 1, 0), INT16_MIN, INT16_MAX);
+        }
+    } else if (constrain) {
+        for (size_t idx = 0; idx < count; ++idx) {
+            out[idx] = (int16_t)prv_interp_limit(prv_interp(&t, in[idx], 0, 1), INT16_MIN, INT16_MAX);
+        }
+    } else {
+        for (size_t idx = 0; idx < count; ++idx) {
+            out[idx] = (int16_t)prv_interp_limit(prv_interp(&t, in[idx], 0, 0), INT16_MIN, INT16_MAX);
+        }
+    }
+}
+
+/**
+ * \brief           Interpolate array of `32-bit` samples
+ * \param[in]       it: Interpolation table
+ * \param[in]       in: Input samples
+ * \param[out]      out: Output samples. May be equal to `in` for in-place interpolation
+ * \param[in]       count: Number of samples
+ * \param[in]       constrain: Set to `1` to constrain input to the breakpoint range, `0` to extrapolate.
+ *                      Output is always saturated to `32-bit` range
+ */
+LWUTIL_API void
+lwutil_interp_s32_array(const lwutil_interp_t* it, const int32_t* in, int32_t* out, size_t count,
+                        uint8_t constrain) {
+    lwutil_interp_t t;
+
+    if (LWUTIL_IS_NULL(it) || LWUTIL_IS_NULL(in) || LWUTIL_IS_NULL(out)) {
+        return;
+    }
+    t = *it;
+    if (t.step > 0 && constrain) {
+        for (size_t idx = 0; idx < count; ++idx) {
+            out[idx] = (int32_t)prv_interp_limit(prv_interp(&t, in[idx], 1, 1), INT32_MIN, INT32_MAX);
+        }
+    } else if (t.step > 0) {
+        for (size_t idx = 0; idx < count; ++idx) {
+            out[idx] = (int32_t)prv_interp_limit(prv_interp(&t, in[idx], 1, 0), INT32_MIN, INT32_MAX);
+        }
+    } else if (constrain) {
+        for (size_t idx = 0; idx < count; ++idx) {
+            out[idx] = (int32_t)prv_interp_limit(prv_interp(&t, in[idx], 0, 1), INT32_MIN, INT32_MAX);
+        }
+    } else {
+        for (size_t idx = 0; idx < count; ++idx) {
+            out[idx] = (int32_t)prv_interp_limit(prv_interp(&t, in[idx], 0, 0), INT32_MIN, INT32_MAX);
+        }
+    }
+}
+
+#endif /* !LWUTIL_CFG_HEADER_ONLY || defined(LWUTIL_HEADER_ONLY_IMPL) */
@@ -0,0 +1,347 @@
+/**
+ * \file            lwutil_map.c
+ * \brief           Precomputed fixed-point range mapper
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwUTIL - Lightweight utility library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v1.3.0
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lwutil/lwutil_map.h"
+#include "lwutil/lwutil_private.h"
+
+/*
+ * In header-only mode, implementation is included by the lwutil_map.h header,
+ * and is compiled into every translation unit as static inline functions.
+ */
+#if !LWUTIL_CFG_HEADER_ONLY || defined(LWUTIL_HEADER_ONLY_IMPL)
+
+/**
+ * \brief           Map single value with fixed-point scale
+ * \param[in]       map: Range mapper
+ * \param[in]       x: Input value
+ * \return          Mapped value, before output range is applied
+ */
+static inline int64_t
+prv_map_fixed(const lwutil_map_t* map, int64_t x) {
+    int64_t p = (x - map->in_min) * map->scale;
+    uint64_t sign = 0U - (uint64_t)(p < 0);
+
+    /* Shift magnitude and restore the sign, to round toward zero, like integer division */
+    return (int64_t)((((((uint64_t)p ^ sign) - sign) >> map->shift) ^ sign) - sign) + map->out_min;
+}
+
+/**
+ * \brief           Limit value to the range
+ * \param[in]       val: Value to limit
+ * \param[in]       lo: Minimum value
+ * \param[in]       hi: Maximum value
+ * \return          Limited value
+ */
+static inline int64_t
+prv_map_limit(int64_t val, int64_t lo, int64_t hi) {
+    return val < lo ? lo : (val > hi ? hi : val);
+}
+
+#if LWUTIL_SIMD_MAX >= 3
+
+/**
+ * \brief           Map eight `32-bit` input offsets with fixed-point scale
+ * \param[in]       d: Offsets from the minimum value of input range
+ * \param[in]       scale: Fixed-point scale in every `32-bit` lane
+ * \param[in]       bias: `2^shift - 1` in every `64-bit` lane
+ * \param[in]       sh64: Shift of `64-bit` products, up to `32`
+ * \param[in]       sh32: Remaining shift of `32-bit` results
+ * \return          Mapped offsets from the minimum value of output range
+ */
+LWUTIL_TARGET("avx2")
+static inline __m256i
+prv_map_fixed_avx2(__m256i d, __m256i scale, __m256i bias, __m128i sh64, __m128i sh32) {
+    __m256i pe = _mm256_mul_epi32(d, scale);
+    __m256i po = _mm256_mul_epi32(_mm256_srli_epi64(d, 32), scale);
+
+    /* Round toward zero, like integer division */
+    pe = _mm256_add_epi64(pe, _mm256_and_si256(_mm256_cmpgt_epi64(_mm256_setzero_si256(), pe), bias));
+    po = _mm256_add_epi64(po, _mm256_and_si256(_mm256_cmpgt_epi64(_mm256_setzero_si256(), po), bias));
+
+    /*
+     * Logical shift keeps correct low 32 bits of the quotient for shift up to 32,
+     * longer shifts are finished with arithmetic shift of the high half
+     */
+    pe = _mm256_srl_epi64(pe, sh64);
+    po = _mm256_srl_epi64(po, sh64);
+    return _mm256_sra_epi32(_mm256_blend_epi32(pe, _mm256_slli_epi64(po, 32), 0xAA), sh32);
+}
+
+/**
+ * \brief           Map block of `16-bit` samples with AVX2 instructions
+ * \param[in]       map: Range mapper. It must have `s16_fast` flag set
+ * \param[in]       in: Input samples
+ * \param[out]      out: Output samples. May be equal to `in`
+ * \param[in]       count: Number of samples. Only multiple of `16` samples is processed
+ * \param[in]       constrain: Set to `1` to constrain output to output range
+ * \return          Number of processed samples
+ */
+LWUTIL_TARGET("avx2")
+static size_t
+prv_map_s16_avx2(const lwutil_map_t* map, const int16_t* in, int16_t* out, size_t count, uint8_t constrain) {
+    const __m256i in_min = _mm256_set1_epi32(map->in_min);
+    const __m256i out_min = _mm256_set1_epi32(map->out_min);
+    const __m256i scale = _mm256_set1_epi32(map->scale);
+    const __m256i bias = _mm256_set1_epi64x((int64_t)((UINT64_C(1) << map->shift) - 1U));
+    const __m128i sh64 = _mm_cvtsi32_si128(map->shift < 32U ? map->shift : 32);
+    const __m128i sh32 = _mm_cvtsi32_si128(map->shift < 32U ? 0 : map->shift - 32);
+    const __m256i lo = _mm256_set1_epi32(constrain ? map->lo : INT16_MIN);
+    const __m256i hi = _mm256_set1_epi32(constrain ? map->hi : INT16_MAX);
+    size_t idx = 0;
+
+    for (; (count - idx) >= 16U; idx += 16U) {
+        __m256i y[2];
+
+        for (size_t i = 0; i < 2U; ++i) {
+            __m256i x = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)&in[idx + 8U * i]));
+
+            y[i] = prv_map_fixed_avx2(_mm256_sub_epi32(x, in_min), scale, bias, sh64, sh32);
+            y[i] = _mm256_min_epi32(_mm256_max_epi32(_mm256_add_epi32(y[i], out_min), lo), hi);
+        }
+        /* Pack works within 128-bit lanes, restore linear order */
+        _mm256_storeu_si256((__m256i*)&out[idx], _mm256_permute4x64_epi64(_mm256_packs_epi32(y[0], y[1]), 0xD8));
+    }
+    return idx;
+}
+
+/**
+ * \brief           Map block of floating-point samples with AVX2 instructions
+ * \param[in]       map: Range mapper
+ * \param[in]       in: Input samples
+ * \param[out]      out: Output samples. May be equal to `in`
+ * \param[in]       count: Number of samples. Only multiple of `8` samples is processed
+ * \param[in]       constrain: Set to `1` to constrain output to output range
+ * \return          Number of processed samples
+ */
+LWUTIL_TARGET("avx2")
+static size_t
+prv_map_f32_avx2(const lwutil_map_t* map, const float* in, float* out, size_t count, uint8_t constrain) {
+    const __m256 in_min = _mm256_set1_ps(map->in_min_f);
+    const __m256 out_min = _mm256_set1_ps(map->out_min_f);
+    const __m256 scale = _mm256_set1_ps(map->scale_f);
+    const __m256 lo = _mm256_set1_ps(map->lo_f);
+    const __m256 hi = _mm256_set1_ps(map->hi_f);
+    size_t idx = 0;
+
+    for (; (count - idx) >= 8U; idx += 8U) {
+        __m256 y = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(&in[idx]), in_min), scale), out_min);
+
+        if (constrain) {
+            y = _mm256_min_ps(_mm256_max_ps(y, lo), hi);
+        }
+        _mm256_storeu_ps(&out[idx], y);
+    }
+    return idx;
+}
+
+#endif /* LWUTIL_SIMD_MAX >= 3 */
+
+/**
+ * \brief           Initialize range mapper
+ * 
+ * Mapper can be used for input values outside input range,
+ * like \ref LWUTIL_MAP macro. Output range may be inverted, with `out_min` higher than `out_max`.
+ * 
+ * \param[out]      map: Range mapper to initialize
+ * \param[in]       in_min: Minimum value to map from (input boundary)
+ * \param[in]       in_max: Maximum value to map from (input boundary). Must not be equal to `in_min`
+ * \param[in]       out_min: Minimum value to map to (output boundary)
+ * \param[in]       out_max: Maximum value to map to (output boundary)
+ * \return          `1` on success, `0` if input range is empty,
+ *                      or output range is `2^30` or more times wider than input range
+ */
+LWUTIL_API uint8_t
+lwutil_map_init(lwutil_map_t* map, int32_t in_min, int32_t in_max, int32_t out_min, int32_t out_max) {
+    int64_t in_span = (int64_t)in_max - in_min, out_span = (int64_t)out_max - out_min;
+    uint64_t a, b, in_min_abs, out_min_abs;
+    uint8_t shift = 0;
+
+    if (LWUTIL_IS_NULL(map) || in_span == 0) {
+        return 0;
+    }
+    a = (uint64_t)(out_span < 0 ? -out_span : out_span);
+    b = (uint64_t)(in_span < 0 ? -in_span : in_span);
+    if (a >= (b << 30U)) {
+        return 0;
+    }
+
+    /* Use the longest shift, with scale still lower than 2^30 */
+    if (a > 0) {
+        for (; shift < 62U && (a << (shift + 1U)) < (b << 30U); ++shift) {}
+    }
+    memset(map, 0x00, sizeof(*map));
+    map->in_min = in_min;
+    map->out_min = out_min;
+    map->shift = shift;
+    map->scale = (int32_t)(((a << shift) + b / 2U) / b);
+    if ((out_span < 0) != (in_span < 0)) {
+        map->scale = -map->scale;
+    }
+    map->lo = LWUTIL_MIN(out_min, out_max);
+    map->hi = LWUTIL_MAX(out_min, out_max);
+
+    /* Offsets of all 16-bit samples and their results must fit 32-bit lanes */
+    in_min_abs = (uint64_t)(in_min < 0 ? -(int64_t)in_min : in_min);
+    out_min_abs = (uint64_t)(out_min < 0 ? -(int64_t)out_min : out_min);
+    map->s16_fast = in_min_abs <= (UINT64_C(1) << 30U) && out_min_abs < (UINT64_C(1) << 30U)
+                    && (in_min_abs + 32768U) * a < (b << 30U);
+
+    map->in_min_f = (float)in_min;
+    map->out_min_f = (float)out_min;
+    map->scale_f = (float)((double)out_span / (double)in_span);
+    map->lo_f = (float)map->lo;
+    map->hi_f = (float)map->hi;
+    return 1;
+}
+
+/**
+ * \brief           Map single value from input to output range
+ * \param[in]       map: Range mapper
+ * \param[in]       x: Value to map
+ * \return          Mapped value, saturated to `32-bit` range. `0` in case of an error
+ */
+LWUTIL_API int32_t
+lwutil_map_s32(const lwutil_map_t* map, int32_t x) {
+    if (LWUTIL_IS_NULL(map)) {
+        return 0;
+    }
+    return (int32_t)prv_map_limit(prv_map_fixed(map, x), INT32_MIN, INT32_MAX);
+}
+
+/**
+ * \brief           Map array of `16-bit` samples from input to output range
+ * 
+ * When AVX2 instruction set is supported by the CPU, samples are mapped in `32-bit` lanes,
+ * with results identical to scalar code.
+ * 
+ * \param[in]       map: Range mapper
+ * \param[in]       in: Input samples
+ * \param[out]      out: Output samples. May be equal to `in` for in-place mapping
+ * \param[in]       count: Number of samples
+ * \param[in]       constrain: Set to `1` to constrain output to output range, `0` otherwise.
+ *                      Output is always saturated to `16-bit` range
+ */
+LWUTIL_API void
+lwutil_map_s16_array(const lwutil_map_t* map, const int16_t* in, int16_t* out, size_t count, uint8_t constrain) {
+    lwutil_map_t m;
+    size_t idx = 0;
+
+    if (LWUTIL_IS_NULL(map) || LWUTIL_IS_NULL(in) || LWUTIL_IS_NULL(out)) {
+        return;
+    }
+#if LWUTIL_SIMD_MAX >= 3
+    if (map->s16_fast && lwutil_simd_get_level() >= LWUTIL_SIMD_AVX2) {
+        idx = prv_map_s16_avx2(map, in, out, count, constrain);
+    }
+#endif /* LWUTIL_SIMD_MAX >= 3 */
+    /* Local copy, output stores cannot alias it */
+    m = *map;
+    for (; idx < count; ++idx) {
+        int64_t val = prv_map_fixed(&m, in[idx]);
+
+        if (constrain) {
+            val = prv_map_limit(val, m.lo, m.hi);
+        }
+        out[idx] = (int16_t)prv_map_limit(val, INT16_MIN, INT16_MAX);
+    }
+}
+
+/**
+ * \brief           Map array of `32-bit` samples from input to output range
+ * \param[in]       map: Range mapper
+ * \param[in]       in: Input samples
+ * \param[out]      out: Output samples. May be equal to `in` for in-place mapping
+ * \param[in]       count: Number of samples
+ * \param[in]       constrain: Set to `1` to constrain output to output range, `0` otherwise.
+ *                      Output is always saturated to `32-bit` range
+ */
+LWUTIL_API void
+lwutil_map_s32_array(const lwutil_map_t* map, const int32_t* in, int32_t* out, size_t count, uint8_t constrain) {
+    lwutil_map_t m;
+    int64_t lo = INT32_MIN, hi = INT32_MAX;
+
+    if (LWUTIL_IS_NULL(map) || LWUTIL_IS_NULL(in) || LWUTIL_IS_NULL(out)) {
+        return;
+    }
+    if (constrain) {
+        lo = map->lo;
+        hi = map->hi;
+    }
+    m = *map;
+    for (size_t idx = 0; idx < count; ++idx) {
+        out[idx] = (int32_t)prv_map_limit(prv_map_fixed(&m, in[idx]), lo, hi);
+    }
+}
+
+/**
+ * \brief           Map array of floating-point samples from input to output range
+ * 
+ * Results are not rounded to integer values.
+ * When AVX2 instruction set is supported by the CPU, samples are mapped with vector instructions.
+ * 
+ * \param[in]       map: Range mapper
+ * \param[in]       in: Input samples
+ * \param[out]      out: Output samples. May be equal to `in` for in-place mapping
+ * \param[in]       count: Number of samples
+ * \param[in]       constrain: Set to `1` to constrain output to output range, `0` otherwise.
+ *                      Not-a-number input is constrained to the lower output value
+ */
+LWUTIL_API void
+lwutil_map_f32_array(const lwutil_map_t* map, const float* in, float* out, size_t count, uint8_t constrain) {
+    size_t idx = 0;
+
+    if (LWUTIL_IS_NULL(map) || LWUTIL_IS_NULL(in) || LWUTIL_IS_NULL(out)) {
+        return;
+    }
+#if LWUTIL_SIMD_MAX >= 3
+    if (lwutil_simd_get_level() >= LWUTIL_SIMD_AVX2) {
+        idx = prv_map_f32_avx2(map, in, out, count, constrain);
+    }
+#endif /* LWUTIL_SIMD_MAX >= 3 */
+    for (; idx < count; ++idx) {
+        float y = (in[idx] - map->in_min_f) * map->scale_f + map->out_min_f;
+
+        if (constrain) {
+            /* Same operand order as vector min and max instructions */
+            y = y > map->lo_f ? y : map->lo_f;
+            y = y < map->hi_f ? y : map->hi_f;
+        }
+        out[idx] = y;
+    }
+}
+
+#endif /* !LWUTIL_CFG_HEADER_ONLY || defined(LWUTIL_HEADER_ONLY_IMPL) */
@@ -0,0 +1,413 @@
+/**
+ * \file            lwutil_ring.c
+ * \brief           Lock-free record ring buffer
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwUTIL - Lightweight utility library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v1.3.0
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lwutil/lwutil_ring.h"
+#include "lwutil/lwutil_private.h"
+
+/*
+ * In header-only mode, implementation is included by the lwutil_ring.h header,
+ * and is compiled into every translation unit as static inline functions.
+ */
+#if !LWUTIL_CFG_HEADER_ONLY || defined(LWUTIL_HEADER_ONLY_IMPL)
+
+/* Atomic operations, same syntax for C11 and C++ */
+#ifdef __cplusplus
+#define PRV_RING_LOAD(obj, mo)       std::atomic_load_explicit((obj), std::memory_order_##mo)
+#define PRV_RING_STORE(obj, val, mo) std::atomic_store_explicit((obj), (val), std::memory_order_##mo)
+#define PRV_RING_CAS(obj, exp, val)                                                                                    \
+    std::atomic_compare_exchange_weak_explicit((obj), (exp), (val), std::memory_order_relaxed,                         \
+                                               std::memory_order_relaxed)
+#else
+#define PRV_RING_LOAD(obj, mo)       atomic_load_explicit((obj), memory_order_##mo)
+#define PRV_RING_STORE(obj, val, mo) atomic_store_explicit((obj), (val), memory_order_##mo)
+#define PRV_RING_CAS(obj, exp, val)                                                                                    \
+    atomic_compare_exchange_weak_explicit((obj), (exp), (val), memory_order_relaxed, memory_order_relaxed)
+#endif /* __cplusplus */
+
+/* CPU hint inside spin-wait loop, lets the other hardware thread run and saves power */
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define PRV_RING_PAUSE() _mm_pause()
+#elif defined(_MSC_VER) && (defined(_M_ARM64) || defined(_M_ARM))
+#define PRV_RING_PAUSE() __yield()
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define PRV_RING_PAUSE() __builtin_ia32_pause()
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__aarch64__) || (defined(__ARM_ARCH) && __ARM_ARCH >= 7))
+#define PRV_RING_PAUSE() __asm__ __volatile__("yield")
+#else
+#define PRV_RING_PAUSE()
+#endif
+
+/* Give up the time slice, when earlier producer was preempted and spinning does not help */
+#if defined(LWUTIL_CFG_RING_YIELD)
+#define PRV_RING_YIELD() LWUTIL_CFG_RING_YIELD()
+#elif defined(_WIN32)
+#include <windows.h>
+#define PRV_RING_YIELD() SwitchToThread()
+#elif defined(__unix__) || defined(__APPLE__)
+#include <sched.h>
+#define PRV_RING_YIELD() sched_yield()
+#else
+#define PRV_RING_YIELD() PRV_RING_PAUSE()
+#endif
+
+/* Number of spin iterations before producer starts to yield */
+#define PRV_RING_SPIN_MAX 64U
+
+/* Header values with special meaning */
+#define PRV_RING_HDR_WRAP 0x00U
+#define PRV_RING_HDR_PAD  0x01U
+
+/**
+ * \brief           Write record header as varint of fixed length
+ *
+ * Header length is selected at reservation, for the reserved record length.
+ * Shorter committed length is written with trailing continuation bytes of zero value,
+ * which are accepted by \ref prv_ring_get_hdr and by \ref lwutil_ld_u32_varint.
+ *
+ * \param[out]      ptr: Header position
+ * \param[in]       hdr_len: Header length in units of bytes
+ * \param[in]       val: Header value
+ */
+static void
+prv_ring_put_hdr(uint8_t* ptr, uint8_t hdr_len, uint32_t val) {
+    uint8_t i;
+
+    for (i = 0; i + 1U < hdr_len; ++i) {
+        ptr[i] = (uint8_t)((val & 0x7FU) | 0x80U);
+        val >>= 7U;
+    }
+    ptr[i] = (uint8_t)val;
+}
+
+/**
+ * \brief           Read record header, written by \ref prv_ring_put_hdr
+ *
+ * Header is decoded byte by byte, so that no byte after the header is read,
+ * which may still be written by producers. Decoding is not counted by the instrumentation.
+ *
+ * \param[in]       ptr: Header position
+ * \param[in]       len: Number of bytes until the end of the data array
+ * \param[out]      val: Pointer to write header value to
+ * \return          Header length in units of bytes
+ */
+static uint8_t
+prv_ring_get_hdr(const uint8_t* ptr, size_t len, uint32_t* val) {
+    uint32_t v = 0;
+    uint8_t i;
+
+    for (i = 0; i < 5U && i < len; ++i) {
+        v |= (uint32_t)(ptr[i] & 0x7FU) << (7U * i);
+        if (ptr[i] < 0x80U) {
+            *val = v;
+            return (uint8_t)(i + 1U);
+        }
+    }
+    return 0;
+}
+
+/**
+ * \brief           Initialize ring buffer
+ * \param[in]       ring: Ring buffer
+ * \param[in]       data: Data array, used for record storage
+ * \param[in]       size: Size of data array in units of bytes. Must be power of `2`, at least `2`
+ * \param[in]       mode: Producer mode, \ref LWUTIL_RING_SPSC or \ref LWUTIL_RING_MPSC
+ * \return          `1` on success, `0` otherwise
+ */
+LWUTIL_API uint8_t
+lwutil_ring_init(lwutil_ring_t* ring, void* data, size_t size, lwutil_ring_mode_t mode) {
+    if (LWUTIL_IS_NULL(ring) || LWUTIL_IS_NULL(data) || size < 2U || (size & (size - 1U)) != 0) {
+        return 0;
+    }
+    ring->data = (uint8_t*)data;
+    ring->size = size;
+    ring->mode = mode;
+    PRV_RING_STORE(&ring->head, (size_t)0, relaxed);
+    PRV_RING_STORE(&ring->commit, (size_t)0, relaxed);
+    PRV_RING_STORE(&ring->tail, (size_t)0, relaxed);
+    ring->tail_cache = 0;
+    ring->rd_pos = 0;
+    ring->rd_end = 0;
+    ring->commit_cache = 0;
+    return 1;
+}
+
+/**
+ * \brief           Reserve contiguous space for one record
+ *
+ * Header is written at commit time, record data is written by the producer to `rsv->data`.
+ * When record does not fit before the end of the array, it is placed at the beginning.
+ *
+ * In \ref LWUTIL_RING_SPSC mode, producer shall not reserve again before it commits or cancels the reservation.
+ *
+ * \param[in]       ring: Ring buffer
+ * \param[in]       len: Maximal record length in units of bytes
+ * \param[out]      rsv: Reservation to fill
+ * \return          `1` on success, `0` if there is not enough free space or on invalid parameters
+ */
+LWUTIL_API uint8_t
+lwutil_ring_reserve(lwutil_ring_t* ring, size_t len, lwutil_ring_rsv_t* rsv) {
+    size_t head, pos, need, skip, size;
+    uint8_t hdr_len;
+
+    if (LWUTIL_IS_NULL(ring) || LWUTIL_IS_NULL(rsv) || len > ring->size || len > (size_t)(UINT32_MAX - 2U)) {
+        return 0;
+    }
+    size = ring->size;
+    hdr_len = lwutil_u32_varint_len((uint32_t)(len + 2U));
+    need = hdr_len + len;
+
+    head = PRV_RING_LOAD(&ring->head, relaxed);
+    for (;;) {
+        size_t tail;
+
+        pos = head & (size - 1U);
+        skip = (size - pos) < need ? (size - pos) : 0;
+
+        /* Producer writes to the space, freed by consumer, after the acquire load of its index */
+        if (ring->mode == LWUTIL_RING_SPSC) {
+            tail = ring->tail_cache;
+            if (need + skip > size - (head - tail)) {
+                tail = ring->tail_cache = PRV_RING_LOAD(&ring->tail, acquire);
+            }
+        } else {
+            tail = PRV_RING_LOAD(&ring->tail, acquire);
+        }
+        if (need + skip > size - (head - tail)) {
+            return 0;
+        }
+        if (ring->mode == LWUTIL_RING_SPSC || PRV_RING_CAS(&ring->head, &head, head + skip + need)) {
+            break;
+        }
+    }
+    if (skip > 0) {
+        ring->data[pos] = (uint8_t)PRV_RING_HDR_WRAP;
+        pos = 0;
+    }
+    rsv->data = &ring->data[pos + hdr_len];
+    rsv->len = len;
+    rsv->start = head;
+    rsv->end = head + skip + need;
+    rsv->hdr_len = hdr_len;
+    return 1;
+}
+
+/**
+ * \brief           Publish record at the end of reservation in \ref LWUTIL_RING_MPSC mode
+ *
+ * Records are published in the order of reservation.
+ * Producer waits until all earlier reservations are published by other producers,
+ * first spinning for a short time, and then yielding the processor with \ref LWUTIL_CFG_RING_YIELD.
+ *
+ * \param[in]       ring: Ring buffer
+ * \param[in]       rsv: Reservation
+ */
+static void
+prv_ring_publish_mp(lwutil_ring_t* ring, const lwutil_ring_rsv_t* rsv) {
+    uint32_t spin = 0;
+
+    /* Acquire makes data of earlier records visible to the consumer, together with this record */
+    while (PRV_RING_LOAD(&ring->commit, acquire) != rsv->start) {
+        if (spin < PRV_RING_SPIN_MAX) {
+            ++spin;
+            PRV_RING_PAUSE();
+        } else {
+            PRV_RING_YIELD();
+        }
+    }
+    PRV_RING_STORE(&ring->commit, rsv->end, release);
+}
+
+/**
+ * \brief           Commit reserved record and make it visible to the consumer
+ * \param[in]       ring: Ring buffer
+ * \param[in]       rsv: Reservation, filled by \ref lwutil_ring_reserve
+ * \param[in]       len: Final record length in units of bytes. Must not exceed reserved length
+ * \return          `1` on success, `0` otherwise
+ */
+LWUTIL_API uint8_t
+lwutil_ring_commit(lwutil_ring_t* ring, const lwutil_ring_rsv_t* rsv, size_t len) {
+    if (LWUTIL_IS_NULL(ring) || LWUTIL_IS_NULL(rsv) || len > rsv->len) {
+        return 0;
+    }
+    prv_ring_put_hdr(rsv->data - rsv->hdr_len, rsv->hdr_len, (uint32_t)(len + 2U));
+    if (ring->mode == LWUTIL_RING_SPSC) {
+        /* Single producer gives back the unused space */
+        size_t end = rsv->end - (rsv->len - len);
+
+        PRV_RING_STORE(&ring->head, end, relaxed);
+        PRV_RING_STORE(&ring->commit, end, release);
+    } else {
+        memset(rsv->data + len, (int)PRV_RING_HDR_PAD, rsv->len - len);
+        prv_ring_publish_mp(ring, rsv);
+    }
+    return 1;
+}
+
+/**
+ * \brief           Cancel reservation without publishing a record
+ *
+ * In \ref LWUTIL_RING_MPSC mode, reserved space is published as padding,
+ * so that records of later reservations are not blocked.
+ *
+ * \param[in]       ring: Ring buffer
+ * \param[in]       rsv: Reservation, filled by \ref lwutil_ring_reserve
+ * \return          `1` on success, `0` otherwise
+ */
+LWUTIL_API uint8_t
+lwutil_ring_cancel(lwutil_ring_t* ring, const lwutil_ring_rsv_t* rsv) {
+    if (LWUTIL_IS_NULL(ring) || LWUTIL_IS_NULL(rsv)) {
+        return 0;
+    }
+    if (ring->mode == LWUTIL_RING_MPSC) {
+        memset(rsv->data - rsv->hdr_len, (int)PRV_RING_HDR_PAD, rsv->hdr_len + rsv->len);
+        prv_ring_publish_mp(ring, rsv);
+    }
+    return 1;
+}
+
+/**
+ * \brief           Copy one record into the ring buffer
+ * \param[in]       ring: Ring buffer
+ * \param[in]       data: Record data
+ * \param[in]       len: Record length in units of bytes
+ * \return          `1` on success, `0` if there is not enough free space or on invalid parameters
+ */
+LWUTIL_API uint8_t
+lwutil_ring_write(lwutil_ring_t* ring, const void* data, size_t len) {
+    lwutil_ring_rsv_t rsv;
+
+    if ((LWUTIL_IS_NULL(data) && len > 0) || !lwutil_ring_reserve(ring, len, &rsv)) {
+        return 0;
+    }
+    if (len > 0) {
+        memcpy(rsv.data, data, len);
+    }
+    return lwutil_ring_commit(ring, &rsv, len);
+}
+
+/**
+ * \brief           Get the oldest record, without removing it from the ring buffer
+ *
+ * Record stays valid and is returned again by next call, until \ref lwutil_ring_release is called.
+ *
+ * \param[in]       ring: Ring buffer
+ * \param[out]      len_out: Pointer to write record length to
+ * \return          Pointer to record data, `NULL` if ring buffer is empty
+ */
+LWUTIL_API const uint8_t*
+lwutil_ring_peek(lwutil_ring_t* ring, size_t* len_out) {
+    size_t tail, pos, size;
+    uint32_t val = 0;
+    uint8_t hdr_len;
+
+    if (LWUTIL_IS_NULL(ring) || LWUTIL_IS_NULL(len_out)) {
+        return NULL;
+    }
+    size = ring->size;
+    tail = ring->rd_pos;
+    for (;;) {
+        if (tail == ring->commit_cache) {
+            ring->commit_cache = PRV_RING_LOAD(&ring->commit, acquire);
+            if (tail == ring->commit_cache) {
+                break;
+            }
+        }
+        pos = tail & (size - 1U);
+        if (ring->data[pos] == PRV_RING_HDR_WRAP) {
+            tail += size - pos;
+        } else if (ring->data[pos] == PRV_RING_HDR_PAD) {
+            ++tail;
+        } else {
+            hdr_len = prv_ring_get_hdr(&ring->data[pos], size - pos, &val);
+            ring->rd_pos = tail;
+            ring->rd_end = tail + hdr_len + (val - 2U);
+            *len_out = val - 2U;
+            return &ring->data[pos + hdr_len];
+        }
+    }
+
+    /* Free skipped space at once, no record is pending */
+    if (tail != ring->rd_pos) {
+        ring->rd_pos = ring->rd_end = tail;
+        PRV_RING_STORE(&ring->tail, tail, release);
+    }
+    return NULL;
+}
+
+/**
+ * \brief           Remove the record, returned by \ref lwutil_ring_peek, and free its space
+ * \param[in]       ring: Ring buffer
+ * \return          `1` on success, `0` if no record was peeked
+ */
+LWUTIL_API uint8_t
+lwutil_ring_release(lwutil_ring_t* ring) {
+    if (LWUTIL_IS_NULL(ring) || ring->rd_end == ring->rd_pos) {
+        return 0;
+    }
+    ring->rd_pos = ring->rd_end;
+    PRV_RING_STORE(&ring->tail, ring->rd_end, release);
+    return 1;
+}
+
+/**
+ * \brief           Copy the oldest record out of the ring buffer and remove it
+ * \param[in]       ring: Ring buffer
+ * \param[out]      out: Output array to copy record to
+ * \param[in]       out_size: Size of output array in units of bytes
+ * \param[out]      len_out: Pointer to write record length to.
+ *                      When output array is too small, record stays in the ring buffer
+ * \return          `1` when record has been read, `0` otherwise
+ */
+LWUTIL_API uint8_t
+lwutil_ring_read(lwutil_ring_t* ring, void* out, size_t out_size, size_t* len_out) {
+    const uint8_t* rec;
+    size_t len;
+
+    if (LWUTIL_IS_NULL(len_out) || (rec = lwutil_ring_peek(ring, &len)) == NULL) {
+        return 0;
+    }
+    *len_out = len;
+    if (len > out_size || (LWUTIL_IS_NULL(out) && len > 0)) {
+        return 0;
+    }
+    if (len > 0) {
+        memcpy(out, rec, len);
+    }
+    return lwutil_ring_release(ring);
+}
+
+#endif /* !LWUTIL_CFG_HEADER_ONLY || defined(LWUTIL_HEADER_ONLY_IMPL) */
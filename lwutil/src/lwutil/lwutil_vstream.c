@@ -0,0 +1,298 @@
+/**
+ * \file            lwutil_vstream.c
+ * \brief           Seekable varint stream
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwUTIL - Lightweight utility library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v1.3.0
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "lwutil/lwutil_vstream.h"
+#include "lwutil/lwutil_private.h"
+
+/*
+ * In header-only mode, implementation is included by the lwutil_vstream.h header,
+ * and is compiled into every translation unit as static inline functions.
+ */
+#if !LWUTIL_CFG_HEADER_ONLY || defined(LWUTIL_HEADER_ONLY_IMPL)
+
+/**
+ * \brief           Find the end of `n` varints
+ * \param[in]       p: Pointer to the first varint
+ * \param[in]       len: Length of input array
+ * \param[in]       n: Number of varints to skip
+ * \return          Number of bytes of `n` varints, `SIZE_MAX` if array ends before
+ */
+static size_t
+prv_vstream_skip(const uint8_t* p, size_t len, size_t n) {
+    size_t pos = 0;
+
+    /* Count value terminators, bytes without continuation bit, 8 at once, with byte sum by multiplication */
+    for (; n > 0 && (len - pos) >= 8U; pos += 8U) {
+        uint64_t stop = ~lwutil_ld_u64_le(&p[pos]) & 0x8080808080808080ULL;
+        size_t cnt = (size_t)(((stop >> 7U) * 0x0101010101010101ULL) >> 56U);
+
+        if (cnt >= n) {
+            for (; n > 1U; --n) {
+                stop &= stop - 1U;
+            }
+            return pos + prv_ctz64(stop) / 8U + 1U;
+        }
+        n -= cnt;
+    }
+    for (; n > 0 && pos < len; ++pos) {
+        if (p[pos] < 0x80U) {
+            --n;
+        }
+    }
+    return n == 0 ? pos : SIZE_MAX;
+}
+
+/**
+ * \brief           Get number of index entries for the stream
+ * \param[in]       count: Number of values in the stream
+ * \param[in]       stride: Number of values per index entry
+ * \return          Number of index entries, `0` if `stride` is `0`
+ */
+LWUTIL_API size_t
+lwutil_vstream_index_len(size_t count, size_t stride) {
+    if (stride == 0) {
+        return 0;
+    }
+    return count / stride + (count % stride != 0 ? 1U : 0U);
+}
+
+/**
+ * \brief           Initialize empty stream for writing
+ * \param[in]       vs: Stream to initialize
+ * \param[in]       data: Array for encoded data
+ * \param[in]       size: Size of data array in units of bytes
+ * \param[in]       index: Array for index entries
+ * \param[in]       index_size: Size of index array in units of entries.
+ *                      Use \ref lwutil_vstream_index_len with maximal number of values
+ * \param[in]       stride: Number of values per index entry, at least `1`
+ * \return          `1` on success, `0` otherwise
+ */
+LWUTIL_API uint8_t
+lwutil_vstream_init(lwutil_vstream_t* vs, void* data, size_t size, uint32_t* index, size_t index_size,
+                    size_t stride) {
+    if (LWUTIL_IS_NULL(vs) || LWUTIL_IS_NULL(data) || LWUTIL_IS_NULL(index) || stride == 0) {
+        return 0;
+    }
+    vs->data = (uint8_t*)data;
+    vs->size = size;
+    vs->len = 0;
+    vs->index = index;
+    vs->index_size = index_size;
+    vs->stride = stride;
+    vs->count = 0;
+    return 1;
+}
+
+/**
+ * \brief           Initialize stream for reading from existing encoded data and index
+ * \note            Only `get` and `seek` functions shall be used with such stream
+ * \param[in]       vs: Stream to initialize
+ * \param[in]       data: Encoded data
+ * \param[in]       len: Length of encoded data in units of bytes
+ * \param[in]       index: Index entries, \ref lwutil_vstream_index_len of them
+ * \param[in]       stride: Number of values per index entry, same as used for writing
+ * \param[in]       count: Number of values in the stream
+ * \return          `1` on success, `0` otherwise
+ */
+LWUTIL_API uint8_t
+lwutil_vstream_init_const(lwutil_vstream_t* vs, const void* data, size_t len, const uint32_t* index, size_t stride,
+                          size_t count) {
+    if (LWUTIL_IS_NULL(vs) || LWUTIL_IS_NULL(data) || LWUTIL_IS_NULL(index) || stride == 0) {
+        return 0;
+    }
+    vs->data = (uint8_t*)data;
+    vs->size = len;
+    vs->len = len;
+    vs->index = (uint32_t*)index;
+    vs->index_size = lwutil_vstream_index_len(count, stride);
+    vs->stride = stride;
+    vs->count = count;
+    return 1;
+}
+
+/**
+ * \brief           Add index entry when next value starts new block
+ * \param[in]       vs: Stream
+ * \return          `1` on success, `0` if index array is full or data exceeds `32-bit` offset
+ */
+static uint8_t
+prv_vstream_index_put(lwutil_vstream_t* vs) {
+    size_t entry = vs->count / vs->stride;
+
+    if ((vs->count % vs->stride) != 0) {
+        return 1;
+    }
+    if (entry >= vs->index_size || (uint64_t)vs->len > UINT32_MAX) {
+        return 0;
+    }
+    vs->index[entry] = (uint32_t)vs->len;
+    return 1;
+}
+
+/**
+ * \brief           Append single value to the stream
+ * \param[in]       vs: Stream
+ * \param[in]       val: Value to append
+ * \return          `1` on success, `0` if data or index array is full
+ */
+LWUTIL_API uint8_t
+lwutil_vstream_put_u32(lwutil_vstream_t* vs, uint32_t val) {
+    uint8_t cnt;
+
+    if (LWUTIL_IS_NULL(vs) || !prv_vstream_index_put(vs)) {
+        return 0;
+    }
+    cnt = lwutil_st_u32_varint(val, &vs->data[vs->len], vs->size - vs->len);
+    if (cnt == 0) {
+        return 0;
+    }
+    vs->len += cnt;
+    ++vs->count;
+    return 1;
+}
+
+/**
+ * \brief           Append array of values to the stream
+ *
+ * Values are encoded block by block with \ref lwutil_st_u32_varint_array.
+ *
+ * \param[in]       vs: Stream
+ * \param[in]       vals: Values to append
+ * \param[in]       count: Number of values
+ * \return          Number of appended values, lower than `count` when data or index array is full
+ */
+LWUTIL_API size_t
+lwutil_vstream_put_u32_array(lwutil_vstream_t* vs, const uint32_t* vals, size_t count) {
+    size_t idx = 0;
+
+    if (LWUTIL_IS_NULL(vs) || LWUTIL_IS_NULL(vals)) {
+        return 0;
+    }
+    while (idx < count) {
+        size_t n = vs->stride - vs->count % vs->stride, written;
+
+        n = n < (count - idx) ? n : (count - idx);
+        if (!prv_vstream_index_put(vs)) {
+            break;
+        }
+        written = lwutil_st_u32_varint_array(&vals[idx], n, &vs->data[vs->len], vs->size - vs->len);
+        if (written == 0) {
+            /* Data array is full, append as many single values as fit */
+            for (; idx < count && lwutil_vstream_put_u32(vs, vals[idx]); ++idx) {}
+            break;
+        }
+        vs->len += written;
+        vs->count += n;
+        idx += n;
+    }
+    return idx;
+}
+
+/**
+ * \brief           Find byte offset of the value at the position
+ * \param[in]       vs: Stream
+ * \param[in]       pos: Value position, from `0` to number of values in the stream.
+ *                      Position equal to number of values gives the end of encoded data
+ * \param[out]      offset_out: Pointer to write byte offset in encoded data to
+ * \return          `1` on success, `0` if position is out of range or stream is malformed
+ */
+LWUTIL_API uint8_t
+lwutil_vstream_seek(const lwutil_vstream_t* vs, size_t pos, size_t* offset_out) {
+    size_t offset, skip;
+
+    if (LWUTIL_IS_NULL(vs) || LWUTIL_IS_NULL(offset_out) || pos > vs->count) {
+        return 0;
+    }
+    if (pos == vs->count) {
+        *offset_out = vs->len;
+        return 1;
+    }
+    offset = vs->index[pos / vs->stride];
+    if (offset > vs->len) {
+        return 0;
+    }
+    skip = prv_vstream_skip(&vs->data[offset], vs->len - offset, pos % vs->stride);
+    if (skip == SIZE_MAX) {
+        return 0;
+    }
+    *offset_out = offset + skip;
+    return 1;
+}
+
+/**
+ * \brief           Get single value at the position
+ * \param[in]       vs: Stream
+ * \param[in]       pos: Value position
+ * \param[out]      val_out: Pointer to write value to
+ * \return          `1` on success, `0` otherwise
+ */
+LWUTIL_API uint8_t
+lwutil_vstream_get_u32(const lwutil_vstream_t* vs, size_t pos, uint32_t* val_out) {
+    size_t offset;
+
+    if (LWUTIL_IS_NULL(val_out) || !lwutil_vstream_seek(vs, pos, &offset) || offset == vs->len) {
+        return 0;
+    }
+    return lwutil_ld_u32_varint(&vs->data[offset], vs->len - offset, val_out) > 0;
+}
+
+/**
+ * \brief           Decode consecutive values, starting at the position
+ *
+ * Function does not modify the stream and can be called from several threads at the same time,
+ * each decoding its own range. Ranges starting at multiples of `stride` need no skipping.
+ *
+ * \param[in]       vs: Stream
+ * \param[in]       pos: Position of the first value
+ * \param[out]      vals_out: Array to write decoded values to
+ * \param[in]       count: Maximal number of values to decode
+ * \return          Number of decoded values, lower than `count` at the end of the stream. `0` on error
+ */
+LWUTIL_API size_t
+lwutil_vstream_get_u32_array(const lwutil_vstream_t* vs, size_t pos, uint32_t* vals_out, size_t count) {
+    size_t offset;
+
+    if (LWUTIL_IS_NULL(vals_out) || !lwutil_vstream_seek(vs, pos, &offset)) {
+        return 0;
+    }
+    count = count < (vs->count - pos) ? count : (vs->count - pos);
+    if (count == 0 || lwutil_ld_u32_varint_array(&vs->data[offset], vs->len - offset, vals_out, count) == 0) {
+        return 0;
+    }
+    return count;
+}
+
+#endif /* !LWUTIL_CFG_HEADER_ONLY || defined(LWUTIL_HEADER_ONLY_IMPL) */